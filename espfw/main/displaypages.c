@@ -0,0 +1,275 @@
+
+/* The pages shown on the display, and drawing them. */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "displaypages.h"
+#include "diwidgets.h"
+#include "wearlevel.h"
+
+/* Colors for values, depending on how good the air is. Black and white
+ * displays show all of them as white. Thresholds are the upper limits of
+ * "good" (green) and "acceptable" (yellow), above that it's red. For CO2
+ * this follows the usual recommendations for indoor air, for particulate
+ * matter the european air quality index, for VOCs and NOx Sensirions advice. */
+struct valuecolor {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+static const struct valuecolor vcgood = { 0x00, 0xe0, 0x00 };
+static const struct valuecolor vcmedium = { 0xff, 0xe0, 0x00 };
+static const struct valuecolor vcbad = { 0xff, 0x20, 0x20 };
+static const struct valuecolor vcneutral = { 0xff, 0xff, 0xff };
+
+static struct valuecolor getvaluecolor(float v, float good, float medium)
+{
+    if (isnan(v)) return vcneutral;
+    if (v <= good) return vcgood;
+    if (v <= medium) return vcmedium;
+    return vcbad;
+}
+
+/* How the history of a page is shown: The sparkline always covers at
+ * least minspan, so that sensor noise does not look like wild jumps, and
+ * the trend arrow points up or down if the value changed by more than
+ * trendthr within the last 10 minutes or so. */
+struct histparams {
+    float minspan;
+    float trendthr;
+};
+static const struct histparams histparams[MAXDISPPAGES] = {
+    [PAGE_TEMP]  = {   1.0,  0.3 },
+    [PAGE_HUM]   = {   5.0,  2.0 },
+    [PAGE_PRESS] = {   2.0,  0.5 },
+    [PAGE_CO2]   = { 100.0, 50.0 },
+    [PAGE_PM010] = {   5.0,  2.0 },
+    [PAGE_PM025] = {   5.0,  2.0 },
+    [PAGE_PM040] = {   5.0,  2.0 },
+    [PAGE_PM100] = {   5.0,  2.0 },
+    [PAGE_VOC]   = {  50.0, 20.0 },
+    [PAGE_NOX]   = {  20.0, 10.0 },
+};
+
+/* The histories, one ring buffer per page. */
+static struct {
+    float v[DP_HISTLEN];
+    uint8_t pos; /* where the next value goes */
+    uint8_t cnt; /* how many values there are */
+} hists[MAXDISPPAGES];
+
+void dp_addvalues(const struct ev * ev)
+{
+    float v[MAXDISPPAGES];
+    v[PAGE_TEMP] = ev->temp;
+    v[PAGE_HUM] = ev->hum;
+    v[PAGE_PRESS] = ev->press;
+    v[PAGE_CO2] = (ev->co2 == 0xffff) ? NAN : ev->co2;
+    v[PAGE_PM010] = ev->pm010;
+    v[PAGE_PM025] = ev->pm025;
+    v[PAGE_PM040] = ev->pm040;
+    v[PAGE_PM100] = ev->pm100;
+    v[PAGE_VOC] = ev->vocidx;
+    v[PAGE_NOX] = ev->noxidx;
+    for (int p = 0; p < MAXDISPPAGES; p++) {
+      hists[p].v[hists[p].pos] = v[p];
+      hists[p].pos = (hists[p].pos + 1) % DP_HISTLEN;
+      if (hists[p].cnt < DP_HISTLEN) {
+        hists[p].cnt++;
+      }
+    }
+}
+
+void dp_gethist(int page, float * hist)
+{
+    if ((page < 0) || (page >= MAXDISPPAGES)) {
+      for (int i = 0; i < DP_HISTLEN; i++) {
+        hist[i] = NAN;
+      }
+      return;
+    }
+    int missing = DP_HISTLEN - hists[page].cnt;
+    int rp = (hists[page].pos + missing) % DP_HISTLEN; /* the oldest value */
+    for (int i = 0; i < DP_HISTLEN; i++) {
+      if (i < missing) {
+        hist[i] = NAN;
+      } else {
+        hist[i] = hists[page].v[rp];
+        rp = (rp + 1) % DP_HISTLEN;
+      }
+    }
+}
+
+/* Average of the valid values in hist[i1] to hist[i2]. */
+static float histavg(const float * hist, int i1, int i2)
+{
+    float sum = 0.0; int n = 0;
+    for (int i = i1; i <= i2; i++) {
+      if (!isnan(hist[i])) {
+        sum += hist[i];
+        n++;
+      }
+    }
+    return (n > 0) ? (sum / n) : NAN;
+}
+
+/* Draws sparkline and trend arrow below the value. The strip has the same
+ * place on every page, so when only the values change, the drivers only
+ * need to send the changed parts of it. It keeps away from the edges of
+ * the display as far as wearlevel.c may move the picture, as otherwise
+ * that could only move it away from them. */
+static void drawhiststrip(struct di_dispbuf * db, const struct dispsnap * snap)
+{
+    const struct histparams * hp = &histparams[snap->page];
+    int y1 = 52;
+    int y2 = (db->sizey >= 128) ? (y1 + 47) : (db->sizey - 1 - WL_MAXSHIFTY);
+    int asize = ((y2 - y1 + 1) > 15) ? 15 : ((y2 - y1 + 1) | 1);
+    if (asize > (y2 - y1 + 1)) asize -= 2;
+    int ax = db->sizex - WL_MAXSHIFTX - asize;
+    di_drawsparkline(db, WL_MAXSHIFTX, y1, ax - 3, y2, snap->hist, DP_HISTLEN,
+                     hp->minspan, 0xc0, 0xc0, 0xc0);
+    /* The trend: the last 5 values compared to the 5 from 10 minutes ago. */
+    float now = histavg(snap->hist, DP_HISTLEN - 5, DP_HISTLEN - 1);
+    float before = histavg(snap->hist, DP_HISTLEN - 15, DP_HISTLEN - 11);
+    if (isnan(now) || isnan(before)) {
+      return;
+    }
+    int dir = 0;
+    if ((now - before) > hp->trendthr) {
+      dir = 1;
+    } else if ((before - now) > hp->trendthr) {
+      dir = -1;
+    }
+    di_drawtrendarrow(db, ax, y1 + (((y2 - y1 + 1) - asize) / 2), asize, dir,
+                      0xff, 0xff, 0xff);
+}
+
+/* Draws a frame. This runs in the display task, not in the main loop. */
+void dp_drawframe(struct di_dispbuf * db, const void * snapv)
+{
+    const struct dispsnap * snap = snapv;
+    const struct ev * ev = &snap->ev;
+    /* First clear the whole display */
+    di_clear(db, 0x00, 0x00, 0x00);
+    if (snap->page == -100) {
+      di_drawtext(db, 0,  0, &font_terminus16bold, 0xff, 0xff, 0xff, "ERROR:");
+      di_drawtext(db, 0, 16, &font_terminus13norm, 0xff, 0xff, 0xff, "No sensors seem to");
+      di_drawtext(db, 0, 32, &font_terminus13norm, 0xff, 0xff, 0xff, "be enabled at all,");
+      di_drawtext(db, 0, 48, &font_terminus13norm, 0xff, 0xff, 0xff, "nothing to show.");
+    } else if (snap->page == -2) { /* The first startup message */
+      di_drawtext(db, 0,  0, &font_terminus13norm, 0xff, 0xff, 0xff, "Hi! I'm a display!");
+      di_drawtext(db, 0, 16, &font_terminus13norm, 0xff, 0xff, 0xff, "I will display mea-");
+      di_drawtext(db, 0, 32, &font_terminus13norm, 0xff, 0xff, 0xff, "surements as soon");
+      di_drawtext(db, 0, 48, &font_terminus13norm, 0xff, 0xff, 0xff, "as I have some.");
+    } else if (snap->page == -1) { /* Show Firmware Ver and IP */
+      di_drawtext(db, 0,  0, &font_terminus13norm, 0xff, 0xff, 0xff, "~~~ FoxESPTemp ~~~");
+      di_drawtext(db, 0, 13, &font_terminus13norm, 0xff, 0xff, 0xff, "Firmware compiled");
+      di_drawtext(db, 0, 26, &font_terminus13norm, 0xff, 0xff, 0xff, snap->fwdate);
+      if (snap->ip[0] != 0) {
+        di_drawtext(db, 0, 39, &font_terminus13norm, 0xff, 0xff, 0xff, snap->ip);
+      } else {
+        di_drawtext(db, 0, 39, &font_terminus13norm, 0xff, 0xff, 0xff, "No IPv4 address");
+      }
+      di_drawtext(db, 0, 52, &font_terminus13norm, 0xff, 0xff, 0xff, "ABCabc.,_!0123456789");
+    } else { /* page >= 0 - show values. */
+      uint8_t label[30]; uint8_t value[20]; uint8_t unit[20];
+      label[0] = 0; value[0] = 0; unit[0] = 0;
+      struct valuecolor vc = vcneutral;
+      if (snap->page == PAGE_TEMP) { /* Show temp */
+        strcpy(label, "Temperatur"); // we might want to translate this.
+        if (isnan(ev->temp)) {
+          strcpy(value, "-.--");
+        } else {
+          sprintf(value, "%.2f", ev->temp);
+        }
+        strcpy(unit, "\u00b0C");
+      } else if (snap->page == PAGE_HUM) { /* Show humidity */
+        strcpy(label, "Luftfeuchtigkeit");
+        if (isnan(ev->hum)) {
+          strcpy(value, "-.--");
+        } else {
+          sprintf(value, "%.2f", ev->hum);
+        }
+        strcpy(unit, "%");
+      } else if (snap->page == PAGE_PRESS) { /* Show pressure */
+        strcpy(label, "Luftdruck");
+        if (isnan(ev->press)) {
+          strcpy(value, "---.--");
+        } else {
+          sprintf(value, "%.2f", ev->press);
+        }
+        strcpy(unit, "hPa");
+      } else if (snap->page == PAGE_CO2) { /* Show CO2 */
+        strcpy(label, "CO\u00b2");
+        if (ev->co2 == 0xffff) { /* Invalid */
+          strcpy(value, "----");
+        } else {
+          sprintf(value, "%u", ev->co2);
+          vc = getvaluecolor(ev->co2, 1000.0, 1400.0);
+        }
+        strcpy(unit, "ppm");
+      } else if ((snap->page == PAGE_PM010)
+              || (snap->page == PAGE_PM025)
+              || (snap->page == PAGE_PM040)
+              || (snap->page == PAGE_PM100)) { /* Show particulate matter */
+        strcpy(label, "Feinstaub PM 1.0");
+        float fv = ev->pm010;
+        /* There are no limits for PM 1.0 and 4.0, use those of the next
+         * larger class. */
+        float lgood = 10.0; float lmedium = 25.0;
+        if (snap->page == PAGE_PM025) {
+          strcpy(label, "Feinstaub PM 2.5");
+          fv = ev->pm025;
+        } else if (snap->page == PAGE_PM040) {
+          strcpy(label, "Feinstaub PM 4.0");
+          fv = ev->pm040;
+          lgood = 20.0; lmedium = 50.0;
+        } else if (snap->page == PAGE_PM100) {
+          strcpy(label, "Feinstaub PM 10");
+          fv = ev->pm100;
+          lgood = 20.0; lmedium = 50.0;
+        }
+        vc = getvaluecolor(fv, lgood, lmedium);
+        if (isnan(fv)) {
+          strcpy(value, "--.-");
+        } else {
+          sprintf(value, "%.1f", fv);
+        }
+        strcpy(unit, "\u00b5g/m\u00b3");
+      } else if (snap->page == PAGE_VOC) { /* Show VOC index */
+        strcpy(label, "VOC-Index");
+        if (isnan(ev->vocidx)) {
+          strcpy(value, "---");
+        } else {
+          sprintf(value, "%.0f", ev->vocidx);
+          /* 100 is the average of the last hours, up to 150 is normal. */
+          vc = getvaluecolor(ev->vocidx, 150.0, 250.0);
+        }
+      } else if (snap->page == PAGE_NOX) { /* Show NOx index */
+        strcpy(label, "NOx-Index");
+        if (isnan(ev->noxidx)) {
+          strcpy(value, "---");
+        } else {
+          sprintf(value, "%.0f", ev->noxidx);
+          /* 1 is the usual, everything above means there's NOx. */
+          vc = getvaluecolor(ev->noxidx, 20.0, 150.0);
+        }
+      }
+      /* Center the label */
+      int xpos = di_calctextcenter(&font_terminus16bold, 0, db->sizex - 1, label);
+      di_drawtext(db, xpos, 0, &font_terminus16bold, 0xff, 0xff, 0xff, label);
+      /* With the values + unit, it's a bit more complicated, because they
+       * are using different font sizes. */
+      int vwi = di_textwidth(&font_terminus38bold, value)
+              + di_textwidth(&font_terminus16bold, unit);
+      xpos = ((int)db->sizex - vwi) / 2;
+      if (xpos < 0) { xpos = 0; }
+      di_drawtext(db, xpos, 20, &font_terminus38bold, vc.r, vc.g, vc.b, value);
+      xpos += di_textwidth(&font_terminus38bold, value);
+      di_drawtext(db, xpos, 20, &font_terminus16bold, 0xff, 0xff, 0xff, unit);
+      if (snap->page < MAXDISPPAGES) {
+        drawhiststrip(db, snap);
+      }
+    }
+}
@@ -0,0 +1,55 @@
+
+/* The pages shown on the display, and drawing them. */
+
+#ifndef _DISPLAYPAGES_H_
+#define _DISPLAYPAGES_H_
+
+#include <stdint.h>
+#include <time.h>
+#include "displays.h"
+#include "webserver.h"
+
+/* Pages with values. Pages < 0 are special: -1 shows firmware and IP,
+ * -2 the startup message, and -100 the error for "no sensors enabled". */
+#define PAGE_TEMP  0
+#define PAGE_HUM   1
+#define PAGE_PRESS 2
+#define PAGE_CO2   3
+#define PAGE_PM010 4
+#define PAGE_PM025 5
+#define PAGE_PM040 6
+#define PAGE_PM100 7
+#define PAGE_VOC   8
+#define PAGE_NOX   9
+#define MAXDISPPAGES 10
+
+/* How many values per page we keep for the sparkline. We get one value
+ * per measurement, so this is the last hour. */
+#define DP_HISTLEN 60
+
+/* Everything the display task needs to draw one frame. This is a copy,
+ * so the main loop can go on updating evs while the frame is drawn. */
+struct dispsnap {
+    int page;
+    struct ev ev;       /* the values to show */
+    uint8_t ip[20];     /* our IPv4 address as text, empty if we have none */
+    uint8_t fwdate[16]; /* date the firmware was compiled */
+    float hist[DP_HISTLEN]; /* history of the value on this page, oldest
+                             * first, NAN where we have none */
+};
+
+/* Draws a frame from a struct dispsnap. This is what the display task
+ * gets passed as drawfn. It does not touch any hardware, so it can also
+ * be used on the host, see tools/displaysim. */
+void dp_drawframe(struct di_dispbuf * db, const void * snapv);
+
+/* Adds a set of measured values to the history of every page. This and
+ * dp_gethist are not thread safe, both are meant to be called from the
+ * main loop. */
+void dp_addvalues(const struct ev * ev);
+
+/* Copies the history of a page into hist (DP_HISTLEN values, oldest
+ * first). Values not measured yet are NAN. */
+void dp_gethist(int page, float * hist);
+
+#endif /* _DISPLAYPAGES_H_ */
@@ -1,45 +1,52 @@
 
-/* display related functions - from initializing display hardware,
- * to drawing on images. */
+/* display related functions - drawing on images. Talking to the display
+ * hardware happens in displaytask.c and the display drivers. */
 
+#include <esp_heap_caps.h>
 #include <esp_log.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include "displays.h"
-#include "ssd130x.h"
-#include "sdkconfig.h"
-#include "settings.h"
 
 #define TAG "displays.c"
 
-/* Initialize the configured display (if any) */
-void di_init(void)
-{
-    /* For now this is all hardcoded because we only support exactly
-     * one type of display - FIXME */
-    ssd130x_init();
-}
-
 /* Initialize a new display buffer for drawing onto. */
-struct di_dispbuf * di_newdispbuf(void)
+struct di_dispbuf * di_newdispbuf(int sizex, int sizey, int bpp, int bandh)
 {
-    int sizex = 128; int sizey = 64;
+    if ((bpp != 16) || (bandh <= 0) || (bandh > sizey)) {
+      bandh = sizey;
+    }
     struct di_dispbuf * res;
     res = calloc(1, sizeof(struct di_dispbuf));
     if (res == NULL) {
       ESP_LOGE(TAG, "Failed to allocate memory for displaybuf (1). This will fail horribly.");
       return res;
     }
-    res->cont = calloc(1, (sizex * sizey * 1));
+    /* 1 bit per pixel, in pages of 8 rows, or 2 bytes per pixel. We
+     * allocate a multiple of 4 bytes so that di_invertall can work on
+     * whole words. Drivers may send this directly with DMA. */
+    if (bpp == 16) {
+      res->contsize = ((sizex * bandh * 2) + 3) & ~3;
+    } else {
+      res->contsize = ((sizex * ((sizey + 7) / 8)) + 3) & ~3;
+    }
+    res->cont = heap_caps_calloc(1, res->contsize, MALLOC_CAP_DMA);
     if (res->cont == NULL) {
       ESP_LOGE(TAG, "Failed to allocate memory for displaybuf (2). This will fail horribly.");
       free(res);
       return NULL;
     }
-    res->bpp = 1;
+    res->bpp = bpp;
     res->sizex = sizex;
     res->sizey = sizey;
+    res->bandy = 0;
+    res->bandh = bandh;
+    /* Nothing has been sent to the display yet, so everything is dirty. */
+    res->dirtyx1 = 0;
+    res->dirtyy1 = 0;
+    res->dirtyx2 = sizex - 1;
+    res->dirtyy2 = sizey - 1;
     return res;
 }
 
@@ -55,28 +62,68 @@ void di_freedispbuf(struct di_dispbuf * db)
     free(db);
 }
 
-/* send display buffer to the configured display (if any) */
-void di_display(struct di_dispbuf * db)
+void di_cleardirty(struct di_dispbuf * db)
+{
+    db->dirtyx1 = db->sizex;
+    db->dirtyy1 = db->sizey;
+    db->dirtyx2 = -1;
+    db->dirtyy2 = -1;
+}
+
+/* Extends the dirty region to include the given rectangle. Coordinates
+ * need to be sorted, and already clipped to the buffer. */
+static inline void di_markdirty(struct di_dispbuf * db, int x1, int y1, int x2, int y2)
+{
+    if (x1 < db->dirtyx1) db->dirtyx1 = x1;
+    if (y1 < db->dirtyy1) db->dirtyy1 = y1;
+    if (x2 > db->dirtyx2) db->dirtyx2 = x2;
+    if (y2 > db->dirtyy2) db->dirtyy2 = y2;
+}
+
+/* Converts a color to black (0) or white (1) */
+static inline uint8_t di_rgbtobw(uint8_t r, uint8_t g, uint8_t b)
 {
-    ssd130x_display(db);
+    return ((r | g | b) >= 0x80) ? 1 : 0;
+}
+
+/* Converts a color to what is stored in the buffer: black (0) or white (1)
+ * for 1 bpp, RGB565 in big endian byte order for 16 bpp. */
+static inline uint16_t di_rgbtopx(struct di_dispbuf * db, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (db->bpp == 1) {
+      return di_rgbtobw(r, g, b);
+    }
+    uint16_t c = ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+    return (c >> 8) | (c << 8);
+}
+
+/* Pointer to pixel x/y in a 16 bpp buffer. y needs to be inside the band. */
+static inline uint16_t * di_px16(struct di_dispbuf * db, int x, int y)
+{
+    return ((uint16_t *)db->cont) + ((y - db->bandy) * db->sizex) + x;
 }
 
 /* set a pixel */
 void di_setpixel(struct di_dispbuf * db, int x, int y, uint8_t r, uint8_t g, uint8_t b)
 {
-    if ((x < 0) || (y < 0)) return;
-    if ((x >= db->sizex) || (y >= db->sizey)) return;
-    if (db->bpp == 1) {
-      int offset = (y * db->sizex) + x;
-      uint8_t v = ((r >= 0x80) ? 0xff : 0x00)
-                | ((g >= 0x80) ? 0xff : 0x00)
-                | ((b >= 0x80) ? 0xff : 0x00);
-      db->cont[offset] = v;
-    } else if (db->bpp == 3) {
-      ESP_LOGW(TAG, "unimplemented pixel format - %u bpp is unsupported.", db->bpp);
+    x += db->originx;
+    y += db->originy;
+    if ((x < 0) || (y < db->bandy)) return;
+    if ((x >= db->sizex) || (y >= (db->bandy + db->bandh))) return;
+    if (db->bpp == 16) {
+      di_markdirty(db, x, y, x, y);
+      *di_px16(db, x, y) = di_rgbtopx(db, r, g, b);
+    } else if (db->bpp == 1) {
+      di_markdirty(db, x, y, x, y);
+      uint8_t * p = &db->cont[((y >> 3) * db->sizex) + x];
+      uint8_t m = 1U << (y & 7);
+      if (di_rgbtobw(r, g, b)) {
+        *p |= m;
+      } else {
+        *p &= ~m;
+      }
     } else {
-      /* Invalid pixel format. */
-      ESP_LOGW(TAG, "invalid pixel format - %u bpp is unsupported.", db->bpp);
+      ESP_LOGW(TAG, "unimplemented pixel format - %u bpp is unsupported.", db->bpp);
     }
 }
 
@@ -84,35 +131,32 @@ void di_setpixel(struct di_dispbuf * db, int x, int y, uint8_t r, uint8_t g, uin
 struct di_rgb di_getpixelrgb(struct di_dispbuf * db, int x, int y)
 {
     struct di_rgb res = { .r = 0, .g = 0, .b = 0 };
-    if ((x < 0) || (y < 0)) return res;
-    if ((x >= db->sizex) || (y >= db->sizey)) return res;
-    if (db->bpp == 1) {
-      int offset = (y * db->sizex) + x;
-      uint8_t v = db->cont[offset];
-      res.r = res.g = res.b = v;
-      return res;
-    } else if (db->bpp == 3) {
-      ESP_LOGW(TAG, "unimplemented pixel format - %u bpp is unsupported.", db->bpp);
-      return res;
-    } else {
-      /* Invalid pixel format. */
-      ESP_LOGW(TAG, "invalid pixel format - %u bpp is unsupported.", db->bpp);
+    if (db->bpp == 16) {
+      if ((x < 0) || (y < db->bandy)) return res;
+      if ((x >= db->sizex) || (y >= (db->bandy + db->bandh))) return res;
+      uint16_t c = *di_px16(db, x, y);
+      c = (c >> 8) | (c << 8);
+      res.r = ((c >> 8) & 0xf8) | (c >> 13);
+      res.g = ((c >> 3) & 0xfc) | ((c >> 9) & 0x03);
+      res.b = ((c << 3) & 0xf8) | ((c >> 2) & 0x07);
       return res;
     }
+    res.r = res.g = res.b = di_getpixelbw(db, x, y);
+    return res;
 }
 
 uint8_t di_getpixelbw(struct di_dispbuf * db, int x, int y)
 {
+    if (db->bpp == 16) {
+      struct di_rgb c = di_getpixelrgb(db, x, y);
+      return di_rgbtobw(c.r, c.g, c.b) ? 0xff : 0x00;
+    }
     if ((x < 0) || (y < 0)) return 0;
     if ((x >= db->sizex) || (y >= db->sizey)) return 0;
     if (db->bpp == 1) {
-      int offset = (y * db->sizex) + x;
-      return db->cont[offset];
-    } else if (db->bpp == 3) {
-      return 0;
+      uint8_t v = db->cont[((y >> 3) * db->sizex) + x];
+      return (v & (1U << (y & 7))) ? 0xff : 0x00;
     } else {
-      /* Invalid pixel format. */
-      ESP_LOGW(TAG, "invalid pixel format - %u bpp is unsupported.", db->bpp);
       return 0;
     }
 }
@@ -124,102 +168,301 @@ static void swapint(int * a, int * b)
     *b = tmp;
 }
 
+/* Fills a rectangle with px (see di_rgbtopx). Coordinates need to be
+ * sorted (x1 <= x2, y1 <= y2), but may be outside the buffer. For 1 bpp,
+ * this works on whole bytes, i.e. 8 pixels stacked vertically at a time. */
+static void di_fillrect(struct di_dispbuf * db, int x1, int y1, int x2, int y2,
+                        uint16_t px)
+{
+    if (x1 < 0) x1 = 0;
+    if (y1 < db->bandy) y1 = db->bandy;
+    if (x2 >= db->sizex) x2 = db->sizex - 1;
+    if (y2 >= (db->bandy + db->bandh)) y2 = db->bandy + db->bandh - 1;
+    if ((x1 > x2) || (y1 > y2)) return;
+    di_markdirty(db, x1, y1, x2, y2);
+    if (db->bpp == 16) {
+      uint16_t * row = di_px16(db, x1, y1);
+      for (int y = y1; y <= y2; y++, row += db->sizex) {
+        for (int i = 0; i <= (x2 - x1); i++) {
+          row[i] = px;
+        }
+      }
+      return;
+    }
+    uint8_t bw = px;
+    for (int page = (y1 >> 3); page <= (y2 >> 3); page++) {
+      /* which bits in this page are inside the rectangle? */
+      uint8_t m = 0xff;
+      if (page == (y1 >> 3)) m &= (0xff << (y1 & 7));
+      if (page == (y2 >> 3)) m &= (0xff >> (7 - (y2 & 7)));
+      uint8_t * p = &db->cont[(page * db->sizex) + x1];
+      uint8_t * pe = p + (x2 - x1) + 1;
+      if (m == 0xff) {
+        memset(p, (bw ? 0xff : 0x00), pe - p);
+      } else if (bw) {
+        for (; p < pe; p++) *p |= m;
+      } else {
+        m = ~m;
+        for (; p < pe; p++) *p &= m;
+      }
+    }
+}
+
 void di_drawrect(struct di_dispbuf * db, int x1, int y1, int x2, int y2,
                  int borderwidth, uint8_t r, uint8_t g, uint8_t b)
 {
+    x1 += db->originx; x2 += db->originx;
+    y1 += db->originy; y2 += db->originy;
     if (x1 > x2) { swapint(&x1, &x2); }
     if (y1 > y2) { swapint(&y1, &y2); }
-    if (borderwidth <= 0) { /* fully filled rect */
-      for (int y = y1; y <= y2; y++) {
-        for (int x = x1; x <= x2; x++) {
-          di_setpixel(db, x, y, r, g, b);
-        }
-      }
-    } else {
-      if ((borderwidth > (x2 - x1)) || (borderwidth > (y2 - y1))) {
-        /* borderwidth is larger than the distance between our borders, this
-         * will thus create a fully filled rectangle. If we tried to draw
-         * that with our algorithm below however we would overflow our borders.
-         * So instead call ourselves with a borderwidth of -1. */
-        di_drawrect(db, x1, y1, x2, y2, -1, r, g, b);
-        return;
-      }
-      for (int bd = 0; bd < borderwidth; bd++) {
-        for (int y = y1; y <= y2; y++) {
-          di_setpixel(db, x1 + bd, y, r, g, b);
-          di_setpixel(db, x2 - bd, y, r, g, b);
-        }
-        for (int x = x1; x <= x2; x++) {
-          di_setpixel(db, x, y1 + bd, r, g, b);
-          di_setpixel(db, x, y2 - bd, r, g, b);
-        }
-      }
+    if ((db->bpp != 1) && (db->bpp != 16)) {
+      ESP_LOGW(TAG, "unimplemented pixel format - %u bpp is unsupported.", db->bpp);
+      return;
+    }
+    uint16_t px = di_rgbtopx(db, r, g, b);
+    if ((borderwidth <= 0)
+     || (borderwidth > (x2 - x1)) || (borderwidth > (y2 - y1))) {
+      /* fully filled rect - also used if borderwidth is larger than the
+       * distance between our borders, which creates a filled rect too. */
+      di_fillrect(db, x1, y1, x2, y2, px);
+      return;
+    }
+    di_fillrect(db, x1, y1, x2, y1 + borderwidth - 1, px); /* top */
+    di_fillrect(db, x1, y2 - borderwidth + 1, x2, y2, px); /* bottom */
+    di_fillrect(db, x1, y1, x1 + borderwidth - 1, y2, px); /* left */
+    di_fillrect(db, x2 - borderwidth + 1, y1, x2, y2, px); /* right */
+}
+
+void di_clear(struct di_dispbuf * db, uint8_t r, uint8_t g, uint8_t b)
+{
+    if ((db->bpp != 1) && (db->bpp != 16)) {
+      ESP_LOGW(TAG, "unimplemented pixel format - %u bpp is unsupported.", db->bpp);
+      return;
     }
+    di_fillrect(db, 0, 0, db->sizex - 1, db->sizey - 1, di_rgbtopx(db, r, g, b));
 }
 
 void di_invertall(struct di_dispbuf * db)
 {
-    int numb = db->sizex * db->sizey * db->bpp;
-    uint8_t * p = db->cont;
-    for (int i = 0; i < numb; i++) {
-      *p ^= 0xff;
+    /* contsize is always a multiple of 4, and cont is word aligned. */
+    uint32_t * p = (uint32_t *)db->cont;
+    uint32_t * pe = (uint32_t *)(db->cont + db->contsize);
+    di_markdirty(db, 0, 0, db->sizex - 1, db->sizey - 1);
+    while (p < pe) {
+      *p ^= 0xffffffffU;
       p++;
     }
 }
 
-void di_drawchar(struct di_dispbuf * db,
-                 int x, int y, struct font * fo,
-                 uint8_t r, uint8_t g, uint8_t b,
-                 uint8_t c)
+/* Find the glyph for code point c, or NULL if the font does not have
+ * one. The ranges are sorted, so this is a binary search - after a quick
+ * look at the first range, which is ASCII and thus almost every char. */
+static const struct fontglyph * di_findglyph(const struct font * fo, uint32_t c)
 {
-    //ESP_LOGI(TAG, "Drawing '%c' from offset %u at %d/%d", c, fo->offsets[c], x, y);
-    if (fo->offsets[c] == 0) { /* This char is not in our font. */
-      return;
+    if ((c - fo->ranges[0].first) < fo->ranges[0].count) {
+      return &fo->glyphs[fo->ranges[0].glyph + (c - fo->ranges[0].first)];
     }
-    int bpc = 1;
-    if (fo->width > 16) {
-      bpc = 3;
-    } else if (fo->width > 8) {
-      bpc = 2;
-    }
-    const uint8_t * fdp = fo->data + (fo->height
-                                      * (fo->offsets[c] - 1)
-                                      * bpc);
-    for (int yo = 0; yo < fo->height; yo++) {
-      uint32_t rd = *fdp;
-      if (bpc >= 3) { /* 3 instead of 1 bytes per row */
-        fdp++;
-        rd = (rd << 8) | *fdp;
+    int lo = 1;
+    int hi = fo->nrranges - 1;
+    while (lo <= hi) {
+      int mid = (lo + hi) / 2;
+      const struct fontrange * fr = &fo->ranges[mid];
+      if (c < fr->first) {
+        hi = mid - 1;
+      } else if (c >= (fr->first + fr->count)) {
+        lo = mid + 1;
+      } else {
+        return &fo->glyphs[fr->glyph + (c - fr->first)];
       }
-      if (bpc >= 2) { /* 2 instead of 1 bytes per row */
-        fdp++;
-        rd = (rd << 8) | *fdp;
+    }
+    return NULL;
+}
+
+/* Glyphs are stored row by row, but our display buffer stores columns of
+ * 8 pixels per byte. So for drawing, glyphs are converted ("transposed")
+ * into one bitmask per column, with bit n being row n. These can then be
+ * shifted to the right vertical position and ORed into the buffer a whole
+ * byte at a time. As the same few glyphs (digits) are drawn over and over,
+ * we keep a small cache of transposed glyphs. Glyphs wider than GLYPHMAXW
+ * are transposed and drawn in slices of GLYPHMAXW columns. */
+#define GLYPHMAXW 24
+#define GLYPHMAXH 56  /* shifted by up to 7 it must still fit into 64 bits */
+#define GLYPHCACHESIZE 16
+struct glyphcacheentry {
+    const struct fontglyph * gl;
+    uint8_t slice;
+    uint64_t cols[GLYPHMAXW];
+};
+static struct glyphcacheentry glyphcache[GLYPHCACHESIZE];
+
+static const uint64_t * di_getglyphcols(const struct font * fo,
+                                        const struct fontglyph * gl, uint32_t c,
+                                        int slice)
+{
+    struct glyphcacheentry * ce = &glyphcache[(c + slice) % GLYPHCACHESIZE];
+    if ((ce->gl == gl) && (ce->slice == slice)) {
+      return ce->cols;
+    }
+    /* The bitmap is one continuous bitstream, rows are not byte aligned. */
+    const uint8_t * fdp = fo->data + gl->dataoff;
+    int xs = slice * GLYPHMAXW;
+    int ws = gl->w - xs;
+    if (ws > GLYPHMAXW) ws = GLYPHMAXW;
+    memset(ce->cols, 0, sizeof(ce->cols));
+    for (int yo = 0; yo < gl->h; yo++) {
+      uint64_t rowbit = 1ULL << yo;
+      uint32_t bitpos = (yo * gl->w) + xs;
+      for (int xo = 0; xo < ws; xo++, bitpos++) {
+        if (fdp[bitpos >> 3] & (0x80 >> (bitpos & 7))) {
+          ce->cols[xo] |= rowbit;
+        }
+      }
+    }
+    ce->gl = gl;
+    ce->slice = slice;
+    return ce->cols;
+}
+
+/* Draws transposed glyph columns, cols[0] being column cx and row y of
+ * the display, clipped to x1/y1 - x2/y2. */
+static void di_drawglyphcols(struct di_dispbuf * db, const uint64_t * cols,
+                             int cx, int y, int x1, int y1, int x2, int y2,
+                             uint8_t r, uint8_t g, uint8_t b)
+{
+    if (db->bpp == 16) {
+      /* Only visit the pixels that are set in each column. */
+      uint16_t px = di_rgbtopx(db, r, g, b);
+      uint64_t rowmask = (y2 - y1 >= 63) ? ~0ULL : ((2ULL << (y2 - y1)) - 1);
+      for (int xx = x1; xx <= x2; xx++) {
+        uint64_t v = (cols[xx - cx] >> (y1 - y)) & rowmask;
+        uint16_t * p = di_px16(db, xx, y1);
+        while (v != 0) {
+          p[__builtin_ctzll(v) * db->sizex] = px;
+          v &= v - 1;
+        }
       }
-      fdp++;
-      rd = rd >> ((bpc * 8) - fo->width); /* right-align the bitmask */
-      for (int xo = (fo->width - 1); xo >= 0; xo--) {
-        if (rd & 1) {
-          di_setpixel(db, x + xo, y + yo, r, g, b);
+      return;
+    }
+    uint8_t bw = di_rgbtobw(r, g, b);
+    /* Column masks are relative to the top of page p1, and cut off at the
+     * bottom of the buffer. */
+    int p1 = y1 >> 3;
+    int p2 = y2 >> 3;
+    int shift = y - (p1 << 3); /* may be negative if y < 0 */
+    uint64_t clipmask = (y2 - (p1 << 3) >= 63) ? ~0ULL : ((2ULL << (y2 - (p1 << 3))) - 1);
+    uint8_t * colp = &db->cont[(p1 * db->sizex) + x1];
+    for (int xx = x1; xx <= x2; xx++, colp++) {
+      uint64_t v = cols[xx - cx];
+      v = ((shift >= 0) ? (v << shift) : (v >> -shift)) & clipmask;
+      uint8_t * p = colp;
+      for (int page = p1; page <= p2; page++) {
+        uint8_t m = v & 0xff;
+        if (bw) {
+          *p |= m;
+        } else {
+          *p &= ~m;
         }
-        rd >>= 1;
+        v >>= 8;
+        p += db->sizex;
+      }
+    }
+}
+
+int di_drawchar(struct di_dispbuf * db,
+                int x, int y, const struct font * fo,
+                uint8_t r, uint8_t g, uint8_t b,
+                uint32_t c)
+{
+    const struct fontglyph * gl = di_findglyph(fo, c);
+    if (gl == NULL) { /* This char is not in our font. */
+      return 0;
+    }
+    if (((db->bpp != 1) && (db->bpp != 16))
+     || (gl->h > GLYPHMAXH)) {
+      ESP_LOGW(TAG, "di_drawchar: unsupported font size or pixel format.");
+      return gl->advance;
+    }
+    /* Only the ink box of the glyph needs drawing. */
+    x += gl->xoff + db->originx;
+    y += gl->yoff + db->originy;
+    /* Clip once for the whole glyph. */
+    int x1 = (x < 0) ? 0 : x;
+    int x2 = x + gl->w - 1;
+    if (x2 >= db->sizex) x2 = db->sizex - 1;
+    int y1 = (y < db->bandy) ? db->bandy : y;
+    int y2 = y + gl->h - 1;
+    if (y2 >= (db->bandy + db->bandh)) y2 = db->bandy + db->bandh - 1;
+    if ((x1 > x2) || (y1 > y2)) return gl->advance;
+    di_markdirty(db, x1, y1, x2, y2);
+    for (int slice = (x1 - x) / GLYPHMAXW; slice <= (x2 - x) / GLYPHMAXW; slice++) {
+      const uint64_t * cols = di_getglyphcols(fo, gl, c, slice);
+      int cx = x + (slice * GLYPHMAXW); /* where cols[0] goes */
+      int sx1 = (cx > x1) ? cx : x1;
+      int sx2 = ((cx + GLYPHMAXW - 1) < x2) ? (cx + GLYPHMAXW - 1) : x2;
+      di_drawglyphcols(db, cols, cx, y, sx1, y1, sx2, y2, r, g, b);
+    }
+    return gl->advance;
+}
+
+/* Decodes the UTF-8 character at *txt, and advances *txt past it.
+ * Bytes that are not part of a valid UTF-8 sequence are taken as
+ * ISO-8859-1 characters, so old Latin-1 strings still work. */
+static uint32_t di_utf8next(const uint8_t ** txt)
+{
+    const uint8_t * p = *txt;
+    uint32_t c = p[0];
+    int len = 0;
+    if (c < 0x80) {
+      *txt = p + 1;
+      return c;
+    } else if ((c >= 0xc2) && (c <= 0xdf)) {
+      len = 1; c &= 0x1f;
+    } else if ((c >= 0xe0) && (c <= 0xef)) {
+      len = 2; c &= 0x0f;
+    } else if ((c >= 0xf0) && (c <= 0xf4)) {
+      len = 3; c &= 0x07;
+    }
+    for (int i = 1; i <= len; i++) {
+      if ((p[i] & 0xc0) != 0x80) { /* also stops at the terminating 0 */
+        len = 0;
+        break;
       }
+      c = (c << 6) | (p[i] & 0x3f);
+    }
+    /* Overlong encodings, surrogates and anything above U+10FFFF */
+    if ((len == 2) && ((c < 0x800) || ((c >= 0xd800) && (c <= 0xdfff)))) len = 0;
+    if ((len == 3) && ((c < 0x10000) || (c > 0x10ffff))) len = 0;
+    if (len == 0) {
+      *txt = p + 1;
+      return p[0];
     }
+    *txt = p + 1 + len;
+    return c;
 }
 
 void di_drawtext(struct di_dispbuf * db,
-                 int x, int y, struct font * fo,
+                 int x, int y, const struct font * fo,
                  uint8_t r, uint8_t g, uint8_t b,
                  const uint8_t * txt)
 {
     while (*txt != 0) {
-      //ESP_LOGI(TAG, "Drawing character '%c' at %d/%d", *txt, x, y);
-      di_drawchar(db, x, y, fo, r, g, b, *txt);
-      txt++;
-      x += fo->width;
+      x += di_drawchar(db, x, y, fo, r, g, b, di_utf8next(&txt));
+    }
+}
+
+int di_textwidth(const struct font * fo, const uint8_t * txt)
+{
+    int res = 0;
+    while (*txt != 0) {
+      const struct fontglyph * gl = di_findglyph(fo, di_utf8next(&txt));
+      if (gl != NULL) {
+        res += gl->advance;
+      }
     }
+    return res;
 }
 
-int di_calctextcenter(struct font * fo, int x1, int x2, const uint8_t * txt)
+int di_calctextcenter(const struct font * fo, int x1, int x2, const uint8_t * txt)
 {
-    return x1 + ((x2 - x1 - ((int)strlen(txt) * (int)fo->width)) / 2);
+    return x1 + ((x2 - x1 - di_textwidth(fo, txt)) / 2);
 }
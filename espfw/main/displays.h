@@ -1,23 +1,49 @@
 
 /* display related functions - from initializing display hardware,
- * to drawing on images. */
+ * to drawing on images. The drawing functions (displays.c) do not depend
+ * on any display hardware, the display task and driver handling are in
+ * displaytask.c. */
 
 #ifndef _DISPLAYS_H_
 #define _DISPLAYS_H_
 
+#include <stddef.h>
 #include "fonts/font.h"
 
 /* This is a display buffer that holds all screen output, for
  * drawing onto it and later sending it to the display hardware
  * for displaying it.
- * Note that in the buffer we always use at least 1 byte per
- * pixel - even if we have a display that only has 1 bit.
+ * With 1 bpp, the buffer uses the same memory layout as SSD130x
+ * displays, so it can be sent to them as is: It is split into
+ * "pages" of 8 rows each. Each page has one byte per column, with
+ * the LSB being the topmost of the 8 rows. Pixel x/y is thus bit
+ * (y & 7) of byte ((y >> 3) * sizex + x).
+ * With 16 bpp (color), every pixel is a RGB565 value in big endian byte
+ * order, which is what SPI TFT controllers want, stored row by row.
+ * Color buffers may only hold a "band" of rows of the display, because
+ * a whole 240x320 display would need 150 KB. The display task then draws
+ * every frame once per band, and everything outside the band is clipped.
+ * Pixel x/y is at ((y - bandy) * sizex + x).
  */
 struct di_dispbuf {
-  uint16_t sizex;
+  uint16_t sizex; /* size of the display */
   uint16_t sizey;
-  uint8_t bpp; /* 1 (grayscale) or 3 (color) - only 1 currently implemented */
+  uint8_t bpp; /* 1 (black/white) or 16 (RGB565 color) */
+  uint16_t bandy; /* first row of the display that is in cont */
+  uint16_t bandh; /* number of rows in cont. Always sizey for 1 bpp. */
+  /* Added to the coordinates of everything that is drawn, to move the
+   * whole picture by a few pixels (see wearlevel.c). Usually 0. */
+  int8_t originx;
+  int8_t originy;
   uint8_t * cont;
+  size_t contsize; /* size of cont in bytes */
+  /* Bounding box of everything drawn since the last di_cleardirty.
+   * Empty if dirtyx2 < dirtyx1. Display drivers can use this to only
+   * look at (and send) the parts of the buffer that may have changed. */
+  int16_t dirtyx1;
+  int16_t dirtyy1;
+  int16_t dirtyx2;
+  int16_t dirtyy2;
 };
 
 /* RGB values in one struct */
@@ -27,11 +53,58 @@ struct di_rgb {
   uint8_t b;
 };
 
-/* Initialize the configured display (if any) */
+/* A display driver. There is one of these for every supported display
+ * type, di_init picks the one for the configured type. */
+struct di_driver {
+  uint8_t type;    /* enum di_displaytypes */
+  uint16_t sizex;  /* size of the display buffer this display wants */
+  uint16_t sizey;
+  uint8_t bpp;     /* 1 or 16, see struct di_dispbuf */
+  uint16_t bandh;  /* 16 bpp: draw in bands of this many rows, 0 for all */
+  uint8_t wearlevel; /* move the picture around to even out wear (OLEDs) */
+  /* Initialize the display. Returns 0 on success. */
+  int (* init)(void);
+  /* Show a display buffer. Drivers should only send what changed, and
+   * call di_cleardirty once they have sent it. When drawing in bands,
+   * this is called for every band, and a driver may replace db->cont
+   * with a buffer of the same size, e.g. to send the previous band with
+   * DMA while the next one is drawn. */
+  void (* display)(struct di_dispbuf * db);
+  /* Number of bytes not sent because they had not changed. May be NULL. */
+  uint32_t (* getbytessaved)(void);
+};
+
+/* Initialize the configured display (if any). Usually called through
+ * di_starttask instead. */
 void di_init(void);
 
-/* Initialize a new display buffer for drawing onto. */
-struct di_dispbuf * di_newdispbuf(void);
+/* Draws a frame from a snapshot of whatever is to be shown. */
+typedef void (* di_drawfn_t)(struct di_dispbuf * db, const void * snap);
+
+/* Starts the display task. It initializes the display, and then draws and
+ * sends every frame queued with di_queueframe, so that slow or missing
+ * display hardware cannot stall anyone else. drawfn is called from the
+ * display task, with a copy of the snapshot (snapsize bytes). */
+int di_starttask(di_drawfn_t drawfn, size_t snapsize);
+
+/* Queues a frame for the display task. snap is copied, so it may be
+ * changed right after this returns. This never blocks: If the previous
+ * frame has not been drawn yet, it is replaced by this one. */
+void di_queueframe(const void * snap);
+
+/* Statistics about the display task and the display drivers. */
+struct di_stats {
+  uint32_t framesshown;   /* frames drawn and sent to the display */
+  uint32_t framesdropped; /* frames replaced by a newer one before drawing */
+  uint32_t lastframeus;   /* how long drawing and sending the last one took */
+  uint32_t bytessaved;    /* bytes not sent because they had not changed */
+};
+void di_getstats(struct di_stats * st);
+
+/* Initialize a new display buffer for drawing onto. bpp is 1 or 16, and
+ * bandh the number of rows to hold for 16 bpp (0 for all). The display
+ * task allocates the buffer the configured display wants. */
+struct di_dispbuf * di_newdispbuf(int sizex, int sizey, int bpp, int bandh);
 
 /* Free a previously allocated display buffer */
 void di_freedispbuf(struct di_dispbuf * db);
@@ -39,6 +112,16 @@ void di_freedispbuf(struct di_dispbuf * db);
 /* send display buffer to the configured display (if any) */
 void di_display(struct di_dispbuf * db);
 
+/* Mark the whole buffer as unchanged. Called by display drivers after
+ * they have sent the buffer to the display. */
+void di_cleardirty(struct di_dispbuf * db);
+
+/* Drawing functions take coordinates relative to db->originx/originy,
+ * only di_getpixel* and di_clear work on the buffer as is. */
+
+/* Fill the whole buffer with one color. */
+void di_clear(struct di_dispbuf * db, uint8_t r, uint8_t g, uint8_t b);
+
 /* set a pixel */
 void di_setpixel(struct di_dispbuf * db, int x, int y, uint8_t r, uint8_t g, uint8_t b);
 
@@ -54,24 +137,33 @@ void di_drawrect(struct di_dispbuf * db, int x1, int y1, int x2, int y2,
 void di_invertall(struct di_dispbuf * db);
 
 /* Embedded fonts. */
-extern struct font font_terminus13norm;
-extern struct font font_terminus16bold;
-extern struct font font_terminus38bold;
-
-/* Text functions */
-void di_drawchar(struct di_dispbuf * db,
-                 int x, int y, struct font * fo,
-                 uint8_t r, uint8_t g, uint8_t b,
-                 uint8_t c);
+extern const struct font font_terminus13norm;
+extern const struct font font_terminus16bold;
+extern const struct font font_terminus38bold;
+
+/* Text functions. Characters are Unicode code points, texts are UTF-8.
+ * Bytes in texts that are not valid UTF-8 are taken as ISO-8859-1 (which
+ * maps 1:1 to the first 256 code points).
+ * x/y is the top left corner of the character cell. di_drawchar returns
+ * the advance of the character, i.e. where the next one needs to go.
+ * Characters that are not in the font are not drawn and have an advance
+ * of 0. */
+int di_drawchar(struct di_dispbuf * db,
+                int x, int y, const struct font * fo,
+                uint8_t r, uint8_t g, uint8_t b,
+                uint32_t c);
 
 void di_drawtext(struct di_dispbuf * db,
-                 int x, int y, struct font * fo,
+                 int x, int y, const struct font * fo,
                  uint8_t r, uint8_t g, uint8_t b,
                  const uint8_t * txt);
 
+/* Width of a text in pixels when drawn with di_drawtext. */
+int di_textwidth(const struct font * fo, const uint8_t * txt);
+
 /* Tiny helper to calculate the x position where a text needs to
  * be put to appear centered between x1 and x2. */
-int di_calctextcenter(struct font * fo, int x1, int x2, const uint8_t * txt);
+int di_calctextcenter(const struct font * fo, int x1, int x2, const uint8_t * txt);
 
 #endif /* _DISPLAYS_H_ */
 
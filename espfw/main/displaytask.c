@@ -0,0 +1,157 @@
+
+/* The display task, and picking the right display driver. */
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "displays.h"
+#include "epaper.h"
+#include "spitft.h"
+#include "ssd130x.h"
+#include "wearlevel.h"
+#include "sdkconfig.h"
+#include "settings.h"
+
+#define TAG "displaytask.c"
+
+/* All display drivers we have. */
+static const struct di_driver * const drivers[] = {
+    &ssd130x_driver_ssd1306,
+    &ssd130x_driver_ssd1309,
+    &epaper_driver_epd29v2,
+    &spitft_driver_ili9341,
+    &spitft_driver_st7789,
+};
+/* The driver for the configured display, NULL if there is none. */
+static const struct di_driver * curdriver = NULL;
+
+/* Initialize the configured display (if any) */
+void di_init(void)
+{
+    curdriver = NULL;
+    for (int i = 0; i < (sizeof(drivers) / sizeof(drivers[0])); i++) {
+      if (drivers[i]->type == settings.di_type) {
+        if (drivers[i]->init() == 0) {
+          curdriver = drivers[i];
+        } else {
+          ESP_LOGE(TAG, "Failed to initialize display of type %u.", settings.di_type);
+        }
+        return;
+      }
+    }
+}
+
+/* Initialize a new display buffer for the configured display. */
+static struct di_dispbuf * di_newdispbuffordisplay(void)
+{
+    if (curdriver == NULL) { /* no display, but draw anyways */
+      return di_newdispbuf(128, 64, 1, 64);
+    }
+    return di_newdispbuf(curdriver->sizex, curdriver->sizey,
+                         curdriver->bpp, curdriver->bandh);
+}
+
+/* send display buffer to the configured display (if any) */
+void di_display(struct di_dispbuf * db)
+{
+    if (curdriver != NULL) {
+      curdriver->display(db);
+    }
+}
+
+/* The display task. Frames are passed to it through a queue with room for
+ * exactly one snapshot, that gets overwritten if the task is still busy
+ * with the previous one - so frames are coalesced, and whoever queues
+ * them never has to wait. */
+static QueueHandle_t framequeue = NULL;
+static di_drawfn_t framedrawfn = NULL;
+static size_t framesnapsize = 0;
+static uint32_t framesshown = 0;
+static uint32_t framesdropped = 0;
+static uint32_t lastframeus = 0;
+
+static void di_task(void * pvParameters)
+{
+    di_init();
+    struct di_dispbuf * db = di_newdispbuffordisplay();
+    uint8_t * snap = malloc(framesnapsize);
+    if ((db == NULL) || (snap == NULL)) {
+      ESP_LOGE(TAG, "Failed to allocate memory for display task, there will be no display output.");
+      vTaskDelete(NULL);
+      return;
+    }
+    struct wearlevel * wl = NULL;
+    if ((curdriver != NULL) && curdriver->wearlevel && (db->bpp == 1)) {
+      wl = malloc(sizeof(struct wearlevel));
+      if ((wl == NULL) || (wl_init(wl, db->sizex, db->sizey) != 0)) {
+        ESP_LOGW(TAG, "Not enough memory for wear levelling, display will burn in faster.");
+        free(wl);
+        wl = NULL;
+      }
+    }
+    while (1) {
+      if (xQueueReceive(framequeue, snap, portMAX_DELAY) != pdTRUE) {
+        continue;
+      }
+      int64_t st = esp_timer_get_time();
+      if (wl != NULL) {
+        wl_drawframe(wl, db, framedrawfn, snap, st / 1000);
+        di_display(db);
+      } else {
+        /* Usually this is just one band, the whole display. */
+        int bandh = db->bandh;
+        for (int y = 0; y < db->sizey; y += bandh) {
+          db->bandy = y;
+          db->bandh = ((y + bandh) > db->sizey) ? (db->sizey - y) : bandh;
+          framedrawfn(db, snap);
+          di_display(db);
+        }
+        db->bandy = 0;
+        db->bandh = bandh;
+      }
+      lastframeus = esp_timer_get_time() - st;
+      framesshown++;
+    }
+}
+
+int di_starttask(di_drawfn_t drawfn, size_t snapsize)
+{
+    framedrawfn = drawfn;
+    framesnapsize = snapsize;
+    framequeue = xQueueCreate(1, snapsize);
+    if (framequeue == NULL) {
+      ESP_LOGE(TAG, "Failed to create frame queue for display task.");
+      return 1;
+    }
+    if (xTaskCreate(di_task, "display", 4096, NULL, 2, NULL) != pdPASS) {
+      ESP_LOGE(TAG, "Failed to start display task.");
+      return 1;
+    }
+    return 0;
+}
+
+void di_queueframe(const void * snap)
+{
+    if (framequeue == NULL) {
+      return;
+    }
+    if (uxQueueMessagesWaiting(framequeue) > 0) {
+      framesdropped++;
+    }
+    xQueueOverwrite(framequeue, snap);
+}
+
+void di_getstats(struct di_stats * st)
+{
+    st->framesshown = framesshown;
+    st->framesdropped = framesdropped;
+    st->lastframeus = lastframeus;
+    st->bytessaved = 0;
+    if ((curdriver != NULL) && (curdriver->getbytessaved != NULL)) {
+      st->bytessaved = curdriver->getbytessaved();
+    }
+}
@@ -0,0 +1,93 @@
+
+/* Small display widgets, drawn with the functions from displays.h. */
+
+#include <math.h>
+#include "diwidgets.h"
+
+void di_drawsparkline(struct di_dispbuf * db, int x1, int y1, int x2, int y2,
+                      const float * v, int nrv, float minspan,
+                      uint8_t r, uint8_t g, uint8_t b)
+{
+    float lo = NAN; float hi = NAN;
+    int ilo = -1; int ihi = -1;
+    for (int i = 0; i < nrv; i++) {
+      if (isnan(v[i])) continue;
+      if ((ilo < 0) || (v[i] < lo)) { lo = v[i]; ilo = i; }
+      if ((ihi < 0) || (v[i] > hi)) { hi = v[i]; ihi = i; }
+    }
+    if ((ilo < 0) || (nrv < 2) || (x2 <= x1) || (y2 <= y1)) {
+      return; /* nothing to draw */
+    }
+    float slo = lo; float shi = hi;
+    if ((shi - slo) < minspan) {
+      float mid = (slo + shi) / 2.0;
+      slo = mid - (minspan / 2.0);
+      shi = mid + (minspan / 2.0);
+    }
+    if (shi <= slo) { /* minspan 0 and all values the same */
+      shi = slo + 1.0;
+    }
+    /* Connect the values column by column. Every column gets the pixels
+     * from where the line left the previous column to where it is now, so
+     * there are no gaps in steep parts. */
+    int px = -1; int py = 0; int lasty = 0;
+    for (int i = 0; i < nrv; i++) {
+      if (isnan(v[i])) {
+        px = -1; /* gap in the data, gap in the line */
+        continue;
+      }
+      int x = x1 + ((i * (x2 - x1)) / (nrv - 1));
+      int y = y2 - (int)lroundf(((v[i] - slo) * (y2 - y1)) / (shi - slo));
+      if (px < 0) {
+        di_drawrect(db, x, y, x, y, -1, r, g, b);
+        lasty = y;
+      } else {
+        for (int cx = px + 1; cx <= x; cx++) {
+          int cy = py + (((y - py) * (cx - px)) / (x - px));
+          int ya = lasty;
+          if (cy > ya) ya++; else if (cy < ya) ya--;
+          di_drawrect(db, cx, ya, cx, cy, -1, r, g, b);
+          lasty = cy;
+        }
+      }
+      px = x; py = y;
+    }
+    /* Markers for minimum and maximum: 3x3 pixels, kept inside the box. */
+    int mi[2] = { ilo, ihi };
+    float mv[2] = { lo, hi };
+    for (int m = 0; m < 2; m++) {
+      int x = x1 + ((mi[m] * (x2 - x1)) / (nrv - 1));
+      int y = y2 - (int)lroundf(((mv[m] - slo) * (y2 - y1)) / (shi - slo));
+      if (x < (x1 + 1)) x = x1 + 1;
+      if (x > (x2 - 1)) x = x2 - 1;
+      if (y < (y1 + 1)) y = y1 + 1;
+      if (y > (y2 - 1)) y = y2 - 1;
+      di_drawrect(db, x - 1, y - 1, x + 1, y + 1, -1, r, g, b);
+    }
+}
+
+void di_drawtrendarrow(struct di_dispbuf * db, int x, int y, int size, int dir,
+                       uint8_t r, uint8_t g, uint8_t b)
+{
+    /* Just 1 pixel wide lines: the arrow is on every page, and this way
+     * it lights as few pixels as possible. */
+    int half = size / 2;
+    if (dir != 0) {
+      di_drawrect(db, x + half, y, x + half, y + size - 1, -1, r, g, b);
+    } else {
+      di_drawrect(db, x, y + half, x + size - 1, y + half, -1, r, g, b);
+    }
+    /* The head, two diagonal lines from the tip. */
+    for (int i = 1; i <= half; i++) {
+      if (dir > 0) {
+        di_setpixel(db, x + half - i, y + i, r, g, b);
+        di_setpixel(db, x + half + i, y + i, r, g, b);
+      } else if (dir < 0) {
+        di_setpixel(db, x + half - i, y + size - 1 - i, r, g, b);
+        di_setpixel(db, x + half + i, y + size - 1 - i, r, g, b);
+      } else {
+        di_setpixel(db, x + size - 1 - i, y + half - i, r, g, b);
+        di_setpixel(db, x + size - 1 - i, y + half + i, r, g, b);
+      }
+    }
+}
@@ -0,0 +1,23 @@
+
+/* Small display widgets, drawn with the functions from displays.h. */
+
+#ifndef _DIWIDGETS_H_
+#define _DIWIDGETS_H_
+
+#include "displays.h"
+
+/* Draws nrv values (oldest first, NAN for missing ones) as a sparkline
+ * into the box x1/y1 - x2/y2. The values are spread over the whole width
+ * of the box, and scaled to their minimum and maximum, but so that the
+ * box always covers at least minspan - otherwise noise would look like
+ * wild jumps. The smallest and largest value get a small marker. */
+void di_drawsparkline(struct di_dispbuf * db, int x1, int y1, int x2, int y2,
+                      const float * v, int nrv, float minspan,
+                      uint8_t r, uint8_t g, uint8_t b);
+
+/* Draws an arrow into the size x size box at x/y: pointing up for
+ * dir > 0, down for dir < 0, and right for dir == 0. */
+void di_drawtrendarrow(struct di_dispbuf * db, int x, int y, int size, int dir,
+                       uint8_t r, uint8_t g, uint8_t b);
+
+#endif /* _DIWIDGETS_H_ */
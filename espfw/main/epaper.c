@@ -0,0 +1,343 @@
+/* Talking to SPI e-paper displays with SSD1680 controller
+ * (e.g. Waveshare 2.9 inch e-paper module V2) */
+
+#include <driver/gpio.h>
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <string.h>
+#include "epaper.h"
+#include "epdsched.h"
+#include "settings.h"
+
+#define TAG "epaper.c"
+
+/* The panel in its native orientation: 128 pixels wide, 296 high. */
+#define EPD_SIZEX 128
+#define EPD_SIZEY 296
+#define EPD_LINEBYTES (EPD_SIZEX / 8)
+#define EPD_IMGSIZE (EPD_LINEBYTES * EPD_SIZEY)
+
+#define EPD_SPICLOCK (4 * 1000 * 1000) /* the SSD1680 can do 20 MHz */
+#define EPD_BUSYTIMEOUT_MS 5000 /* a full refresh takes about 3 seconds */
+
+static spi_device_handle_t epdspi;
+static gpio_num_t dcpin;
+static gpio_num_t rstpin;
+static gpio_num_t busypin;
+/* The image in the format of the panel: row by row, 8 pixels per byte,
+ * MSB is the leftmost pixel, and 0 is black. newimg is what we want to
+ * show, curimg what the panel shows. Both need to be DMA capable. */
+static uint8_t * newimg = NULL;
+static uint8_t * curimg = NULL;
+static int curimgvalid = 0;
+/* Is our partial refresh waveform loaded into the controller? A full
+ * refresh loads the default waveform from OTP, overwriting it. */
+static int partiallutloaded = 0;
+static struct epdsched sched;
+static uint32_t bytessaved = 0;
+
+/* Waveform ("LUT") for partial refreshes: It only drives pixels that
+ * change, and only for a short time, so there is no flashing. The
+ * format is that of the SSD1680 "Write LUT register" (0x32) command,
+ * 153 bytes, followed by the values for the end option (0x3F), gate
+ * voltage (0x03), source voltages (0x04) and VCOM (0x2C). This is the
+ * waveform the panel manufacturer uses in its example code. */
+static const uint8_t partiallut[159] = {
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00,
+    0x22, 0x17, 0x41, 0xB0, 0x32, 0x36,
+};
+
+/* Send bytes, with the DC pin telling the controller whether they are a
+ * command (0) or data (1). */
+static esp_err_t epaper_send(int dc, const uint8_t * buf, size_t len)
+{
+    if (len == 0) {
+      return ESP_OK;
+    }
+    gpio_set_level(dcpin, dc);
+    spi_transaction_t t;
+    memset(&t, 0, sizeof(t));
+    t.length = len * 8;
+    if (len <= 4) {
+      t.flags = SPI_TRANS_USE_TXDATA;
+      memcpy(t.tx_data, buf, len);
+    } else {
+      t.tx_buffer = buf;
+    }
+    return spi_device_polling_transmit(epdspi, &t);
+}
+
+/* Send a command followed by its parameters (if any) */
+static esp_err_t epaper_sendcmd(uint8_t cmd, const uint8_t * data, size_t len)
+{
+    esp_err_t res = epaper_send(0, &cmd, 1);
+    if (res == ESP_OK) {
+      res = epaper_send(1, data, len);
+    }
+    return res;
+}
+
+/* Shortcut for commands with 1 parameter */
+static esp_err_t epaper_sendcmd1(uint8_t cmd, uint8_t data)
+{
+    return epaper_sendcmd(cmd, &data, 1);
+}
+
+/* Wait until the controller is no longer busy. Returns 0 if it is not,
+ * 1 if it still was when we gave up. */
+static int epaper_waitbusy(void)
+{
+    int64_t st = esp_timer_get_time();
+    while (gpio_get_level(busypin) != 0) {
+      if ((esp_timer_get_time() - st) > (EPD_BUSYTIMEOUT_MS * 1000LL)) {
+        ESP_LOGE(TAG, "Timeout waiting for the display controller.");
+        return 1;
+      }
+      vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return 0;
+}
+
+/* Set the RAM window we write to, x in bytes (8 pixels), y in rows, and
+ * move the RAM address to its start. */
+static void epaper_setwindow(int bx1, int bx2, int y1, int y2)
+{
+    uint8_t xw[2] = { bx1, bx2 };
+    uint8_t yw[4] = { y1 & 0xff, y1 >> 8, y2 & 0xff, y2 >> 8 };
+    epaper_sendcmd(0x44, xw, 2);           /* RAM X start/end */
+    epaper_sendcmd(0x45, yw, 4);           /* RAM Y start/end */
+    epaper_sendcmd1(0x4E, bx1);            /* RAM X address counter */
+    epaper_sendcmd(0x4F, yw, 2);           /* RAM Y address counter */
+}
+
+/* Write a window of img into one of the controller RAMs: 0x24 is the
+ * image to show, 0x26 the image currently shown (which the controller
+ * compares against for partial refreshes). */
+static void epaper_writeram(uint8_t ram, const uint8_t * img,
+                            int bx1, int bx2, int y1, int y2)
+{
+    epaper_setwindow(bx1, bx2, y1, y2);
+    epaper_send(0, &ram, 1);
+    if ((bx1 == 0) && (bx2 == (EPD_LINEBYTES - 1))) {
+      /* Whole lines are in one piece in memory, send them in one go. */
+      epaper_send(1, &img[y1 * EPD_LINEBYTES], (y2 - y1 + 1) * EPD_LINEBYTES);
+    } else {
+      for (int y = y1; y <= y2; y++) {
+        epaper_send(1, &img[(y * EPD_LINEBYTES) + bx1], bx2 - bx1 + 1);
+      }
+    }
+}
+
+int epaper_init(void)
+{
+    if ((settings.di_spi_sck == 0) || (settings.di_spi_mosi == 0)
+     || (settings.di_spi_cs == 0) || (settings.di_spi_dc == 0)
+     || (settings.di_spi_rst == 0) || (settings.di_spi_busy == 0)) {
+      ESP_LOGW(TAG, "WARNING: e-paper display disabled because not all of its pins are configured.");
+      return 1;
+    }
+    dcpin = settings.di_spi_dc - 1;
+    rstpin = settings.di_spi_rst - 1;
+    busypin = settings.di_spi_busy - 1;
+    if (newimg == NULL) {
+      newimg = heap_caps_malloc(EPD_IMGSIZE, MALLOC_CAP_DMA);
+      curimg = heap_caps_malloc(EPD_IMGSIZE, MALLOC_CAP_DMA);
+      if ((newimg == NULL) || (curimg == NULL)) {
+        ESP_LOGE(TAG, "Failed to allocate memory for e-paper image.");
+        return 1;
+      }
+    }
+    gpio_reset_pin(dcpin);
+    gpio_set_direction(dcpin, GPIO_MODE_OUTPUT);
+    gpio_reset_pin(rstpin);
+    gpio_set_direction(rstpin, GPIO_MODE_OUTPUT);
+    gpio_reset_pin(busypin);
+    gpio_set_direction(busypin, GPIO_MODE_INPUT);
+    spi_bus_config_t bc = {
+      .mosi_io_num = settings.di_spi_mosi - 1,
+      .miso_io_num = -1,
+      .sclk_io_num = settings.di_spi_sck - 1,
+      .quadwp_io_num = -1,
+      .quadhd_io_num = -1,
+      .max_transfer_sz = EPD_IMGSIZE
+    };
+    if (spi_bus_initialize(SPI2_HOST, &bc, SPI_DMA_CH_AUTO) != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to initialize SPI bus for e-paper display.");
+      return 1;
+    }
+    spi_device_interface_config_t dc = {
+      .mode = 0,
+      .clock_speed_hz = EPD_SPICLOCK,
+      .spics_io_num = settings.di_spi_cs - 1,
+      .queue_size = 1
+    };
+    if (spi_bus_add_device(SPI2_HOST, &dc, &epdspi) != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to add e-paper display to SPI bus.");
+      return 1;
+    }
+    /* Hardware reset, then software reset */
+    gpio_set_level(rstpin, 1);
+    vTaskDelay(pdMS_TO_TICKS(10));
+    gpio_set_level(rstpin, 0);
+    vTaskDelay(pdMS_TO_TICKS(2));
+    gpio_set_level(rstpin, 1);
+    vTaskDelay(pdMS_TO_TICKS(10));
+    epaper_waitbusy();
+    epaper_sendcmd(0x12, NULL, 0);            /* SW reset */
+    if (epaper_waitbusy() != 0) {
+      ESP_LOGE(TAG, "E-paper display does not respond, is it connected?");
+      return 1;
+    }
+    uint8_t doc[3] = { (EPD_SIZEY - 1) & 0xff, (EPD_SIZEY - 1) >> 8, 0x00 };
+    epaper_sendcmd(0x01, doc, 3);             /* Driver output control: number of gates */
+    epaper_sendcmd1(0x11, 0x03);              /* Data entry mode: X and Y increment */
+    uint8_t duc[2] = { 0x00, 0x80 };
+    epaper_sendcmd(0x21, duc, 2);             /* Display update control */
+    epaper_sendcmd1(0x3C, 0x05);              /* Border waveform */
+    epaper_sendcmd1(0x18, 0x80);              /* Use the internal temperature sensor */
+    epaper_waitbusy();
+    curimgvalid = 0;
+    partiallutloaded = 0;
+    epdsched_init(&sched, EPD_MININTERVAL_MS, EPD_MINFULL_MS,
+                  EPD_MAXFULL_MS, EPD_MAXPARTIALS);
+    return 0;
+}
+
+/* Converts the rows y1 to y2 of the dispbuf into the panel format in
+ * newimg. Set pixels in the dispbuf become black. */
+static void epaper_convert(struct di_dispbuf * db, int y1, int y2)
+{
+    for (int y = y1; y <= y2; y++) {
+      const uint8_t * src = &db->cont[(y >> 3) * db->sizex];
+      int bit = y & 7;
+      uint8_t * dst = &newimg[y * EPD_LINEBYTES];
+      for (int bx = 0; bx < EPD_LINEBYTES; bx++) {
+        uint8_t v = 0;
+        for (int i = 0; i < 8; i++) {
+          v = (v << 1) | ((src[(bx << 3) + i] >> bit) & 1);
+        }
+        dst[bx] = ~v;
+      }
+    }
+}
+
+void epaper_display(struct di_dispbuf * db)
+{
+    if ((db->bpp != 1) || (db->sizex != EPD_SIZEX) || (db->sizey != EPD_SIZEY)) {
+      ESP_LOGE(TAG, "Display buffer format does not match the display.");
+      return;
+    }
+    /* Find out what actually changed, and how many pixels that is. */
+    int y1 = db->dirtyy1;
+    int y2 = db->dirtyy2;
+    if (!curimgvalid) {
+      y1 = 0;
+      y2 = EPD_SIZEY - 1;
+    }
+    uint32_t changedpx = 0;
+    int bx1 = EPD_LINEBYTES; int bx2 = -1; int cy1 = EPD_SIZEY; int cy2 = -1;
+    if (y2 >= y1) {
+      epaper_convert(db, y1, y2);
+      for (int y = y1; y <= y2; y++) {
+        for (int bx = 0; bx < EPD_LINEBYTES; bx++) {
+          uint8_t d = newimg[(y * EPD_LINEBYTES) + bx] ^ curimg[(y * EPD_LINEBYTES) + bx];
+          if (d != 0) {
+            changedpx += __builtin_popcount(d);
+            if (bx < bx1) bx1 = bx;
+            if (bx > bx2) bx2 = bx;
+            if (y < cy1) cy1 = y;
+            if (y > cy2) cy2 = y;
+          }
+        }
+      }
+    }
+    if (!curimgvalid) {
+      changedpx = EPD_SIZEX * EPD_SIZEY;
+    }
+    int64_t now = esp_timer_get_time() / 1000;
+    int rt = epdsched_decide(&sched, now, changedpx, EPD_SIZEX * EPD_SIZEY);
+    if (rt == EPD_RT_NONE) {
+      if (changedpx == 0) {
+        di_cleardirty(db);
+      } /* otherwise keep it dirty, so it gets shown with the next frame */
+      return;
+    }
+    int err = 0;
+    if (rt == EPD_RT_FULL) {
+      /* Make sure newimg is complete, not just the dirty rows. */
+      epaper_convert(db, 0, EPD_SIZEY - 1);
+      epaper_writeram(0x24, newimg, 0, EPD_LINEBYTES - 1, 0, EPD_SIZEY - 1);
+      epaper_writeram(0x26, newimg, 0, EPD_LINEBYTES - 1, 0, EPD_SIZEY - 1);
+      epaper_sendcmd1(0x3C, 0x05);            /* Border waveform for full refresh */
+      epaper_sendcmd1(0x22, 0xF7);            /* Full update, with waveform from OTP */
+      epaper_sendcmd(0x20, NULL, 0);          /* Go */
+      err = epaper_waitbusy();
+      partiallutloaded = 0;
+      memcpy(curimg, newimg, EPD_IMGSIZE);
+    } else { /* partial refresh of the changed window only */
+      if (!partiallutloaded) {
+        epaper_sendcmd(0x32, partiallut, 153); /* Waveform */
+        epaper_sendcmd1(0x3F, partiallut[153]);
+        epaper_sendcmd1(0x03, partiallut[154]); /* Gate voltage */
+        epaper_sendcmd(0x04, &partiallut[155], 3); /* Source voltages */
+        epaper_sendcmd1(0x2C, partiallut[158]); /* VCOM */
+        epaper_sendcmd1(0x3C, 0x80);          /* Border: keep as is */
+        partiallutloaded = 1;
+      }
+      epaper_writeram(0x24, newimg, bx1, bx2, cy1, cy2);
+      epaper_sendcmd1(0x22, 0xC0);            /* Enable clock and analog */
+      epaper_sendcmd(0x20, NULL, 0);
+      epaper_waitbusy();
+      epaper_sendcmd1(0x22, 0x0F);            /* Update with the loaded waveform (mode 2) */
+      epaper_sendcmd(0x20, NULL, 0);
+      err = epaper_waitbusy();
+      /* The "old" RAM needs to match the panel for the next partial refresh. */
+      epaper_writeram(0x26, newimg, bx1, bx2, cy1, cy2);
+      for (int y = cy1; y <= cy2; y++) {
+        memcpy(&curimg[(y * EPD_LINEBYTES) + bx1], &newimg[(y * EPD_LINEBYTES) + bx1],
+               bx2 - bx1 + 1);
+      }
+      bytessaved += (2 * EPD_IMGSIZE) - (2 * (bx2 - bx1 + 1) * (cy2 - cy1 + 1));
+    }
+    epdsched_done(&sched, now, rt);
+    di_cleardirty(db);
+    if (err != 0) {
+      /* We don't know what the panel shows now. */
+      curimgvalid = 0;
+      epdsched_forcefull(&sched);
+    } else {
+      curimgvalid = 1;
+    }
+}
+
+uint32_t epaper_getbytessaved(void)
+{
+    return bytessaved;
+}
+
+const struct di_driver epaper_driver_epd29v2 = {
+    .type = DI_DT_EPD29_V2, .sizex = EPD_SIZEX, .sizey = EPD_SIZEY, .bpp = 1,
+    .init = epaper_init, .display = epaper_display,
+    .getbytessaved = epaper_getbytessaved
+};
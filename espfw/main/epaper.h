@@ -0,0 +1,25 @@
+/* Talking to SPI e-paper displays with SSD1680 controller
+ * (e.g. Waveshare 2.9 inch e-paper module V2) */
+
+#ifndef _EPAPER_H_
+#define _EPAPER_H_
+
+#include "displays.h"
+
+/* The driver for displays.c. */
+extern const struct di_driver epaper_driver_epd29v2;
+
+/* Initialize the e-paper display. Returns 0 on success. */
+int epaper_init(void);
+
+/* Display a dispbuf on the e-paper display. Depending on what changed
+ * and when the last refresh happened, this does a partial refresh of the
+ * changed region, a full refresh, or (if the last refresh was too
+ * recent) nothing at all - in that case the changes stay marked as dirty
+ * in the dispbuf, and are shown with the next frame. */
+void epaper_display(struct di_dispbuf * db);
+
+/* Number of bytes not sent because they had not changed. */
+uint32_t epaper_getbytessaved(void);
+
+#endif /* _EPAPER_H_ */
@@ -0,0 +1,67 @@
+/* Deciding when and how to refresh e-paper displays. */
+
+#include "epdsched.h"
+
+void epdsched_init(struct epdsched * es, uint32_t minintervalms,
+                   uint32_t minfullms, uint32_t maxfullms,
+                   uint16_t maxpartials)
+{
+    es->minintervalms = minintervalms;
+    es->minfullms = minfullms;
+    es->maxfullms = maxfullms;
+    es->maxpartials = maxpartials;
+    es->lastrefreshms = -1;
+    es->lastfullms = -1;
+    es->partials = 0;
+    es->nrfull = 0;
+    es->nrpartial = 0;
+    es->nrdeferred = 0;
+}
+
+int epdsched_decide(struct epdsched * es, int64_t nowms,
+                    uint32_t changedpx, uint32_t totalpx)
+{
+    /* We have no idea what the panel shows before the first full refresh. */
+    if (es->lastfullms < 0) {
+      return EPD_RT_FULL;
+    }
+    if (changedpx == 0) {
+      return EPD_RT_NONE;
+    }
+    if ((nowms - es->lastrefreshms) < es->minintervalms) {
+      es->nrdeferred++;
+      return EPD_RT_NONE;
+    }
+    int64_t sincefull = nowms - es->lastfullms;
+    /* Ghosting builds up with every partial refresh, and the panel
+     * manufacturers want a full refresh every now and then anyway.
+     * Changing most of the panel looks better with a full refresh too. */
+    int wantfull = ((es->partials >= es->maxpartials)
+                 || (sincefull >= es->maxfullms)
+                 || (changedpx > (totalpx / 2)));
+    /* But full refreshes must not happen too often either. */
+    if (wantfull && (sincefull >= es->minfullms)) {
+      return EPD_RT_FULL;
+    }
+    return EPD_RT_PARTIAL;
+}
+
+void epdsched_done(struct epdsched * es, int64_t nowms, int rt)
+{
+    if (rt == EPD_RT_FULL) {
+      es->lastfullms = nowms;
+      es->partials = 0;
+      es->nrfull++;
+    } else if (rt == EPD_RT_PARTIAL) {
+      es->partials++;
+      es->nrpartial++;
+    } else {
+      return;
+    }
+    es->lastrefreshms = nowms;
+}
+
+void epdsched_forcefull(struct epdsched * es)
+{
+    es->lastfullms = -1;
+}
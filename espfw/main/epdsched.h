@@ -0,0 +1,60 @@
+/* Deciding when and how to refresh e-paper displays.
+ * E-paper panels must not be refreshed too often, and partial refreshes
+ * leave "ghosts" of previous content behind that only a full refresh
+ * removes. This keeps track of all that. It does not talk to any
+ * hardware (and does not use anything ESP specific), so the same logic
+ * can be run and checked on a normal PC. */
+
+#ifndef _EPDSCHED_H_
+#define _EPDSCHED_H_
+
+#include <inttypes.h>
+
+enum epd_refreshtypes {
+  EPD_RT_NONE = 0,    /* don't refresh now */
+  EPD_RT_PARTIAL = 1, /* partial refresh, with the fast waveform */
+  EPD_RT_FULL = 2,    /* full refresh, that flashes the whole panel */
+};
+
+/* The refresh limits the e-paper driver uses, here so that
+ * tools/displaysim simulates the same. A partial refresh takes about
+ * 0.5 s, a full one about 3 s and makes the whole panel flash. */
+#define EPD_MININTERVAL_MS 5000             /* between any two refreshes */
+#define EPD_MINFULL_MS (180 * 1000)         /* between two full refreshes */
+#define EPD_MAXFULL_MS (60 * 60 * 1000)     /* ... and at least once per hour */
+#define EPD_MAXPARTIALS 60
+
+struct epdsched {
+  /* Limits, set by epdsched_init */
+  uint32_t minintervalms;  /* minimum time between two refreshes */
+  uint32_t minfullms;      /* minimum time between two full refreshes */
+  uint32_t maxfullms;      /* maximum time between two full refreshes */
+  uint16_t maxpartials;    /* full refresh after this many partial ones */
+  /* State */
+  int64_t lastrefreshms;   /* time of the last refresh, -1 if none yet */
+  int64_t lastfullms;      /* time of the last full refresh, -1 if none yet */
+  uint16_t partials;       /* partial refreshes since the last full one */
+  /* Statistics */
+  uint32_t nrfull;
+  uint32_t nrpartial;
+  uint32_t nrdeferred;     /* changes not shown yet because it was too early */
+};
+
+void epdsched_init(struct epdsched * es, uint32_t minintervalms,
+                   uint32_t minfullms, uint32_t maxfullms,
+                   uint16_t maxpartials);
+
+/* Decides what to do with a new frame. nowms is the current time in
+ * milliseconds, changedpx the number of pixels that differ from what the
+ * panel currently shows, totalpx the number of pixels of the panel.
+ * Returns one of enum epd_refreshtypes. */
+int epdsched_decide(struct epdsched * es, int64_t nowms,
+                    uint32_t changedpx, uint32_t totalpx);
+
+/* Tell the scheduler that a refresh of type rt was done at nowms. */
+void epdsched_done(struct epdsched * es, int64_t nowms, int rt);
+
+/* Force a full refresh for the next frame, e.g. after an error. */
+void epdsched_forcefull(struct epdsched * es);
+
+#endif /* _EPDSCHED_H_ */
@@ -4,11 +4,35 @@
 
 #include <inttypes.h>
 
+/* Fonts are generated from BDF files by tools/compile-font.py. The BDF
+ * files are in this directory too, see the comment in that script. */
+
+/* One glyph. Its bitmap only covers the pixels that are actually set
+ * ("ink box"), w * h pixels row by row, MSB first, without padding
+ * between rows. */
+struct fontglyph {
+  uint16_t dataoff; /* where the bitmap starts in font.data */
+  uint8_t w;        /* size of the bitmap, 0 for empty glyphs (space) */
+  uint8_t h;
+  int8_t xoff;      /* position of the bitmap relative to */
+  int8_t yoff;      /* the top left corner of the character cell */
+  uint8_t advance;  /* how far to move right for the next character */
+};
+
+/* A range of consecutive code points with consecutive glyphs. */
+struct fontrange {
+  uint32_t first;   /* first (Unicode) code point in the range */
+  uint16_t count;
+  uint16_t glyph;   /* index into font.glyphs for code point first */
+};
+
 struct font {
   const uint8_t * data;
-  uint8_t width;
-  uint8_t height;
-  uint8_t offsets[256];
+  const struct fontglyph * glyphs;
+  const struct fontrange * ranges; /* sorted by code point */
+  uint16_t nrranges;
+  uint8_t width;  /* widest advance - for monospaced fonts that is all of them */
+  uint8_t height; /* line height */
 };
 
 #endif /* _FONT_H_ */
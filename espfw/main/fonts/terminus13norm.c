@@ -1,1763 +1,1100 @@
-/* Font definition: Terminus font in size 13 pixels.
- * width is 7 pixels. This uses 1 bytes
- * per character. Font weight was normal.
- * This was obviously generated by script from the TTF version
- * of the font (because it gets harder and harder to use the
- * original bitmap font).
- * The Terminus Font is licensed under the SIL Open Font License,
- * version 1.1.
+/* Font definition: terminus13norm, compiled from terminus13norm.bdf
+ * by tools/compile-font.py.
+ * Line height is 13 pixels, width is 7 pixels, 106 glyphs in 439 bytes.
+ * The Terminus Font is licensed under the SIL Open Font License, version 1.1.
  */
 
 #include "font.h"
 
-const uint8_t terminus13norm_data[] = {
-    /* Next character:   (space) (ord 32) at offset 1 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ! (ord 33) at offset 2 */
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: " (ord 34) at offset 3 */
-    0x00, //         
-    0x50, //  # #    
-    0x50, //  # #    
-    0x50, //  # #    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: # (ord 35) at offset 4 */
-    0x00, //         
-    0x00, //         
-    0x50, //  # #    
-    0x50, //  # #    
-    0xF8, // #####   
-    0x50, //  # #    
-    0x50, //  # #    
-    0xF8, // #####   
-    0x50, //  # #    
-    0x50, //  # #    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: $ (ord 36) at offset 5 */
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x70, //  ###    
-    0xA8, // # # #   
-    0xA0, // # #     
-    0x70, //  ###    
-    0x28, //   # #   
-    0xA8, // # # #   
-    0x70, //  ###    
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    /* Next character: % (ord 37) at offset 6 */
-    0x00, //         
-    0x00, //         
-    0x48, //  #  #   
-    0xA8, // # # #   
-    0x50, //  # #    
-    0x10, //    #    
-    0x20, //   #     
-    0x28, //   # #   
-    0x54, //  # # #  
-    0x48, //  #  #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: & (ord 38) at offset 7 */
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x50, //  # #    
-    0x50, //  # #    
-    0x20, //   #     
-    0x68, //  ## #   
-    0x90, // #  #    
-    0x90, // #  #    
-    0x68, //  ## #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ' (ord 39) at offset 8 */
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ( (ord 40) at offset 9 */
-    0x00, //         
-    0x00, //         
-    0x10, //    #    
-    0x20, //   #     
-    0x40, //  #      
-    0x40, //  #      
-    0x40, //  #      
-    0x40, //  #      
-    0x20, //   #     
-    0x10, //    #    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ) (ord 41) at offset 10 */
-    0x00, //         
-    0x00, //         
-    0x40, //  #      
-    0x20, //   #     
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x20, //   #     
-    0x40, //  #      
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: * (ord 42) at offset 11 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x50, //  # #    
-    0x20, //   #     
-    0xF8, // #####   
-    0x20, //   #     
-    0x50, //  # #    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: + (ord 43) at offset 12 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0xF8, // #####   
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: , (ord 44) at offset 13 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x40, //  #      
-    0x00, //         
-    0x00, //         
-    /* Next character: - (ord 45) at offset 14 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: . (ord 46) at offset 15 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: / (ord 47) at offset 16 */
-    0x00, //         
-    0x00, //         
-    0x08, //     #   
-    0x08, //     #   
-    0x10, //    #    
-    0x10, //    #    
-    0x20, //   #     
-    0x20, //   #     
-    0x40, //  #      
-    0x40, //  #      
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 0 (ord 48) at offset 17 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x98, // #  ##   
-    0xA8, // # # #   
-    0xC8, // ##  #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 1 (ord 49) at offset 18 */
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x60, //  ##     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 2 (ord 50) at offset 19 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x08, //     #   
-    0x10, //    #    
-    0x20, //   #     
-    0x40, //  #      
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 3 (ord 51) at offset 20 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x08, //     #   
-    0x30, //   ##    
-    0x08, //     #   
-    0x08, //     #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 4 (ord 52) at offset 21 */
-    0x00, //         
-    0x00, //         
-    0x08, //     #   
-    0x18, //    ##   
-    0x28, //   # #   
-    0x48, //  #  #   
-    0x88, // #   #   
-    0xF8, // #####   
-    0x08, //     #   
-    0x08, //     #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 5 (ord 53) at offset 22 */
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x80, // #       
-    0x80, // #       
-    0xF0, // ####    
-    0x08, //     #   
-    0x08, //     #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 6 (ord 54) at offset 23 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x80, // #       
-    0x80, // #       
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 7 (ord 55) at offset 24 */
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x08, //     #   
-    0x08, //     #   
-    0x10, //    #    
-    0x10, //    #    
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 8 (ord 56) at offset 25 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 9 (ord 57) at offset 26 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x08, //     #   
-    0x08, //     #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: : (ord 58) at offset 27 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ; (ord 59) at offset 28 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x40, //  #      
-    0x00, //         
-    0x00, //         
-    /* Next character: < (ord 60) at offset 29 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x08, //     #   
-    0x10, //    #    
-    0x20, //   #     
-    0x40, //  #      
-    0x20, //   #     
-    0x10, //    #    
-    0x08, //     #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: = (ord 61) at offset 30 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: > (ord 62) at offset 31 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x40, //  #      
-    0x20, //   #     
-    0x10, //    #    
-    0x08, //     #   
-    0x10, //    #    
-    0x20, //   #     
-    0x40, //  #      
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ? (ord 63) at offset 32 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x10, //    #    
-    0x20, //   #     
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: @ (ord 64) at offset 33 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x98, // #  ##   
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0x98, // #  ##   
-    0x80, // #       
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: A (ord 65) at offset 34 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF8, // #####   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: B (ord 66) at offset 35 */
-    0x00, //         
-    0x00, //         
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF0, // ####    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: C (ord 67) at offset 36 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: D (ord 68) at offset 37 */
-    0x00, //         
-    0x00, //         
-    0xE0, // ###     
-    0x90, // #  #    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x90, // #  #    
-    0xE0, // ###     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: E (ord 69) at offset 38 */
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x80, // #       
-    0x80, // #       
-    0xF0, // ####    
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: F (ord 70) at offset 39 */
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x80, // #       
-    0x80, // #       
-    0xF0, // ####    
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: G (ord 71) at offset 40 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x80, // #       
-    0x80, // #       
-    0xB8, // # ###   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: H (ord 72) at offset 41 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF8, // #####   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: I (ord 73) at offset 42 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: J (ord 74) at offset 43 */
-    0x00, //         
-    0x00, //         
-    0x38, //   ###   
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x90, // #  #    
-    0x90, // #  #    
-    0x60, //  ##     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: K (ord 75) at offset 44 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x90, // #  #    
-    0xA0, // # #     
-    0xC0, // ##      
-    0xC0, // ##      
-    0xA0, // # #     
-    0x90, // #  #    
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: L (ord 76) at offset 45 */
-    0x00, //         
-    0x00, //         
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: M (ord 77) at offset 46 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0xD8, // ## ##   
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: N (ord 78) at offset 47 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0xC8, // ##  #   
-    0xA8, // # # #   
-    0x98, // #  ##   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: O (ord 79) at offset 48 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: P (ord 80) at offset 49 */
-    0x00, //         
-    0x00, //         
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF0, // ####    
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Q (ord 81) at offset 50 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xA8, // # # #   
-    0x70, //  ###    
-    0x08, //     #   
-    0x00, //         
-    0x00, //         
-    /* Next character: R (ord 82) at offset 51 */
-    0x00, //         
-    0x00, //         
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF0, // ####    
-    0xA0, // # #     
-    0x90, // #  #    
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: S (ord 83) at offset 52 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x80, // #       
-    0x70, //  ###    
-    0x08, //     #   
-    0x08, //     #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: T (ord 84) at offset 53 */
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: U (ord 85) at offset 54 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: V (ord 86) at offset 55 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x50, //  # #    
-    0x50, //  # #    
-    0x50, //  # #    
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: W (ord 87) at offset 56 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0xD8, // ## ##   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: X (ord 88) at offset 57 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x50, //  # #    
-    0x20, //   #     
-    0x20, //   #     
-    0x50, //  # #    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Y (ord 89) at offset 58 */
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x50, //  # #    
-    0x50, //  # #    
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Z (ord 90) at offset 59 */
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x08, //     #   
-    0x10, //    #    
-    0x20, //   #     
-    0x40, //  #      
-    0x80, // #       
-    0x80, // #       
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: [ (ord 91) at offset 60 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x40, //  #      
-    0x40, //  #      
-    0x40, //  #      
-    0x40, //  #      
-    0x40, //  #      
-    0x40, //  #      
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: \\ (ord 92) at offset 61 */
-    0x00, //         
-    0x00, //         
-    0x40, //  #      
-    0x40, //  #      
-    0x20, //   #     
-    0x20, //   #     
-    0x10, //    #    
-    0x10, //    #    
-    0x08, //     #   
-    0x08, //     #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ] (ord 93) at offset 62 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ^ (ord 94) at offset 63 */
-    0x00, //         
-    0x20, //   #     
-    0x50, //  # #    
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: _ (ord 95) at offset 64 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    /* Next character: ` (ord 96) at offset 65 */
-    0x40, //  #      
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: a (ord 97) at offset 66 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x08, //     #   
-    0x78, //  ####   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: b (ord 98) at offset 67 */
-    0x00, //         
-    0x00, //         
-    0x80, // #       
-    0x80, // #       
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF0, // ####    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: c (ord 99) at offset 68 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x80, // #       
-    0x80, // #       
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: d (ord 100) at offset 69 */
-    0x00, //         
-    0x00, //         
-    0x08, //     #   
-    0x08, //     #   
-    0x78, //  ####   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: e (ord 101) at offset 70 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0xF8, // #####   
-    0x80, // #       
-    0x80, // #       
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: f (ord 102) at offset 71 */
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x20, //   #     
-    0x70, //  ###    
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: g (ord 103) at offset 72 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x78, //  ####   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x08, //     #   
-    0x70, //  ###    
-    0x00, //         
-    /* Next character: h (ord 104) at offset 73 */
-    0x00, //         
-    0x00, //         
-    0x80, // #       
-    0x80, // #       
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: i (ord 105) at offset 74 */
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x60, //  ##     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: j (ord 106) at offset 75 */
-    0x00, //         
-    0x08, //     #   
-    0x08, //     #   
-    0x00, //         
-    0x18, //    ##   
-    0x08, //     #   
-    0x08, //     #   
-    0x08, //     #   
-    0x08, //     #   
-    0x08, //     #   
-    0x48, //  #  #   
-    0x30, //   ##    
-    0x00, //         
-    /* Next character: k (ord 107) at offset 76 */
-    0x00, //         
-    0x00, //         
-    0x40, //  #      
-    0x40, //  #      
-    0x48, //  #  #   
-    0x50, //  # #    
-    0x60, //  ##     
-    0x60, //  ##     
-    0x50, //  # #    
-    0x48, //  #  #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: l (ord 108) at offset 77 */
-    0x00, //         
-    0x00, //         
-    0x60, //  ##     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: m (ord 109) at offset 78 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xF0, // ####    
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: n (ord 110) at offset 79 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: o (ord 111) at offset 80 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: p (ord 112) at offset 81 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xF0, // ####    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF0, // ####    
-    0x80, // #       
-    0x80, // #       
-    0x00, //         
-    /* Next character: q (ord 113) at offset 82 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x78, //  ####   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x08, //     #   
-    0x08, //     #   
-    0x00, //         
-    /* Next character: r (ord 114) at offset 83 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xB8, // # ###   
-    0xC0, // ##      
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x80, // #       
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: s (ord 115) at offset 84 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x78, //  ####   
-    0x80, // #       
-    0x70, //  ###    
-    0x08, //     #   
-    0x08, //     #   
-    0xF0, // ####    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: t (ord 116) at offset 85 */
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x70, //  ###    
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: u (ord 117) at offset 86 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: v (ord 118) at offset 87 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x50, //  # #    
-    0x50, //  # #    
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: w (ord 119) at offset 88 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0xA8, // # # #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: x (ord 120) at offset 89 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x50, //  # #    
-    0x20, //   #     
-    0x20, //   #     
-    0x50, //  # #    
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: y (ord 121) at offset 90 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x08, //     #   
-    0x70, //  ###    
-    0x00, //         
-    /* Next character: z (ord 122) at offset 91 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0x10, //    #    
-    0x20, //   #     
-    0x40, //  #      
-    0x80, // #       
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: { (ord 123) at offset 92 */
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x20, //   #     
-    0x20, //   #     
-    0x40, //  #      
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: | (ord 124) at offset 93 */
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: } (ord 125) at offset 94 */
-    0x00, //         
-    0x00, //         
-    0x60, //  ##     
-    0x10, //    #    
-    0x10, //    #    
-    0x08, //     #   
-    0x10, //    #    
-    0x10, //    #    
-    0x10, //    #    
-    0x60, //  ##     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ~ (ord 126) at offset 95 */
-    0x00, //         
-    0x48, //  #  #   
-    0xA8, // # # #   
-    0x90, // #  #    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ° (ord 186) at offset 96 */
-    0x00, //         
-    0x20, //   #     
-    0x50, //  # #    
-    0x20, //   #     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ² (ord 178) at offset 97 */
-    0x00, //         
-    0x30, //   ##    
-    0x48, //  #  #   
-    0x10, //    #    
-    0x20, //   #     
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ³ (ord 179) at offset 98 */
-    0x00, //         
-    0x70, //  ###    
-    0x08, //     #   
-    0x30, //   ##    
-    0x08, //     #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: µ (ord 181) at offset 99 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x98, // #  ##   
-    0xE8, // ### #   
-    0x80, // #       
-    0x80, // #       
-    0x00, //         
-    /* Next character: ± (ord 177) at offset 100 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x20, //   #     
-    0x20, //   #     
-    0xF8, // #####   
-    0x20, //   #     
-    0x20, //   #     
-    0x00, //         
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Ä (ord 196) at offset 101 */
-    0x50, //  # #    
-    0x50, //  # #    
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0xF8, // #####   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Ö (ord 214) at offset 102 */
-    0x50, //  # #    
-    0x50, //  # #    
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Ü (ord 220) at offset 103 */
-    0x50, //  # #    
-    0x50, //  # #    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ä (ord 228) at offset 104 */
-    0x00, //         
-    0x00, //         
-    0x50, //  # #    
-    0x50, //  # #    
-    0x70, //  ###    
-    0x08, //     #   
-    0x78, //  ####   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ö (ord 246) at offset 105 */
-    0x00, //         
-    0x00, //         
-    0x50, //  # #    
-    0x50, //  # #    
-    0x70, //  ###    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ü (ord 252) at offset 106 */
-    0x00, //         
-    0x00, //         
-    0x50, //  # #    
-    0x50, //  # #    
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x88, // #   #   
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
+static const uint8_t terminus13norm_data[] = {
+    /* U+0020 (space): 0x0 at 0/0 */
+    /* U+0021 !: 1x8 at 2/2 */
+    // #
+    // #
+    // #
+    // #
+    // #
+    // .
+    // #
+    // #
+    0xfb,
+    /* U+0022 ": 3x3 at 1/1 */
+    // #.#
+    // #.#
+    // #.#
+    0xb6, 0x80,
+    /* U+0023 #: 5x8 at 0/2 */
+    // .#.#.
+    // .#.#.
+    // #####
+    // .#.#.
+    // .#.#.
+    // #####
+    // .#.#.
+    // .#.#.
+    0x52, 0xbe, 0xa5, 0x7d, 0x4a,
+    /* U+0024 $: 5x9 at 0/2 */
+    // ..#..
+    // .###.
+    // #.#.#
+    // #.#..
+    // .###.
+    // ..#.#
+    // #.#.#
+    // .###.
+    // ..#..
+    0x23, 0xab, 0x47, 0x16, 0xae, 0x20,
+    /* U+0025 %: 6x8 at 0/2 */
+    // .#..#.
+    // #.#.#.
+    // .#.#..
+    // ...#..
+    // ..#...
+    // ..#.#.
+    // .#.#.#
+    // .#..#.
+    0x4a, 0xa5, 0x04, 0x20, 0xa5, 0x52,
+    /* U+0026 &: 5x8 at 0/2 */
+    // ..#..
+    // .#.#.
+    // .#.#.
+    // ..#..
+    // .##.#
+    // #..#.
+    // #..#.
+    // .##.#
+    0x22, 0x94, 0x46, 0xca, 0x4d,
+    /* U+0027 ': 1x3 at 2/1 */
+    // #
+    // #
+    // #
+    0xe0,
+    /* U+0028 (: 3x8 at 1/2 */
+    // ..#
+    // .#.
+    // #..
+    // #..
+    // #..
+    // #..
+    // .#.
+    // ..#
+    0x2a, 0x49, 0x11,
+    /* U+0029 ): 3x8 at 1/2 */
+    // #..
+    // .#.
+    // ..#
+    // ..#
+    // ..#
+    // ..#
+    // .#.
+    // #..
+    0x88, 0x92, 0x54,
+    /* U+002A *: 5x5 at 0/4 */
+    // .#.#.
+    // ..#..
+    // #####
+    // ..#..
+    // .#.#.
+    0x51, 0x3e, 0x45, 0x00,
+    /* U+002B +: 5x5 at 0/4 */
+    // ..#..
+    // ..#..
+    // #####
+    // ..#..
+    // ..#..
+    0x21, 0x3e, 0x42, 0x00,
+    /* U+002C ,: 2x3 at 1/8 */
+    // .#
+    // .#
+    // #.
+    0x58,
+    /* U+002D -: 5x1 at 0/6 */
+    // #####
+    0xf8,
+    /* U+002E .: 1x2 at 2/8 */
+    // #
+    // #
+    0xc0,
+    /* U+002F: 4x8 at 1/2 */
+    // ...#
+    // ...#
+    // ..#.
+    // ..#.
+    // .#..
+    // .#..
+    // #...
+    // #...
+    0x11, 0x22, 0x44, 0x88,
+    /* U+0030 0: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #..##
+    // #.#.#
+    // ##..#
+    // #...#
+    // #...#
+    // .###.
+    0x74, 0x67, 0x5c, 0xc6, 0x2e,
+    /* U+0031 1: 3x8 at 1/2 */
+    // .#.
+    // ##.
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // ###
+    0x59, 0x24, 0x97,
+    /* U+0032 2: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #...#
+    // ....#
+    // ...#.
+    // ..#..
+    // .#...
+    // #####
+    0x74, 0x62, 0x11, 0x11, 0x1f,
+    /* U+0033 3: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // ....#
+    // ..##.
+    // ....#
+    // ....#
+    // #...#
+    // .###.
+    0x74, 0x42, 0x60, 0x86, 0x2e,
+    /* U+0034 4: 5x8 at 0/2 */
+    // ....#
+    // ...##
+    // ..#.#
+    // .#..#
+    // #...#
+    // #####
+    // ....#
+    // ....#
+    0x08, 0xca, 0x98, 0xfc, 0x21,
+    /* U+0035 5: 5x8 at 0/2 */
+    // #####
+    // #....
+    // #....
+    // ####.
+    // ....#
+    // ....#
+    // #...#
+    // .###.
+    0xfc, 0x21, 0xe0, 0x86, 0x2e,
+    /* U+0036 6: 5x8 at 0/2 */
+    // .###.
+    // #....
+    // #....
+    // ####.
+    // #...#
+    // #...#
+    // #...#
+    // .###.
+    0x74, 0x21, 0xe8, 0xc6, 0x2e,
+    /* U+0037 7: 5x8 at 0/2 */
+    // #####
+    // ....#
+    // ....#
+    // ...#.
+    // ...#.
+    // ..#..
+    // ..#..
+    // ..#..
+    0xf8, 0x42, 0x21, 0x10, 0x84,
+    /* U+0038 8: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #...#
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // .###.
+    0x74, 0x62, 0xe8, 0xc6, 0x2e,
+    /* U+0039 9: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // .####
+    // ....#
+    // ....#
+    // .###.
+    0x74, 0x63, 0x17, 0x84, 0x2e,
+    /* U+003A :: 1x6 at 2/4 */
+    // #
+    // #
+    // .
+    // .
+    // #
+    // #
+    0xcc,
+    /* U+003B ;: 2x7 at 1/4 */
+    // .#
+    // .#
+    // ..
+    // ..
+    // .#
+    // .#
+    // #.
+    0x50, 0x58,
+    /* U+003C <: 4x7 at 1/3 */
+    // ...#
+    // ..#.
+    // .#..
+    // #...
+    // .#..
+    // ..#.
+    // ...#
+    0x12, 0x48, 0x42, 0x10,
+    /* U+003D =: 5x4 at 0/4 */
+    // #####
+    // .....
+    // .....
+    // #####
+    0xf8, 0x01, 0xf0,
+    /* U+003E >: 4x7 at 1/3 */
+    // #...
+    // .#..
+    // ..#.
+    // ...#
+    // ..#.
+    // .#..
+    // #...
+    0x84, 0x21, 0x24, 0x80,
+    /* U+003F ?: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #...#
+    // ...#.
+    // ..#..
+    // .....
+    // ..#..
+    // ..#..
+    0x74, 0x62, 0x22, 0x00, 0x84,
+    /* U+0040 @: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #..##
+    // #.#.#
+    // #.#.#
+    // #..##
+    // #....
+    // .####
+    0x74, 0x67, 0x5a, 0xce, 0x0f,
+    /* U+0041 A: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // #####
+    // #...#
+    // #...#
+    // #...#
+    0x74, 0x63, 0x1f, 0xc6, 0x31,
+    /* U+0042 B: 5x8 at 0/2 */
+    // ####.
+    // #...#
+    // #...#
+    // ####.
+    // #...#
+    // #...#
+    // #...#
+    // ####.
+    0xf4, 0x63, 0xe8, 0xc6, 0x3e,
+    /* U+0043 C: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #....
+    // #....
+    // #....
+    // #....
+    // #...#
+    // .###.
+    0x74, 0x61, 0x08, 0x42, 0x2e,
+    /* U+0044 D: 5x8 at 0/2 */
+    // ###..
+    // #..#.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #..#.
+    // ###..
+    0xe4, 0xa3, 0x18, 0xc6, 0x5c,
+    /* U+0045 E: 5x8 at 0/2 */
+    // #####
+    // #....
+    // #....
+    // ####.
+    // #....
+    // #....
+    // #....
+    // #####
+    0xfc, 0x21, 0xe8, 0x42, 0x1f,
+    /* U+0046 F: 5x8 at 0/2 */
+    // #####
+    // #....
+    // #....
+    // ####.
+    // #....
+    // #....
+    // #....
+    // #....
+    0xfc, 0x21, 0xe8, 0x42, 0x10,
+    /* U+0047 G: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #....
+    // #....
+    // #.###
+    // #...#
+    // #...#
+    // .###.
+    0x74, 0x61, 0x0b, 0xc6, 0x2e,
+    /* U+0048 H: 5x8 at 0/2 */
+    // #...#
+    // #...#
+    // #...#
+    // #####
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    0x8c, 0x63, 0xf8, 0xc6, 0x31,
+    /* U+0049 I: 3x8 at 1/2 */
+    // ###
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // ###
+    0xe9, 0x24, 0x97,
+    /* U+004A J: 5x8 at 0/2 */
+    // ..###
+    // ...#.
+    // ...#.
+    // ...#.
+    // ...#.
+    // #..#.
+    // #..#.
+    // .##..
+    0x38, 0x84, 0x21, 0x4a, 0x4c,
+    /* U+004B K: 5x8 at 0/2 */
+    // #...#
+    // #..#.
+    // #.#..
+    // ##...
+    // ##...
+    // #.#..
+    // #..#.
+    // #...#
+    0x8c, 0xa9, 0x8c, 0x52, 0x51,
+    /* U+004C L: 5x8 at 0/2 */
+    // #....
+    // #....
+    // #....
+    // #....
+    // #....
+    // #....
+    // #....
+    // #####
+    0x84, 0x21, 0x08, 0x42, 0x1f,
+    /* U+004D M: 5x8 at 0/2 */
+    // #...#
+    // ##.##
+    // #.#.#
+    // #.#.#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    0x8e, 0xeb, 0x58, 0xc6, 0x31,
+    /* U+004E N: 5x8 at 0/2 */
+    // #...#
+    // #...#
+    // ##..#
+    // #.#.#
+    // #..##
+    // #...#
+    // #...#
+    // #...#
+    0x8c, 0x73, 0x59, 0xc6, 0x31,
+    /* U+004F O: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .###.
+    0x74, 0x63, 0x18, 0xc6, 0x2e,
+    /* U+0050 P: 5x8 at 0/2 */
+    // ####.
+    // #...#
+    // #...#
+    // #...#
+    // ####.
+    // #....
+    // #....
+    // #....
+    0xf4, 0x63, 0x1f, 0x42, 0x10,
+    /* U+0051 Q: 5x9 at 0/2 */
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #.#.#
+    // .###.
+    // ....#
+    0x74, 0x63, 0x18, 0xc6, 0xae, 0x08,
+    /* U+0052 R: 5x8 at 0/2 */
+    // ####.
+    // #...#
+    // #...#
+    // #...#
+    // ####.
+    // #.#..
+    // #..#.
+    // #...#
+    0xf4, 0x63, 0x1f, 0x52, 0x51,
+    /* U+0053 S: 5x8 at 0/2 */
+    // .###.
+    // #...#
+    // #....
+    // .###.
+    // ....#
+    // ....#
+    // #...#
+    // .###.
+    0x74, 0x60, 0xe0, 0x86, 0x2e,
+    /* U+0054 T: 5x8 at 0/2 */
+    // #####
+    // ..#..
+    // ..#..
+    // ..#..
+    // ..#..
+    // ..#..
+    // ..#..
+    // ..#..
+    0xf9, 0x08, 0x42, 0x10, 0x84,
+    /* U+0055 U: 5x8 at 0/2 */
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .###.
+    0x8c, 0x63, 0x18, 0xc6, 0x2e,
+    /* U+0056 V: 5x8 at 0/2 */
+    // #...#
+    // #...#
+    // #...#
+    // .#.#.
+    // .#.#.
+    // .#.#.
+    // ..#..
+    // ..#..
+    0x8c, 0x62, 0xa5, 0x28, 0x84,
+    /* U+0057 W: 5x8 at 0/2 */
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #.#.#
+    // #.#.#
+    // ##.##
+    // #...#
+    0x8c, 0x63, 0x1a, 0xd7, 0x71,
+    /* U+0058 X: 5x8 at 0/2 */
+    // #...#
+    // #...#
+    // .#.#.
+    // ..#..
+    // ..#..
+    // .#.#.
+    // #...#
+    // #...#
+    0x8c, 0x54, 0x42, 0x2a, 0x31,
+    /* U+0059 Y: 5x8 at 0/2 */
+    // #...#
+    // #...#
+    // .#.#.
+    // .#.#.
+    // ..#..
+    // ..#..
+    // ..#..
+    // ..#..
+    0x8c, 0x54, 0xa2, 0x10, 0x84,
+    /* U+005A Z: 5x8 at 0/2 */
+    // #####
+    // ....#
+    // ...#.
+    // ..#..
+    // .#...
+    // #....
+    // #....
+    // #####
+    0xf8, 0x44, 0x44, 0x42, 0x1f,
+    /* U+005B [: 3x8 at 1/2 */
+    // ###
+    // #..
+    // #..
+    // #..
+    // #..
+    // #..
+    // #..
+    // ###
+    0xf2, 0x49, 0x27,
+    /* U+005C \: 4x8 at 1/2 */
+    // #...
+    // #...
+    // .#..
+    // .#..
+    // ..#.
+    // ..#.
+    // ...#
+    // ...#
+    0x88, 0x44, 0x22, 0x11,
+    /* U+005D ]: 3x8 at 1/2 */
+    // ###
+    // ..#
+    // ..#
+    // ..#
+    // ..#
+    // ..#
+    // ..#
+    // ###
+    0xe4, 0x92, 0x4f,
+    /* U+005E ^: 5x3 at 0/1 */
+    // ..#..
+    // .#.#.
+    // #...#
+    0x22, 0xa2,
+    /* U+005F _: 5x1 at 0/10 */
+    // #####
+    0xf8,
+    /* U+0060 `: 2x2 at 1/0 */
+    // #.
+    // .#
+    0x90,
+    /* U+0061 a: 5x6 at 0/4 */
+    // .###.
+    // ....#
+    // .####
+    // #...#
+    // #...#
+    // .####
+    0x70, 0x5f, 0x18, 0xbc,
+    /* U+0062 b: 5x8 at 0/2 */
+    // #....
+    // #....
+    // ####.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // ####.
+    0x84, 0x3d, 0x18, 0xc6, 0x3e,
+    /* U+0063 c: 5x6 at 0/4 */
+    // .###.
+    // #...#
+    // #....
+    // #....
+    // #...#
+    // .###.
+    0x74, 0x61, 0x08, 0xb8,
+    /* U+0064 d: 5x8 at 0/2 */
+    // ....#
+    // ....#
+    // .####
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .####
+    0x08, 0x5f, 0x18, 0xc6, 0x2f,
+    /* U+0065 e: 5x6 at 0/4 */
+    // .###.
+    // #...#
+    // #####
+    // #....
+    // #....
+    // .####
+    0x74, 0x7f, 0x08, 0x3c,
+    /* U+0066 f: 4x8 at 1/2 */
+    // ..##
+    // .#..
+    // ###.
+    // .#..
+    // .#..
+    // .#..
+    // .#..
+    // .#..
+    0x34, 0xe4, 0x44, 0x44,
+    /* U+0067 g: 5x8 at 0/4 */
+    // .####
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .####
+    // ....#
+    // .###.
+    0x7c, 0x63, 0x18, 0xbc, 0x2e,
+    /* U+0068 h: 5x8 at 0/2 */
+    // #....
+    // #....
+    // ####.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    0x84, 0x3d, 0x18, 0xc6, 0x31,
+    /* U+0069 i: 3x9 at 1/1 */
+    // .#.
+    // .#.
+    // ...
+    // ##.
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // ###
+    0x48, 0x64, 0x92, 0xe0,
+    /* U+006A j: 4x11 at 1/1 */
+    // ...#
+    // ...#
+    // ....
+    // ..##
+    // ...#
+    // ...#
+    // ...#
+    // ...#
+    // ...#
+    // #..#
+    // .##.
+    0x11, 0x03, 0x11, 0x11, 0x19, 0x60,
+    /* U+006B k: 4x8 at 1/2 */
+    // #...
+    // #...
+    // #..#
+    // #.#.
+    // ##..
+    // ##..
+    // #.#.
+    // #..#
+    0x88, 0x9a, 0xcc, 0xa9,
+    /* U+006C l: 3x8 at 1/2 */
+    // ##.
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // .#.
+    // ###
+    0xc9, 0x24, 0x97,
+    /* U+006D m: 5x6 at 0/4 */
+    // ####.
+    // #.#.#
+    // #.#.#
+    // #.#.#
+    // #.#.#
+    // #.#.#
+    0xf5, 0x6b, 0x5a, 0xd4,
+    /* U+006E n: 5x6 at 0/4 */
+    // ####.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    0xf4, 0x63, 0x18, 0xc4,
+    /* U+006F o: 5x6 at 0/4 */
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .###.
+    0x74, 0x63, 0x18, 0xb8,
+    /* U+0070 p: 5x8 at 0/4 */
+    // ####.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // ####.
+    // #....
+    // #....
+    0xf4, 0x63, 0x18, 0xfa, 0x10,
+    /* U+0071 q: 5x8 at 0/4 */
+    // .####
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .####
+    // ....#
+    // ....#
+    0x7c, 0x63, 0x18, 0xbc, 0x21,
+    /* U+0072 r: 5x6 at 0/4 */
+    // #.###
+    // ##...
+    // #....
+    // #....
+    // #....
+    // #....
+    0xbe, 0x21, 0x08, 0x40,
+    /* U+0073 s: 5x6 at 0/4 */
+    // .####
+    // #....
+    // .###.
+    // ....#
+    // ....#
+    // ####.
+    0x7c, 0x1c, 0x10, 0xf8,
+    /* U+0074 t: 4x8 at 1/2 */
+    // .#..
+    // .#..
+    // ###.
+    // .#..
+    // .#..
+    // .#..
+    // .#..
+    // ..##
+    0x44, 0xe4, 0x44, 0x43,
+    /* U+0075 u: 5x6 at 0/4 */
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .####
+    0x8c, 0x63, 0x18, 0xbc,
+    /* U+0076 v: 5x6 at 0/4 */
+    // #...#
+    // #...#
+    // .#.#.
+    // .#.#.
+    // ..#..
+    // ..#..
+    0x8c, 0x54, 0xa2, 0x10,
+    /* U+0077 w: 5x6 at 0/4 */
+    // #...#
+    // #...#
+    // #.#.#
+    // #.#.#
+    // #.#.#
+    // .###.
+    0x8c, 0x6b, 0x5a, 0xb8,
+    /* U+0078 x: 5x6 at 0/4 */
+    // #...#
+    // .#.#.
+    // ..#..
+    // ..#..
+    // .#.#.
+    // #...#
+    0x8a, 0x88, 0x45, 0x44,
+    /* U+0079 y: 5x8 at 0/4 */
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .####
+    // ....#
+    // .###.
+    0x8c, 0x63, 0x18, 0xbc, 0x2e,
+    /* U+007A z: 5x6 at 0/4 */
+    // #####
+    // ...#.
+    // ..#..
+    // .#...
+    // #....
+    // #####
+    0xf8, 0x88, 0x88, 0x7c,
+    /* U+007B {: 4x8 at 1/2 */
+    // ..##
+    // .#..
+    // .#..
+    // #...
+    // .#..
+    // .#..
+    // .#..
+    // ..##
+    0x34, 0x48, 0x44, 0x43,
+    /* U+007C |: 1x8 at 2/2 */
+    // #
+    // #
+    // #
+    // #
+    // #
+    // #
+    // #
+    // #
+    0xff,
+    /* U+007D }: 4x8 at 1/2 */
+    // ##..
+    // ..#.
+    // ..#.
+    // ...#
+    // ..#.
+    // ..#.
+    // ..#.
+    // ##..
+    0xc2, 0x21, 0x22, 0x2c,
+    /* U+007E ~: 5x3 at 0/1 */
+    // .#..#
+    // #.#.#
+    // #..#.
+    0x4d, 0x64,
+    /* U+00B0: 3x3 at 1/1 */
+    // .#.
+    // #.#
+    // .#.
+    0x55, 0x00,
+    /* U+00B1: 5x7 at 0/3 */
+    // ..#..
+    // ..#..
+    // #####
+    // ..#..
+    // ..#..
+    // .....
+    // #####
+    0x21, 0x3e, 0x42, 0x03, 0xe0,
+    /* U+00B2: 4x5 at 1/1 */
+    // .##.
+    // #..#
+    // ..#.
+    // .#..
+    // ####
+    0x69, 0x24, 0xf0,
+    /* U+00B3: 4x5 at 1/1 */
+    // ###.
+    // ...#
+    // .##.
+    // ...#
+    // ###.
+    0xe1, 0x61, 0xe0,
+    /* U+00B5: 5x8 at 0/4 */
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #..##
+    // ###.#
+    // #....
+    // #....
+    0x8c, 0x63, 0x19, 0xf6, 0x10,
+    /* U+00C4: 5x10 at 0/0 */
+    // .#.#.
+    // .#.#.
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // #####
+    // #...#
+    // #...#
+    // #...#
+    0x52, 0x9d, 0x18, 0xc7, 0xf1, 0x8c, 0x40,
+    /* U+00D6: 5x10 at 0/0 */
+    // .#.#.
+    // .#.#.
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .###.
+    0x52, 0x9d, 0x18, 0xc6, 0x31, 0x8b, 0x80,
+    /* U+00DC: 5x10 at 0/0 */
+    // .#.#.
+    // .#.#.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .###.
+    0x52, 0xa3, 0x18, 0xc6, 0x31, 0x8b, 0x80,
+    /* U+00E4: 5x8 at 0/2 */
+    // .#.#.
+    // .#.#.
+    // .###.
+    // ....#
+    // .####
+    // #...#
+    // #...#
+    // .####
+    0x52, 0x9c, 0x17, 0xc6, 0x2f,
+    /* U+00F6: 5x8 at 0/2 */
+    // .#.#.
+    // .#.#.
+    // .###.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .###.
+    0x52, 0x9d, 0x18, 0xc6, 0x2e,
+    /* U+00FC: 5x8 at 0/2 */
+    // .#.#.
+    // .#.#.
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // #...#
+    // .####
+    0x52, 0xa3, 0x18, 0xc6, 0x2f,
+};
+
+static const struct fontglyph terminus13norm_glyphs[] = {
+    { .dataoff =     0, .w =  0, .h =  0, .xoff =  0, .yoff =  0, .advance =  7 }, /* U+0020 */
+    { .dataoff =     0, .w =  1, .h =  8, .xoff =  2, .yoff =  2, .advance =  7 }, /* U+0021 */
+    { .dataoff =     1, .w =  3, .h =  3, .xoff =  1, .yoff =  1, .advance =  7 }, /* U+0022 */
+    { .dataoff =     3, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0023 */
+    { .dataoff =     8, .w =  5, .h =  9, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0024 */
+    { .dataoff =    14, .w =  6, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0025 */
+    { .dataoff =    20, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0026 */
+    { .dataoff =    25, .w =  1, .h =  3, .xoff =  2, .yoff =  1, .advance =  7 }, /* U+0027 */
+    { .dataoff =    26, .w =  3, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+0028 */
+    { .dataoff =    29, .w =  3, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+0029 */
+    { .dataoff =    32, .w =  5, .h =  5, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+002A */
+    { .dataoff =    36, .w =  5, .h =  5, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+002B */
+    { .dataoff =    40, .w =  2, .h =  3, .xoff =  1, .yoff =  8, .advance =  7 }, /* U+002C */
+    { .dataoff =    41, .w =  5, .h =  1, .xoff =  0, .yoff =  6, .advance =  7 }, /* U+002D */
+    { .dataoff =    42, .w =  1, .h =  2, .xoff =  2, .yoff =  8, .advance =  7 }, /* U+002E */
+    { .dataoff =    43, .w =  4, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+002F */
+    { .dataoff =    47, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0030 */
+    { .dataoff =    52, .w =  3, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+0031 */
+    { .dataoff =    55, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0032 */
+    { .dataoff =    60, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0033 */
+    { .dataoff =    65, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0034 */
+    { .dataoff =    70, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0035 */
+    { .dataoff =    75, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0036 */
+    { .dataoff =    80, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0037 */
+    { .dataoff =    85, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0038 */
+    { .dataoff =    90, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0039 */
+    { .dataoff =    95, .w =  1, .h =  6, .xoff =  2, .yoff =  4, .advance =  7 }, /* U+003A */
+    { .dataoff =    96, .w =  2, .h =  7, .xoff =  1, .yoff =  4, .advance =  7 }, /* U+003B */
+    { .dataoff =    98, .w =  4, .h =  7, .xoff =  1, .yoff =  3, .advance =  7 }, /* U+003C */
+    { .dataoff =   102, .w =  5, .h =  4, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+003D */
+    { .dataoff =   105, .w =  4, .h =  7, .xoff =  1, .yoff =  3, .advance =  7 }, /* U+003E */
+    { .dataoff =   109, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+003F */
+    { .dataoff =   114, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0040 */
+    { .dataoff =   119, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0041 */
+    { .dataoff =   124, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0042 */
+    { .dataoff =   129, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0043 */
+    { .dataoff =   134, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0044 */
+    { .dataoff =   139, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0045 */
+    { .dataoff =   144, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0046 */
+    { .dataoff =   149, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0047 */
+    { .dataoff =   154, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0048 */
+    { .dataoff =   159, .w =  3, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+0049 */
+    { .dataoff =   162, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+004A */
+    { .dataoff =   167, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+004B */
+    { .dataoff =   172, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+004C */
+    { .dataoff =   177, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+004D */
+    { .dataoff =   182, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+004E */
+    { .dataoff =   187, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+004F */
+    { .dataoff =   192, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0050 */
+    { .dataoff =   197, .w =  5, .h =  9, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0051 */
+    { .dataoff =   203, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0052 */
+    { .dataoff =   208, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0053 */
+    { .dataoff =   213, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0054 */
+    { .dataoff =   218, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0055 */
+    { .dataoff =   223, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0056 */
+    { .dataoff =   228, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0057 */
+    { .dataoff =   233, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0058 */
+    { .dataoff =   238, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0059 */
+    { .dataoff =   243, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+005A */
+    { .dataoff =   248, .w =  3, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+005B */
+    { .dataoff =   251, .w =  4, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+005C */
+    { .dataoff =   255, .w =  3, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+005D */
+    { .dataoff =   258, .w =  5, .h =  3, .xoff =  0, .yoff =  1, .advance =  7 }, /* U+005E */
+    { .dataoff =   260, .w =  5, .h =  1, .xoff =  0, .yoff = 10, .advance =  7 }, /* U+005F */
+    { .dataoff =   261, .w =  2, .h =  2, .xoff =  1, .yoff =  0, .advance =  7 }, /* U+0060 */
+    { .dataoff =   262, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0061 */
+    { .dataoff =   266, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0062 */
+    { .dataoff =   271, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0063 */
+    { .dataoff =   275, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0064 */
+    { .dataoff =   280, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0065 */
+    { .dataoff =   284, .w =  4, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+0066 */
+    { .dataoff =   288, .w =  5, .h =  8, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0067 */
+    { .dataoff =   293, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+0068 */
+    { .dataoff =   298, .w =  3, .h =  9, .xoff =  1, .yoff =  1, .advance =  7 }, /* U+0069 */
+    { .dataoff =   302, .w =  4, .h = 11, .xoff =  1, .yoff =  1, .advance =  7 }, /* U+006A */
+    { .dataoff =   308, .w =  4, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+006B */
+    { .dataoff =   312, .w =  3, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+006C */
+    { .dataoff =   315, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+006D */
+    { .dataoff =   319, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+006E */
+    { .dataoff =   323, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+006F */
+    { .dataoff =   327, .w =  5, .h =  8, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0070 */
+    { .dataoff =   332, .w =  5, .h =  8, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0071 */
+    { .dataoff =   337, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0072 */
+    { .dataoff =   341, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0073 */
+    { .dataoff =   345, .w =  4, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+0074 */
+    { .dataoff =   349, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0075 */
+    { .dataoff =   353, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0076 */
+    { .dataoff =   357, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0077 */
+    { .dataoff =   361, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0078 */
+    { .dataoff =   365, .w =  5, .h =  8, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+0079 */
+    { .dataoff =   370, .w =  5, .h =  6, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+007A */
+    { .dataoff =   374, .w =  4, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+007B */
+    { .dataoff =   378, .w =  1, .h =  8, .xoff =  2, .yoff =  2, .advance =  7 }, /* U+007C */
+    { .dataoff =   379, .w =  4, .h =  8, .xoff =  1, .yoff =  2, .advance =  7 }, /* U+007D */
+    { .dataoff =   383, .w =  5, .h =  3, .xoff =  0, .yoff =  1, .advance =  7 }, /* U+007E */
+    { .dataoff =   385, .w =  3, .h =  3, .xoff =  1, .yoff =  1, .advance =  7 }, /* U+00B0 */
+    { .dataoff =   387, .w =  5, .h =  7, .xoff =  0, .yoff =  3, .advance =  7 }, /* U+00B1 */
+    { .dataoff =   392, .w =  4, .h =  5, .xoff =  1, .yoff =  1, .advance =  7 }, /* U+00B2 */
+    { .dataoff =   395, .w =  4, .h =  5, .xoff =  1, .yoff =  1, .advance =  7 }, /* U+00B3 */
+    { .dataoff =   398, .w =  5, .h =  8, .xoff =  0, .yoff =  4, .advance =  7 }, /* U+00B5 */
+    { .dataoff =   403, .w =  5, .h = 10, .xoff =  0, .yoff =  0, .advance =  7 }, /* U+00C4 */
+    { .dataoff =   410, .w =  5, .h = 10, .xoff =  0, .yoff =  0, .advance =  7 }, /* U+00D6 */
+    { .dataoff =   417, .w =  5, .h = 10, .xoff =  0, .yoff =  0, .advance =  7 }, /* U+00DC */
+    { .dataoff =   424, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+00E4 */
+    { .dataoff =   429, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+00F6 */
+    { .dataoff =   434, .w =  5, .h =  8, .xoff =  0, .yoff =  2, .advance =  7 }, /* U+00FC */
+};
+
+static const struct fontrange terminus13norm_ranges[] = {
+    { .first = 0x0020, .count =  95, .glyph =   0 },
+    { .first = 0x00b0, .count =   4, .glyph =  95 },
+    { .first = 0x00b5, .count =   1, .glyph =  99 },
+    { .first = 0x00c4, .count =   1, .glyph = 100 },
+    { .first = 0x00d6, .count =   1, .glyph = 101 },
+    { .first = 0x00dc, .count =   1, .glyph = 102 },
+    { .first = 0x00e4, .count =   1, .glyph = 103 },
+    { .first = 0x00f6, .count =   1, .glyph = 104 },
+    { .first = 0x00fc, .count =   1, .glyph = 105 },
 };
 
 const struct font font_terminus13norm = {
-    .data   = terminus13norm_data,
-    .width  = 7,  /* Width */
-    .height = 13, /* Height */
-    .offsets = { /* Offsets to individual characters */
-          0, //   0
-          0, //   1
-          0, //   2
-          0, //   3
-          0, //   4
-          0, //   5
-          0, //   6
-          0, //   7
-          0, //   8
-          0, //   9
-          0, //  10
-          0, //  11
-          0, //  12
-          0, //  13
-          0, //  14
-          0, //  15
-          0, //  16
-          0, //  17
-          0, //  18
-          0, //  19
-          0, //  20
-          0, //  21
-          0, //  22
-          0, //  23
-          0, //  24
-          0, //  25
-          0, //  26
-          0, //  27
-          0, //  28
-          0, //  29
-          0, //  30
-          0, //  31
-          1, //  32
-          2, //  33
-          3, //  34
-          4, //  35
-          5, //  36
-          6, //  37
-          7, //  38
-          8, //  39
-          9, //  40
-         10, //  41
-         11, //  42
-         12, //  43
-         13, //  44
-         14, //  45
-         15, //  46
-         16, //  47
-         17, //  48
-         18, //  49
-         19, //  50
-         20, //  51
-         21, //  52
-         22, //  53
-         23, //  54
-         24, //  55
-         25, //  56
-         26, //  57
-         27, //  58
-         28, //  59
-         29, //  60
-         30, //  61
-         31, //  62
-         32, //  63
-         33, //  64
-         34, //  65
-         35, //  66
-         36, //  67
-         37, //  68
-         38, //  69
-         39, //  70
-         40, //  71
-         41, //  72
-         42, //  73
-         43, //  74
-         44, //  75
-         45, //  76
-         46, //  77
-         47, //  78
-         48, //  79
-         49, //  80
-         50, //  81
-         51, //  82
-         52, //  83
-         53, //  84
-         54, //  85
-         55, //  86
-         56, //  87
-         57, //  88
-         58, //  89
-         59, //  90
-         60, //  91
-         61, //  92
-         62, //  93
-         63, //  94
-         64, //  95
-         65, //  96
-         66, //  97
-         67, //  98
-         68, //  99
-         69, // 100
-         70, // 101
-         71, // 102
-         72, // 103
-         73, // 104
-         74, // 105
-         75, // 106
-         76, // 107
-         77, // 108
-         78, // 109
-         79, // 110
-         80, // 111
-         81, // 112
-         82, // 113
-         83, // 114
-         84, // 115
-         85, // 116
-         86, // 117
-         87, // 118
-         88, // 119
-         89, // 120
-         90, // 121
-         91, // 122
-         92, // 123
-         93, // 124
-         94, // 125
-         95, // 126
-          0, // 127
-          0, // 128
-          0, // 129
-          0, // 130
-          0, // 131
-          0, // 132
-          0, // 133
-          0, // 134
-          0, // 135
-          0, // 136
-          0, // 137
-          0, // 138
-          0, // 139
-          0, // 140
-          0, // 141
-          0, // 142
-          0, // 143
-          0, // 144
-          0, // 145
-          0, // 146
-          0, // 147
-          0, // 148
-          0, // 149
-          0, // 150
-          0, // 151
-          0, // 152
-          0, // 153
-          0, // 154
-          0, // 155
-          0, // 156
-          0, // 157
-          0, // 158
-          0, // 159
-          0, // 160
-          0, // 161
-          0, // 162
-          0, // 163
-          0, // 164
-          0, // 165
-          0, // 166
-          0, // 167
-          0, // 168
-          0, // 169
-          0, // 170
-          0, // 171
-          0, // 172
-          0, // 173
-          0, // 174
-          0, // 175
-          0, // 176
-        100, // 177
-         97, // 178
-         98, // 179
-          0, // 180
-         99, // 181
-          0, // 182
-          0, // 183
-          0, // 184
-          0, // 185
-         96, // 186
-          0, // 187
-          0, // 188
-          0, // 189
-          0, // 190
-          0, // 191
-          0, // 192
-          0, // 193
-          0, // 194
-          0, // 195
-        101, // 196
-          0, // 197
-          0, // 198
-          0, // 199
-          0, // 200
-          0, // 201
-          0, // 202
-          0, // 203
-          0, // 204
-          0, // 205
-          0, // 206
-          0, // 207
-          0, // 208
-          0, // 209
-          0, // 210
-          0, // 211
-          0, // 212
-          0, // 213
-        102, // 214
-          0, // 215
-          0, // 216
-          0, // 217
-          0, // 218
-          0, // 219
-        103, // 220
-          0, // 221
-          0, // 222
-          0, // 223
-          0, // 224
-          0, // 225
-          0, // 226
-          0, // 227
-        104, // 228
-          0, // 229
-          0, // 230
-          0, // 231
-          0, // 232
-          0, // 233
-          0, // 234
-          0, // 235
-          0, // 236
-          0, // 237
-          0, // 238
-          0, // 239
-          0, // 240
-          0, // 241
-          0, // 242
-          0, // 243
-          0, // 244
-          0, // 245
-        105, // 246
-          0, // 247
-          0, // 248
-          0, // 249
-          0, // 250
-          0, // 251
-        106, // 252
-          0, // 253
-          0, // 254
-          0, // 255
-    }
+    .data     = terminus13norm_data,
+    .glyphs   = terminus13norm_glyphs,
+    .ranges   = terminus13norm_ranges,
+    .nrranges = 9,
+    .width    = 7, /* widest advance */
+    .height   = 13, /* line height */
 };
 
@@ -1,2081 +1,1261 @@
-/* Font definition: Terminus font in size 16 pixels.
- * width is 8 pixels. This uses 1 bytes
- * per character. Font weight was bold.
- * This was obviously generated by script from the TTF version
- * of the font (because it gets harder and harder to use the
- * original bitmap font).
- * The Terminus Font is licensed under the SIL Open Font License,
- * version 1.1.
+/* Font definition: terminus16bold, compiled from terminus16bold.bdf
+ * by tools/compile-font.py.
+ * Line height is 16 pixels, width is 8 pixels, 106 glyphs in 765 bytes.
+ * The Terminus Font is licensed under the SIL Open Font License, version 1.1.
  */
 
 #include "font.h"
 
-const uint8_t terminus16bold_data[] = {
-    /* Next character:   (space) (ord 32) at offset 1 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ! (ord 33) at offset 2 */
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: " (ord 34) at offset 3 */
-    0x00, //         
-    0x66, //  ##  ## 
-    0x66, //  ##  ## 
-    0x66, //  ##  ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: # (ord 35) at offset 4 */
-    0x00, //         
-    0x00, //         
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0xFE, // ####### 
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0xFE, // ####### 
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: $ (ord 36) at offset 5 */
-    0x00, //         
-    0x10, //    #    
-    0x10, //    #    
-    0x7C, //  #####  
-    0xD6, // ## # ## 
-    0xD0, // ## #    
-    0xD0, // ## #    
-    0x7C, //  #####  
-    0x16, //    # ## 
-    0x16, //    # ## 
-    0xD6, // ## # ## 
-    0x7C, //  #####  
-    0x10, //    #    
-    0x10, //    #    
-    0x00, //         
-    0x00, //         
-    /* Next character: % (ord 37) at offset 6 */
-    0x00, //         
-    0x00, //         
-    0x66, //  ##  ## 
-    0xD6, // ## # ## 
-    0x6C, //  ## ##  
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x18, //    ##   
-    0x30, //   ##    
-    0x36, //   ## ## 
-    0x6B, //  ## # ##
-    0x66, //  ##  ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: & (ord 38) at offset 7 */
-    0x00, //         
-    0x00, //         
-    0x38, //   ###   
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x38, //   ###   
-    0x76, //  ### ## 
-    0xDC, // ## ###  
-    0xCC, // ##  ##  
-    0xCC, // ##  ##  
-    0xDC, // ## ###  
-    0x76, //  ### ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ' (ord 39) at offset 8 */
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ( (ord 40) at offset 9 */
-    0x00, //         
-    0x00, //         
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x18, //    ##   
-    0x0C, //     ##  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ) (ord 41) at offset 10 */
-    0x00, //         
-    0x00, //         
-    0x30, //   ##    
-    0x18, //    ##   
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x30, //   ##    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: * (ord 42) at offset 11 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x6C, //  ## ##  
-    0x38, //   ###   
-    0xFE, // ####### 
-    0x38, //   ###   
-    0x6C, //  ## ##  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: + (ord 43) at offset 12 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x7E, //  ###### 
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: , (ord 44) at offset 13 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x30, //   ##    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: - (ord 45) at offset 14 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: . (ord 46) at offset 15 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: / (ord 47) at offset 16 */
-    0x00, //         
-    0x00, //         
-    0x06, //      ## 
-    0x06, //      ## 
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x18, //    ##   
-    0x30, //   ##    
-    0x30, //   ##    
-    0x60, //  ##     
-    0x60, //  ##     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 0 (ord 48) at offset 17 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xCE, // ##  ### 
-    0xDE, // ## #### 
-    0xF6, // #### ## 
-    0xE6, // ###  ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 1 (ord 49) at offset 18 */
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x38, //   ###   
-    0x78, //  ####   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x7E, //  ###### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 2 (ord 50) at offset 19 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x06, //      ## 
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x30, //   ##    
-    0x60, //  ##     
-    0xC0, // ##      
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 3 (ord 51) at offset 20 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x06, //      ## 
-    0x3C, //   ####  
-    0x06, //      ## 
-    0x06, //      ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 4 (ord 52) at offset 21 */
-    0x00, //         
-    0x00, //         
-    0x06, //      ## 
-    0x0E, //     ### 
-    0x1E, //    #### 
-    0x36, //   ## ## 
-    0x66, //  ##  ## 
-    0xC6, // ##   ## 
-    0xFE, // ####### 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 5 (ord 53) at offset 22 */
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xFC, // ######  
-    0x06, //      ## 
-    0x06, //      ## 
-    0x06, //      ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 6 (ord 54) at offset 23 */
-    0x00, //         
-    0x00, //         
-    0x3C, //   ####  
-    0x60, //  ##     
-    0xC0, // ##      
-    0xC0, // ##      
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 7 (ord 55) at offset 24 */
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x18, //    ##   
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 8 (ord 56) at offset 25 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: 9 (ord 57) at offset 26 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x0C, //     ##  
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: : (ord 58) at offset 27 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ; (ord 59) at offset 28 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x30, //   ##    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: < (ord 60) at offset 29 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x06, //      ## 
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x30, //   ##    
-    0x60, //  ##     
-    0x30, //   ##    
-    0x18, //    ##   
-    0x0C, //     ##  
-    0x06, //      ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: = (ord 61) at offset 30 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: > (ord 62) at offset 31 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x60, //  ##     
-    0x30, //   ##    
-    0x18, //    ##   
-    0x0C, //     ##  
-    0x06, //      ## 
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x30, //   ##    
-    0x60, //  ##     
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ? (ord 63) at offset 32 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: @ (ord 64) at offset 33 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xCE, // ##  ### 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xCE, // ##  ### 
-    0xC0, // ##      
-    0x7E, //  ###### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: A (ord 65) at offset 34 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFE, // ####### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: B (ord 66) at offset 35 */
-    0x00, //         
-    0x00, //         
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFC, // ######  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: C (ord 67) at offset 36 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: D (ord 68) at offset 37 */
-    0x00, //         
-    0x00, //         
-    0xF8, // #####   
-    0xCC, // ##  ##  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xCC, // ##  ##  
-    0xF8, // #####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: E (ord 69) at offset 38 */
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xF8, // #####   
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: F (ord 70) at offset 39 */
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xF8, // #####   
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: G (ord 71) at offset 40 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC0, // ##      
-    0xC0, // ##      
-    0xDE, // ## #### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: H (ord 72) at offset 41 */
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFE, // ####### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: I (ord 73) at offset 42 */
-    0x00, //         
-    0x00, //         
-    0x3C, //   ####  
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x3C, //   ####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: J (ord 74) at offset 43 */
-    0x00, //         
-    0x00, //         
-    0x1E, //    #### 
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0xCC, // ##  ##  
-    0xCC, // ##  ##  
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: K (ord 75) at offset 44 */
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xCC, // ##  ##  
-    0xD8, // ## ##   
-    0xF0, // ####    
-    0xF0, // ####    
-    0xD8, // ## ##   
-    0xCC, // ##  ##  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: L (ord 76) at offset 45 */
-    0x00, //         
-    0x00, //         
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: M (ord 77) at offset 46 */
-    0x00, //         
-    0x00, //         
-    0x82, // #     # 
-    0xC6, // ##   ## 
-    0xEE, // ### ### 
-    0xFE, // ####### 
-    0xD6, // ## # ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: N (ord 78) at offset 47 */
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xE6, // ###  ## 
-    0xF6, // #### ## 
-    0xDE, // ## #### 
-    0xCE, // ##  ### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: O (ord 79) at offset 48 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: P (ord 80) at offset 49 */
-    0x00, //         
-    0x00, //         
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFC, // ######  
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Q (ord 81) at offset 50 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xDE, // ## #### 
-    0x7C, //  #####  
-    0x06, //      ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: R (ord 82) at offset 51 */
-    0x00, //         
-    0x00, //         
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFC, // ######  
-    0xF0, // ####    
-    0xD8, // ## ##   
-    0xCC, // ##  ##  
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: S (ord 83) at offset 52 */
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC0, // ##      
-    0xC0, // ##      
-    0x7C, //  #####  
-    0x06, //      ## 
-    0x06, //      ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: T (ord 84) at offset 53 */
-    0x00, //         
-    0x00, //         
-    0xFF, // ########
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: U (ord 85) at offset 54 */
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: V (ord 86) at offset 55 */
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x38, //   ###   
-    0x38, //   ###   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: W (ord 87) at offset 56 */
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xD6, // ## # ## 
-    0xFE, // ####### 
-    0xEE, // ### ### 
-    0xC6, // ##   ## 
-    0x82, // #     # 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: X (ord 88) at offset 57 */
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x38, //   ###   
-    0x38, //   ###   
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Y (ord 89) at offset 58 */
-    0x00, //         
-    0x00, //         
-    0xC3, // ##    ##
-    0xC3, // ##    ##
-    0x66, //  ##  ## 
-    0x66, //  ##  ## 
-    0x3C, //   ####  
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Z (ord 90) at offset 59 */
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x30, //   ##    
-    0x60, //  ##     
-    0xC0, // ##      
-    0xC0, // ##      
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: [ (ord 91) at offset 60 */
-    0x00, //         
-    0x00, //         
-    0x3C, //   ####  
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x3C, //   ####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: \\ (ord 92) at offset 61 */
-    0x00, //         
-    0x00, //         
-    0x60, //  ##     
-    0x60, //  ##     
-    0x30, //   ##    
-    0x30, //   ##    
-    0x18, //    ##   
-    0x18, //    ##   
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x06, //      ## 
-    0x06, //      ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ] (ord 93) at offset 62 */
-    0x00, //         
-    0x00, //         
-    0x3C, //   ####  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x3C, //   ####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ^ (ord 94) at offset 63 */
-    0x00, //         
-    0x18, //    ##   
-    0x3C, //   ####  
-    0x66, //  ##  ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: _ (ord 95) at offset 64 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ` (ord 96) at offset 65 */
-    0x30, //   ##    
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: a (ord 97) at offset 66 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0x06, //      ## 
-    0x7E, //  ###### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: b (ord 98) at offset 67 */
-    0x00, //         
-    0x00, //         
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFC, // ######  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: c (ord 99) at offset 68 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: d (ord 100) at offset 69 */
-    0x00, //         
-    0x00, //         
-    0x06, //      ## 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x7E, //  ###### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: e (ord 101) at offset 70 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFE, // ####### 
-    0xC0, // ##      
-    0xC0, // ##      
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: f (ord 102) at offset 71 */
-    0x00, //         
-    0x00, //         
-    0x1E, //    #### 
-    0x30, //   ##    
-    0x30, //   ##    
-    0xFC, // ######  
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: g (ord 103) at offset 72 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x7E, //  ###### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x06, //      ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    /* Next character: h (ord 104) at offset 73 */
-    0x00, //         
-    0x00, //         
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: i (ord 105) at offset 74 */
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x38, //   ###   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x3C, //   ####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: j (ord 106) at offset 75 */
-    0x00, //         
-    0x00, //         
-    0x06, //      ## 
-    0x06, //      ## 
-    0x00, //         
-    0x0E, //     ### 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x66, //  ##  ## 
-    0x66, //  ##  ## 
-    0x3C, //   ####  
-    0x00, //         
-    0x00, //         
-    /* Next character: k (ord 107) at offset 76 */
-    0x00, //         
-    0x00, //         
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC6, // ##   ## 
-    0xCC, // ##  ##  
-    0xD8, // ## ##   
-    0xF0, // ####    
-    0xD8, // ## ##   
-    0xCC, // ##  ##  
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: l (ord 108) at offset 77 */
-    0x00, //         
-    0x00, //         
-    0x38, //   ###   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x3C, //   ####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: m (ord 109) at offset 78 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xFC, // ######  
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: n (ord 110) at offset 79 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: o (ord 111) at offset 80 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: p (ord 112) at offset 81 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xFC, // ######  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFC, // ######  
-    0xC0, // ##      
-    0xC0, // ##      
-    0x00, //         
-    0x00, //         
-    /* Next character: q (ord 113) at offset 82 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x7E, //  ###### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x06, //      ## 
-    0x06, //      ## 
-    0x00, //         
-    0x00, //         
-    /* Next character: r (ord 114) at offset 83 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xDE, // ## #### 
-    0xF0, // ####    
-    0xE0, // ###     
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0xC0, // ##      
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: s (ord 115) at offset 84 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x7E, //  ###### 
-    0xC0, // ##      
-    0xC0, // ##      
-    0x7C, //  #####  
-    0x06, //      ## 
-    0x06, //      ## 
-    0xFC, // ######  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: t (ord 116) at offset 85 */
-    0x00, //         
-    0x00, //         
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0xFC, // ######  
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x1E, //    #### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: u (ord 117) at offset 86 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: v (ord 118) at offset 87 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x38, //   ###   
-    0x38, //   ###   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: w (ord 119) at offset 88 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0xD6, // ## # ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: x (ord 120) at offset 89 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x6C, //  ## ##  
-    0x38, //   ###   
-    0x6C, //  ## ##  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: y (ord 121) at offset 90 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x06, //      ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    /* Next character: z (ord 122) at offset 91 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xFE, // ####### 
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x30, //   ##    
-    0x60, //  ##     
-    0xC0, // ##      
-    0xFE, // ####### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: { (ord 123) at offset 92 */
-    0x00, //         
-    0x00, //         
-    0x1C, //    ###  
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x60, //  ##     
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x30, //   ##    
-    0x1C, //    ###  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: | (ord 124) at offset 93 */
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: } (ord 125) at offset 94 */
-    0x00, //         
-    0x00, //         
-    0x70, //  ###    
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x18, //    ##   
-    0x70, //  ###    
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ~ (ord 126) at offset 95 */
-    0x00, //         
-    0x73, //  ###  ##
-    0xDB, // ## ## ##
-    0xCE, // ##  ### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ° (ord 186) at offset 96 */
-    0x00, //         
-    0x38, //   ###   
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x38, //   ###   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ² (ord 178) at offset 97 */
-    0x00, //         
-    0x38, //   ###   
-    0x6C, //  ## ##  
-    0x0C, //     ##  
-    0x18, //    ##   
-    0x30, //   ##    
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ³ (ord 179) at offset 98 */
-    0x00, //         
-    0x78, //  ####   
-    0x0C, //     ##  
-    0x38, //   ###   
-    0x0C, //     ##  
-    0x0C, //     ##  
-    0x78, //  ####   
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: µ (ord 181) at offset 99 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xCE, // ##  ### 
-    0xF6, // #### ## 
-    0xC0, // ##      
-    0xC0, // ##      
-    0x00, //         
-    0x00, //         
-    /* Next character: ± (ord 177) at offset 100 */
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x18, //    ##   
-    0x18, //    ##   
-    0x7E, //  ###### 
-    0x18, //    ##   
-    0x18, //    ##   
-    0x00, //         
-    0x7E, //  ###### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Ä (ord 196) at offset 101 */
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xFE, // ####### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Ö (ord 214) at offset 102 */
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: Ü (ord 220) at offset 103 */
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ä (ord 228) at offset 104 */
-    0x00, //         
-    0x00, //         
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x00, //         
-    0x7C, //  #####  
-    0x06, //      ## 
-    0x7E, //  ###### 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ö (ord 246) at offset 105 */
-    0x00, //         
-    0x00, //         
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x00, //         
-    0x7C, //  #####  
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7C, //  #####  
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    /* Next character: ü (ord 252) at offset 106 */
-    0x00, //         
-    0x00, //         
-    0x6C, //  ## ##  
-    0x6C, //  ## ##  
-    0x00, //         
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0xC6, // ##   ## 
-    0x7E, //  ###### 
-    0x00, //         
-    0x00, //         
-    0x00, //         
-    0x00, //         
+static const uint8_t terminus16bold_data[] = {
+    /* U+0020 (space): 0x0 at 0/0 */
+    /* U+0021 !: 2x10 at 3/2 */
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    // ..
+    // ##
+    // ##
+    0xff, 0xfc, 0xf0,
+    /* U+0022 ": 6x3 at 1/1 */
+    // ##..##
+    // ##..##
+    // ##..##
+    0xcf, 0x3c, 0xc0,
+    /* U+0023 #: 7x10 at 0/2 */
+    // .##.##.
+    // .##.##.
+    // .##.##.
+    // #######
+    // .##.##.
+    // .##.##.
+    // #######
+    // .##.##.
+    // .##.##.
+    // .##.##.
+    0x6c, 0xd9, 0xb7, 0xf6, 0xcd, 0xbf, 0xb6, 0x6c, 0xd8,
+    /* U+0024 $: 7x13 at 0/1 */
+    // ...#...
+    // ...#...
+    // .#####.
+    // ##.#.##
+    // ##.#...
+    // ##.#...
+    // .#####.
+    // ...#.##
+    // ...#.##
+    // ##.#.##
+    // .#####.
+    // ...#...
+    // ...#...
+    0x10, 0x21, 0xf6, 0xbd, 0x1a, 0x1f, 0x0b, 0x17, 0xad, 0xf0, 0x81, 0x00,
+    /* U+0025 %: 8x10 at 0/2 */
+    // .##..##.
+    // ##.#.##.
+    // .##.##..
+    // ....##..
+    // ...##...
+    // ...##...
+    // ..##....
+    // ..##.##.
+    // .##.#.##
+    // .##..##.
+    0x66, 0xd6, 0x6c, 0x0c, 0x18, 0x18, 0x30, 0x36, 0x6b, 0x66,
+    /* U+0026 &: 7x10 at 0/2 */
+    // ..###..
+    // .##.##.
+    // .##.##.
+    // ..###..
+    // .###.##
+    // ##.###.
+    // ##..##.
+    // ##..##.
+    // ##.###.
+    // .###.##
+    0x38, 0xd9, 0xb1, 0xc7, 0x7b, 0xb3, 0x66, 0xdc, 0xec,
+    /* U+0027 ': 2x3 at 3/1 */
+    // ##
+    // ##
+    // ##
+    0xfc,
+    /* U+0028 (: 4x10 at 2/2 */
+    // ..##
+    // .##.
+    // ##..
+    // ##..
+    // ##..
+    // ##..
+    // ##..
+    // ##..
+    // .##.
+    // ..##
+    0x36, 0xcc, 0xcc, 0xcc, 0x63,
+    /* U+0029 ): 4x10 at 2/2 */
+    // ##..
+    // .##.
+    // ..##
+    // ..##
+    // ..##
+    // ..##
+    // ..##
+    // ..##
+    // .##.
+    // ##..
+    0xc6, 0x33, 0x33, 0x33, 0x6c,
+    /* U+002A *: 7x5 at 0/5 */
+    // .##.##.
+    // ..###..
+    // #######
+    // ..###..
+    // .##.##.
+    0x6c, 0x73, 0xf9, 0xc6, 0xc0,
+    /* U+002B +: 6x5 at 1/5 */
+    // ..##..
+    // ..##..
+    // ######
+    // ..##..
+    // ..##..
+    0x30, 0xcf, 0xcc, 0x30,
+    /* U+002C ,: 3x3 at 2/10 */
+    // .##
+    // .##
+    // ##.
+    0x6f, 0x00,
+    /* U+002D -: 7x1 at 0/7 */
+    // #######
+    0xfe,
+    /* U+002E .: 2x2 at 3/10 */
+    // ##
+    // ##
+    0xf0,
+    /* U+002F: 6x10 at 1/2 */
+    // ....##
+    // ....##
+    // ...##.
+    // ...##.
+    // ..##..
+    // ..##..
+    // .##...
+    // .##...
+    // ##....
+    // ##....
+    0x0c, 0x31, 0x86, 0x30, 0xc6, 0x18, 0xc3, 0x00,
+    /* U+0030 0: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##..###
+    // ##.####
+    // ####.##
+    // ###..##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x1e, 0x7d, 0xfe, 0xf9, 0xe3, 0xc6, 0xf8,
+    /* U+0031 1: 6x10 at 1/2 */
+    // ..##..
+    // .###..
+    // ####..
+    // ..##..
+    // ..##..
+    // ..##..
+    // ..##..
+    // ..##..
+    // ..##..
+    // ######
+    0x31, 0xcf, 0x0c, 0x30, 0xc3, 0x0c, 0x33, 0xf0,
+    /* U+0032 2: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // .....##
+    // ....##.
+    // ...##..
+    // ..##...
+    // .##....
+    // ##.....
+    // #######
+    0x7d, 0x8f, 0x18, 0x30, 0xc3, 0x0c, 0x30, 0xc1, 0xfc,
+    /* U+0033 3: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // .....##
+    // ..####.
+    // .....##
+    // .....##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x18, 0x33, 0xc0, 0xc1, 0xe3, 0xc6, 0xf8,
+    /* U+0034 4: 7x10 at 0/2 */
+    // .....##
+    // ....###
+    // ...####
+    // ..##.##
+    // .##..##
+    // ##...##
+    // #######
+    // .....##
+    // .....##
+    // .....##
+    0x06, 0x1c, 0x79, 0xb6, 0x78, 0xff, 0x83, 0x06, 0x0c,
+    /* U+0035 5: 7x10 at 0/2 */
+    // #######
+    // ##.....
+    // ##.....
+    // ##.....
+    // ######.
+    // .....##
+    // .....##
+    // .....##
+    // ##...##
+    // .#####.
+    0xff, 0x83, 0x06, 0x0f, 0xc0, 0xc1, 0x83, 0xc6, 0xf8,
+    /* U+0036 6: 7x10 at 0/2 */
+    // ..####.
+    // .##....
+    // ##.....
+    // ##.....
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x3c, 0xc3, 0x06, 0x0f, 0xd8, 0xf1, 0xe3, 0xc6, 0xf8,
+    /* U+0037 7: 7x10 at 0/2 */
+    // #######
+    // .....##
+    // .....##
+    // ....##.
+    // ....##.
+    // ...##..
+    // ...##..
+    // ..##...
+    // ..##...
+    // ..##...
+    0xfe, 0x0c, 0x18, 0x60, 0xc3, 0x06, 0x18, 0x30, 0x60,
+    /* U+0038 8: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x1e, 0x37, 0xd8, 0xf1, 0xe3, 0xc6, 0xf8,
+    /* U+0039 9: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    // .....##
+    // .....##
+    // ....##.
+    // .####..
+    0x7d, 0x8f, 0x1e, 0x3c, 0x6f, 0xc1, 0x83, 0x0c, 0xf0,
+    /* U+003A :: 2x7 at 3/5 */
+    // ##
+    // ##
+    // ..
+    // ..
+    // ..
+    // ##
+    // ##
+    0xf0, 0x3c,
+    /* U+003B ;: 3x8 at 2/5 */
+    // .##
+    // .##
+    // ...
+    // ...
+    // ...
+    // .##
+    // .##
+    // ##.
+    0x6c, 0x00, 0xde,
+    /* U+003C <: 6x9 at 1/3 */
+    // ....##
+    // ...##.
+    // ..##..
+    // .##...
+    // ##....
+    // .##...
+    // ..##..
+    // ...##.
+    // ....##
+    0x0c, 0x63, 0x18, 0xc1, 0x83, 0x06, 0x0c,
+    /* U+003D =: 7x4 at 0/5 */
+    // #######
+    // .......
+    // .......
+    // #######
+    0xfe, 0x00, 0x07, 0xf0,
+    /* U+003E >: 6x9 at 1/3 */
+    // ##....
+    // .##...
+    // ..##..
+    // ...##.
+    // ....##
+    // ...##.
+    // ..##..
+    // .##...
+    // ##....
+    0xc1, 0x83, 0x06, 0x0c, 0x63, 0x18, 0xc0,
+    /* U+003F ?: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ....##.
+    // ...##..
+    // ...##..
+    // .......
+    // ...##..
+    // ...##..
+    0x7d, 0x8f, 0x1e, 0x30, 0xc3, 0x06, 0x00, 0x18, 0x30,
+    /* U+0040 @: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##..###
+    // ##.#.##
+    // ##.#.##
+    // ##.#.##
+    // ##.#.##
+    // ##..###
+    // ##.....
+    // .######
+    0x7d, 0x8f, 0x3e, 0xbd, 0x7a, 0xf5, 0xe7, 0xc0, 0xfc,
+    /* U+0041 A: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // #######
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    0x7d, 0x8f, 0x1e, 0x3c, 0x7f, 0xf1, 0xe3, 0xc7, 0x8c,
+    /* U+0042 B: 7x10 at 0/2 */
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ######.
+    0xfd, 0x8f, 0x1e, 0x3f, 0xd8, 0xf1, 0xe3, 0xc7, 0xf8,
+    /* U+0043 C: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##...##
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x1e, 0x0c, 0x18, 0x30, 0x63, 0xc6, 0xf8,
+    /* U+0044 D: 7x10 at 0/2 */
+    // #####..
+    // ##..##.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##..##.
+    // #####..
+    0xf9, 0x9b, 0x1e, 0x3c, 0x78, 0xf1, 0xe3, 0xcd, 0xf0,
+    /* U+0045 E: 7x10 at 0/2 */
+    // #######
+    // ##.....
+    // ##.....
+    // ##.....
+    // #####..
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // #######
+    0xff, 0x83, 0x06, 0x0f, 0x98, 0x30, 0x60, 0xc1, 0xfc,
+    /* U+0046 F: 7x10 at 0/2 */
+    // #######
+    // ##.....
+    // ##.....
+    // ##.....
+    // #####..
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    0xff, 0x83, 0x06, 0x0f, 0x98, 0x30, 0x60, 0xc1, 0x80,
+    /* U+0047 G: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##.....
+    // ##.....
+    // ##.####
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x1e, 0x0c, 0x1b, 0xf1, 0xe3, 0xc6, 0xf8,
+    /* U+0048 H: 7x10 at 0/2 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // #######
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    0xc7, 0x8f, 0x1e, 0x3f, 0xf8, 0xf1, 0xe3, 0xc7, 0x8c,
+    /* U+0049 I: 4x10 at 2/2 */
+    // ####
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // ####
+    0xf6, 0x66, 0x66, 0x66, 0x6f,
+    /* U+004A J: 7x10 at 0/2 */
+    // ...####
+    // ....##.
+    // ....##.
+    // ....##.
+    // ....##.
+    // ....##.
+    // ....##.
+    // ##..##.
+    // ##..##.
+    // .####..
+    0x1e, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x66, 0xcc, 0xf0,
+    /* U+004B K: 7x10 at 0/2 */
+    // ##...##
+    // ##...##
+    // ##..##.
+    // ##.##..
+    // ####...
+    // ####...
+    // ##.##..
+    // ##..##.
+    // ##...##
+    // ##...##
+    0xc7, 0x8f, 0x36, 0xcf, 0x1e, 0x36, 0x66, 0xc7, 0x8c,
+    /* U+004C L: 7x10 at 0/2 */
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    // #######
+    0xc1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0xfc,
+    /* U+004D M: 7x10 at 0/2 */
+    // #.....#
+    // ##...##
+    // ###.###
+    // #######
+    // ##.#.##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    0x83, 0x8f, 0xbf, 0xfd, 0x78, 0xf1, 0xe3, 0xc7, 0x8c,
+    /* U+004E N: 7x10 at 0/2 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // ###..##
+    // ####.##
+    // ##.####
+    // ##..###
+    // ##...##
+    // ##...##
+    // ##...##
+    0xc7, 0x8f, 0x1f, 0x3f, 0x7b, 0xf3, 0xe3, 0xc7, 0x8c,
+    /* U+004F O: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x1e, 0x3c, 0x78, 0xf1, 0xe3, 0xc6, 0xf8,
+    /* U+0050 P: 7x10 at 0/2 */
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ######.
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    0xfd, 0x8f, 0x1e, 0x3c, 0x7f, 0xb0, 0x60, 0xc1, 0x80,
+    /* U+0051 Q: 7x11 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##.####
+    // .#####.
+    // .....##
+    0x7d, 0x8f, 0x1e, 0x3c, 0x78, 0xf1, 0xe3, 0xde, 0xf8, 0x18,
+    /* U+0052 R: 7x10 at 0/2 */
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ######.
+    // ####...
+    // ##.##..
+    // ##..##.
+    // ##...##
+    0xfd, 0x8f, 0x1e, 0x3c, 0x7f, 0xbc, 0x6c, 0xcd, 0x8c,
+    /* U+0053 S: 7x10 at 0/2 */
+    // .#####.
+    // ##...##
+    // ##.....
+    // ##.....
+    // .#####.
+    // .....##
+    // .....##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x06, 0x07, 0xc0, 0xc1, 0xe3, 0xc6, 0xf8,
+    /* U+0054 T: 8x10 at 0/2 */
+    // ########
+    // ...##...
+    // ...##...
+    // ...##...
+    // ...##...
+    // ...##...
+    // ...##...
+    // ...##...
+    // ...##...
+    // ...##...
+    0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    /* U+0055 U: 7x10 at 0/2 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0xc7, 0x8f, 0x1e, 0x3c, 0x78, 0xf1, 0xe3, 0xc6, 0xf8,
+    /* U+0056 V: 7x10 at 0/2 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .##.##.
+    // .##.##.
+    // .##.##.
+    // ..###..
+    // ..###..
+    0xc7, 0x8f, 0x1e, 0x3c, 0x6d, 0x9b, 0x36, 0x38, 0x70,
+    /* U+0057 W: 7x10 at 0/2 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##.#.##
+    // #######
+    // ###.###
+    // ##...##
+    // #.....#
+    0xc7, 0x8f, 0x1e, 0x3c, 0x7a, 0xff, 0xf7, 0xc7, 0x04,
+    /* U+0058 X: 7x10 at 0/2 */
+    // ##...##
+    // ##...##
+    // .##.##.
+    // .##.##.
+    // ..###..
+    // ..###..
+    // .##.##.
+    // .##.##.
+    // ##...##
+    // ##...##
+    0xc7, 0x8d, 0xb3, 0x63, 0x87, 0x1b, 0x36, 0xc7, 0x8c,
+    /* U+0059 Y: 8x10 at 0/2 */
+    // ##....##
+    // ##....##
+    // .##..##.
+    // .##..##.
+    // ..####..
+    // ...##...
+    // ...##...
+    // ...##...
+    // ...##...
+    // ...##...
+    0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18,
+    /* U+005A Z: 7x10 at 0/2 */
+    // #######
+    // .....##
+    // .....##
+    // ....##.
+    // ...##..
+    // ..##...
+    // .##....
+    // ##.....
+    // ##.....
+    // #######
+    0xfe, 0x0c, 0x18, 0x61, 0x86, 0x18, 0x60, 0xc1, 0xfc,
+    /* U+005B [: 4x10 at 2/2 */
+    // ####
+    // ##..
+    // ##..
+    // ##..
+    // ##..
+    // ##..
+    // ##..
+    // ##..
+    // ##..
+    // ####
+    0xfc, 0xcc, 0xcc, 0xcc, 0xcf,
+    /* U+005C \: 6x10 at 1/2 */
+    // ##....
+    // ##....
+    // .##...
+    // .##...
+    // ..##..
+    // ..##..
+    // ...##.
+    // ...##.
+    // ....##
+    // ....##
+    0xc3, 0x06, 0x18, 0x30, 0xc1, 0x86, 0x0c, 0x30,
+    /* U+005D ]: 4x10 at 2/2 */
+    // ####
+    // ..##
+    // ..##
+    // ..##
+    // ..##
+    // ..##
+    // ..##
+    // ..##
+    // ..##
+    // ####
+    0xf3, 0x33, 0x33, 0x33, 0x3f,
+    /* U+005E ^: 6x3 at 1/1 */
+    // ..##..
+    // .####.
+    // ##..##
+    0x31, 0xec, 0xc0,
+    /* U+005F _: 7x1 at 0/12 */
+    // #######
+    0xfe,
+    /* U+0060 `: 3x2 at 2/0 */
+    // ##.
+    // .##
+    0xcc,
+    /* U+0061 a: 7x7 at 0/5 */
+    // .#####.
+    // .....##
+    // .######
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    0x7c, 0x0d, 0xfe, 0x3c, 0x78, 0xdf, 0x80,
+    /* U+0062 b: 7x10 at 0/2 */
+    // ##.....
+    // ##.....
+    // ##.....
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ######.
+    0xc1, 0x83, 0x07, 0xec, 0x78, 0xf1, 0xe3, 0xc7, 0xf8,
+    /* U+0063 c: 7x7 at 0/5 */
+    // .#####.
+    // ##...##
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x06, 0x0c, 0x18, 0xdf, 0x00,
+    /* U+0064 d: 7x10 at 0/2 */
+    // .....##
+    // .....##
+    // .....##
+    // .######
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    0x06, 0x0c, 0x1b, 0xfc, 0x78, 0xf1, 0xe3, 0xc6, 0xfc,
+    /* U+0065 e: 7x7 at 0/5 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // #######
+    // ##.....
+    // ##.....
+    // .#####.
+    0x7d, 0x8f, 0x1f, 0xfc, 0x18, 0x1f, 0x00,
+    /* U+0066 f: 7x10 at 0/2 */
+    // ...####
+    // ..##...
+    // ..##...
+    // ######.
+    // ..##...
+    // ..##...
+    // ..##...
+    // ..##...
+    // ..##...
+    // ..##...
+    0x1e, 0x60, 0xc7, 0xe3, 0x06, 0x0c, 0x18, 0x30, 0x60,
+    /* U+0067 g: 7x9 at 0/5 */
+    // .######
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    // .....##
+    // .#####.
+    0x7f, 0x8f, 0x1e, 0x3c, 0x78, 0xdf, 0x83, 0x7c,
+    /* U+0068 h: 7x10 at 0/2 */
+    // ##.....
+    // ##.....
+    // ##.....
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    0xc1, 0x83, 0x07, 0xec, 0x78, 0xf1, 0xe3, 0xc7, 0x8c,
+    /* U+0069 i: 4x10 at 2/2 */
+    // .##.
+    // .##.
+    // ....
+    // ###.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // ####
+    0x66, 0x0e, 0x66, 0x66, 0x6f,
+    /* U+006A j: 6x12 at 1/2 */
+    // ....##
+    // ....##
+    // ......
+    // ...###
+    // ....##
+    // ....##
+    // ....##
+    // ....##
+    // ....##
+    // ##..##
+    // ##..##
+    // .####.
+    0x0c, 0x30, 0x07, 0x0c, 0x30, 0xc3, 0x0f, 0x3c, 0xde,
+    /* U+006B k: 7x10 at 0/2 */
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##...##
+    // ##..##.
+    // ##.##..
+    // ####...
+    // ##.##..
+    // ##..##.
+    // ##...##
+    0xc1, 0x83, 0x06, 0x3c, 0xdb, 0x3c, 0x6c, 0xcd, 0x8c,
+    /* U+006C l: 4x10 at 2/2 */
+    // ###.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // .##.
+    // ####
+    0xe6, 0x66, 0x66, 0x66, 0x6f,
+    /* U+006D m: 7x7 at 0/5 */
+    // ######.
+    // ##.#.##
+    // ##.#.##
+    // ##.#.##
+    // ##.#.##
+    // ##.#.##
+    // ##.#.##
+    0xfd, 0xaf, 0x5e, 0xbd, 0x7a, 0xf5, 0x80,
+    /* U+006E n: 7x7 at 0/5 */
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    0xfd, 0x8f, 0x1e, 0x3c, 0x78, 0xf1, 0x80,
+    /* U+006F o: 7x7 at 0/5 */
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x7d, 0x8f, 0x1e, 0x3c, 0x78, 0xdf, 0x00,
+    /* U+0070 p: 7x9 at 0/5 */
+    // ######.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ######.
+    // ##.....
+    // ##.....
+    0xfd, 0x8f, 0x1e, 0x3c, 0x78, 0xff, 0x60, 0xc0,
+    /* U+0071 q: 7x9 at 0/5 */
+    // .######
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    // .....##
+    // .....##
+    0x7f, 0x8f, 0x1e, 0x3c, 0x78, 0xdf, 0x83, 0x06,
+    /* U+0072 r: 7x7 at 0/5 */
+    // ##.####
+    // ####...
+    // ###....
+    // ##.....
+    // ##.....
+    // ##.....
+    // ##.....
+    0xdf, 0xe3, 0x86, 0x0c, 0x18, 0x30, 0x00,
+    /* U+0073 s: 7x7 at 0/5 */
+    // .######
+    // ##.....
+    // ##.....
+    // .#####.
+    // .....##
+    // .....##
+    // ######.
+    0x7f, 0x83, 0x03, 0xe0, 0x60, 0xff, 0x00,
+    /* U+0074 t: 7x10 at 0/2 */
+    // ..##...
+    // ..##...
+    // ..##...
+    // ######.
+    // ..##...
+    // ..##...
+    // ..##...
+    // ..##...
+    // ..##...
+    // ...####
+    0x30, 0x60, 0xc7, 0xe3, 0x06, 0x0c, 0x18, 0x30, 0x3c,
+    /* U+0075 u: 7x7 at 0/5 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    0xc7, 0x8f, 0x1e, 0x3c, 0x78, 0xdf, 0x80,
+    /* U+0076 v: 7x7 at 0/5 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // .##.##.
+    // .##.##.
+    // ..###..
+    // ..###..
+    0xc7, 0x8f, 0x1b, 0x66, 0xc7, 0x0e, 0x00,
+    /* U+0077 w: 7x7 at 0/5 */
+    // ##...##
+    // ##...##
+    // ##.#.##
+    // ##.#.##
+    // ##.#.##
+    // ##.#.##
+    // .#####.
+    0xc7, 0x8f, 0x5e, 0xbd, 0x7a, 0xdf, 0x00,
+    /* U+0078 x: 7x7 at 0/5 */
+    // ##...##
+    // ##...##
+    // .##.##.
+    // ..###..
+    // .##.##.
+    // ##...##
+    // ##...##
+    0xc7, 0x8d, 0xb1, 0xc6, 0xd8, 0xf1, 0x80,
+    /* U+0079 y: 7x9 at 0/5 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    // .....##
+    // .#####.
+    0xc7, 0x8f, 0x1e, 0x3c, 0x78, 0xdf, 0x83, 0x7c,
+    /* U+007A z: 7x7 at 0/5 */
+    // #######
+    // ....##.
+    // ...##..
+    // ..##...
+    // .##....
+    // ##.....
+    // #######
+    0xfe, 0x18, 0x61, 0x86, 0x18, 0x3f, 0x80,
+    /* U+007B {: 5x10 at 1/2 */
+    // ..###
+    // .##..
+    // .##..
+    // .##..
+    // ##...
+    // .##..
+    // .##..
+    // .##..
+    // .##..
+    // ..###
+    0x3b, 0x18, 0xcc, 0x31, 0x8c, 0x61, 0xc0,
+    /* U+007C |: 2x10 at 3/2 */
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    // ##
+    0xff, 0xff, 0xf0,
+    /* U+007D }: 5x10 at 1/2 */
+    // ###..
+    // ..##.
+    // ..##.
+    // ..##.
+    // ...##
+    // ..##.
+    // ..##.
+    // ..##.
+    // ..##.
+    // ###..
+    0xe1, 0x8c, 0x61, 0x98, 0xc6, 0x37, 0x00,
+    /* U+007E ~: 8x3 at 0/1 */
+    // .###..##
+    // ##.##.##
+    // ##..###.
+    0x73, 0xdb, 0xce,
+    /* U+00B0: 5x4 at 1/1 */
+    // .###.
+    // ##.##
+    // ##.##
+    // .###.
+    0x76, 0xf6, 0xe0,
+    /* U+00B1: 6x7 at 1/5 */
+    // ..##..
+    // ..##..
+    // ######
+    // ..##..
+    // ..##..
+    // ......
+    // ######
+    0x30, 0xcf, 0xcc, 0x30, 0x0f, 0xc0,
+    /* U+00B2: 5x6 at 1/1 */
+    // .###.
+    // ##.##
+    // ...##
+    // ..##.
+    // .##..
+    // #####
+    0x76, 0xc6, 0x66, 0x7c,
+    /* U+00B3: 5x6 at 1/1 */
+    // ####.
+    // ...##
+    // .###.
+    // ...##
+    // ...##
+    // ####.
+    0xf0, 0xdc, 0x31, 0xf8,
+    /* U+00B5: 7x9 at 0/5 */
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##..###
+    // ####.##
+    // ##.....
+    // ##.....
+    0xc7, 0x8f, 0x1e, 0x3c, 0x79, 0xfd, 0xe0, 0xc0,
+    /* U+00C4: 7x12 at 0/0 */
+    // .##.##.
+    // .##.##.
+    // .......
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // #######
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    0x6c, 0xd8, 0x03, 0xec, 0x78, 0xf1, 0xff, 0xc7, 0x8f, 0x1e, 0x30,
+    /* U+00D6: 7x12 at 0/0 */
+    // .##.##.
+    // .##.##.
+    // .......
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x6c, 0xd8, 0x03, 0xec, 0x78, 0xf1, 0xe3, 0xc7, 0x8f, 0x1b, 0xe0,
+    /* U+00DC: 7x12 at 0/0 */
+    // .##.##.
+    // .##.##.
+    // .......
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x6c, 0xd8, 0x06, 0x3c, 0x78, 0xf1, 0xe3, 0xc7, 0x8f, 0x1b, 0xe0,
+    /* U+00E4: 7x10 at 0/2 */
+    // .##.##.
+    // .##.##.
+    // .......
+    // .#####.
+    // .....##
+    // .######
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    0x6c, 0xd8, 0x03, 0xe0, 0x6f, 0xf1, 0xe3, 0xc6, 0xfc,
+    /* U+00F6: 7x10 at 0/2 */
+    // .##.##.
+    // .##.##.
+    // .......
+    // .#####.
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .#####.
+    0x6c, 0xd8, 0x03, 0xec, 0x78, 0xf1, 0xe3, 0xc6, 0xf8,
+    /* U+00FC: 7x10 at 0/2 */
+    // .##.##.
+    // .##.##.
+    // .......
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // ##...##
+    // .######
+    0x6c, 0xd8, 0x06, 0x3c, 0x78, 0xf1, 0xe3, 0xc6, 0xfc,
+};
+
+static const struct fontglyph terminus16bold_glyphs[] = {
+    { .dataoff =     0, .w =  0, .h =  0, .xoff =  0, .yoff =  0, .advance =  8 }, /* U+0020 */
+    { .dataoff =     0, .w =  2, .h = 10, .xoff =  3, .yoff =  2, .advance =  8 }, /* U+0021 */
+    { .dataoff =     3, .w =  6, .h =  3, .xoff =  1, .yoff =  1, .advance =  8 }, /* U+0022 */
+    { .dataoff =     6, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0023 */
+    { .dataoff =    15, .w =  7, .h = 13, .xoff =  0, .yoff =  1, .advance =  8 }, /* U+0024 */
+    { .dataoff =    27, .w =  8, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0025 */
+    { .dataoff =    37, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0026 */
+    { .dataoff =    46, .w =  2, .h =  3, .xoff =  3, .yoff =  1, .advance =  8 }, /* U+0027 */
+    { .dataoff =    47, .w =  4, .h = 10, .xoff =  2, .yoff =  2, .advance =  8 }, /* U+0028 */
+    { .dataoff =    52, .w =  4, .h = 10, .xoff =  2, .yoff =  2, .advance =  8 }, /* U+0029 */
+    { .dataoff =    57, .w =  7, .h =  5, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+002A */
+    { .dataoff =    62, .w =  6, .h =  5, .xoff =  1, .yoff =  5, .advance =  8 }, /* U+002B */
+    { .dataoff =    66, .w =  3, .h =  3, .xoff =  2, .yoff = 10, .advance =  8 }, /* U+002C */
+    { .dataoff =    68, .w =  7, .h =  1, .xoff =  0, .yoff =  7, .advance =  8 }, /* U+002D */
+    { .dataoff =    69, .w =  2, .h =  2, .xoff =  3, .yoff = 10, .advance =  8 }, /* U+002E */
+    { .dataoff =    70, .w =  6, .h = 10, .xoff =  1, .yoff =  2, .advance =  8 }, /* U+002F */
+    { .dataoff =    78, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0030 */
+    { .dataoff =    87, .w =  6, .h = 10, .xoff =  1, .yoff =  2, .advance =  8 }, /* U+0031 */
+    { .dataoff =    95, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0032 */
+    { .dataoff =   104, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0033 */
+    { .dataoff =   113, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0034 */
+    { .dataoff =   122, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0035 */
+    { .dataoff =   131, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0036 */
+    { .dataoff =   140, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0037 */
+    { .dataoff =   149, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0038 */
+    { .dataoff =   158, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0039 */
+    { .dataoff =   167, .w =  2, .h =  7, .xoff =  3, .yoff =  5, .advance =  8 }, /* U+003A */
+    { .dataoff =   169, .w =  3, .h =  8, .xoff =  2, .yoff =  5, .advance =  8 }, /* U+003B */
+    { .dataoff =   172, .w =  6, .h =  9, .xoff =  1, .yoff =  3, .advance =  8 }, /* U+003C */
+    { .dataoff =   179, .w =  7, .h =  4, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+003D */
+    { .dataoff =   183, .w =  6, .h =  9, .xoff =  1, .yoff =  3, .advance =  8 }, /* U+003E */
+    { .dataoff =   190, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+003F */
+    { .dataoff =   199, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0040 */
+    { .dataoff =   208, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0041 */
+    { .dataoff =   217, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0042 */
+    { .dataoff =   226, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0043 */
+    { .dataoff =   235, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0044 */
+    { .dataoff =   244, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0045 */
+    { .dataoff =   253, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0046 */
+    { .dataoff =   262, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0047 */
+    { .dataoff =   271, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0048 */
+    { .dataoff =   280, .w =  4, .h = 10, .xoff =  2, .yoff =  2, .advance =  8 }, /* U+0049 */
+    { .dataoff =   285, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+004A */
+    { .dataoff =   294, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+004B */
+    { .dataoff =   303, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+004C */
+    { .dataoff =   312, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+004D */
+    { .dataoff =   321, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+004E */
+    { .dataoff =   330, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+004F */
+    { .dataoff =   339, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0050 */
+    { .dataoff =   348, .w =  7, .h = 11, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0051 */
+    { .dataoff =   358, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0052 */
+    { .dataoff =   367, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0053 */
+    { .dataoff =   376, .w =  8, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0054 */
+    { .dataoff =   386, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0055 */
+    { .dataoff =   395, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0056 */
+    { .dataoff =   404, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0057 */
+    { .dataoff =   413, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0058 */
+    { .dataoff =   422, .w =  8, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0059 */
+    { .dataoff =   432, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+005A */
+    { .dataoff =   441, .w =  4, .h = 10, .xoff =  2, .yoff =  2, .advance =  8 }, /* U+005B */
+    { .dataoff =   446, .w =  6, .h = 10, .xoff =  1, .yoff =  2, .advance =  8 }, /* U+005C */
+    { .dataoff =   454, .w =  4, .h = 10, .xoff =  2, .yoff =  2, .advance =  8 }, /* U+005D */
+    { .dataoff =   459, .w =  6, .h =  3, .xoff =  1, .yoff =  1, .advance =  8 }, /* U+005E */
+    { .dataoff =   462, .w =  7, .h =  1, .xoff =  0, .yoff = 12, .advance =  8 }, /* U+005F */
+    { .dataoff =   463, .w =  3, .h =  2, .xoff =  2, .yoff =  0, .advance =  8 }, /* U+0060 */
+    { .dataoff =   464, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0061 */
+    { .dataoff =   471, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0062 */
+    { .dataoff =   480, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0063 */
+    { .dataoff =   487, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0064 */
+    { .dataoff =   496, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0065 */
+    { .dataoff =   503, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0066 */
+    { .dataoff =   512, .w =  7, .h =  9, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0067 */
+    { .dataoff =   520, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0068 */
+    { .dataoff =   529, .w =  4, .h = 10, .xoff =  2, .yoff =  2, .advance =  8 }, /* U+0069 */
+    { .dataoff =   534, .w =  6, .h = 12, .xoff =  1, .yoff =  2, .advance =  8 }, /* U+006A */
+    { .dataoff =   543, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+006B */
+    { .dataoff =   552, .w =  4, .h = 10, .xoff =  2, .yoff =  2, .advance =  8 }, /* U+006C */
+    { .dataoff =   557, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+006D */
+    { .dataoff =   564, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+006E */
+    { .dataoff =   571, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+006F */
+    { .dataoff =   578, .w =  7, .h =  9, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0070 */
+    { .dataoff =   586, .w =  7, .h =  9, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0071 */
+    { .dataoff =   594, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0072 */
+    { .dataoff =   601, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0073 */
+    { .dataoff =   608, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+0074 */
+    { .dataoff =   617, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0075 */
+    { .dataoff =   624, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0076 */
+    { .dataoff =   631, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0077 */
+    { .dataoff =   638, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0078 */
+    { .dataoff =   645, .w =  7, .h =  9, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+0079 */
+    { .dataoff =   653, .w =  7, .h =  7, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+007A */
+    { .dataoff =   660, .w =  5, .h = 10, .xoff =  1, .yoff =  2, .advance =  8 }, /* U+007B */
+    { .dataoff =   667, .w =  2, .h = 10, .xoff =  3, .yoff =  2, .advance =  8 }, /* U+007C */
+    { .dataoff =   670, .w =  5, .h = 10, .xoff =  1, .yoff =  2, .advance =  8 }, /* U+007D */
+    { .dataoff =   677, .w =  8, .h =  3, .xoff =  0, .yoff =  1, .advance =  8 }, /* U+007E */
+    { .dataoff =   680, .w =  5, .h =  4, .xoff =  1, .yoff =  1, .advance =  8 }, /* U+00B0 */
+    { .dataoff =   683, .w =  6, .h =  7, .xoff =  1, .yoff =  5, .advance =  8 }, /* U+00B1 */
+    { .dataoff =   689, .w =  5, .h =  6, .xoff =  1, .yoff =  1, .advance =  8 }, /* U+00B2 */
+    { .dataoff =   693, .w =  5, .h =  6, .xoff =  1, .yoff =  1, .advance =  8 }, /* U+00B3 */
+    { .dataoff =   697, .w =  7, .h =  9, .xoff =  0, .yoff =  5, .advance =  8 }, /* U+00B5 */
+    { .dataoff =   705, .w =  7, .h = 12, .xoff =  0, .yoff =  0, .advance =  8 }, /* U+00C4 */
+    { .dataoff =   716, .w =  7, .h = 12, .xoff =  0, .yoff =  0, .advance =  8 }, /* U+00D6 */
+    { .dataoff =   727, .w =  7, .h = 12, .xoff =  0, .yoff =  0, .advance =  8 }, /* U+00DC */
+    { .dataoff =   738, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+00E4 */
+    { .dataoff =   747, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+00F6 */
+    { .dataoff =   756, .w =  7, .h = 10, .xoff =  0, .yoff =  2, .advance =  8 }, /* U+00FC */
+};
+
+static const struct fontrange terminus16bold_ranges[] = {
+    { .first = 0x0020, .count =  95, .glyph =   0 },
+    { .first = 0x00b0, .count =   4, .glyph =  95 },
+    { .first = 0x00b5, .count =   1, .glyph =  99 },
+    { .first = 0x00c4, .count =   1, .glyph = 100 },
+    { .first = 0x00d6, .count =   1, .glyph = 101 },
+    { .first = 0x00dc, .count =   1, .glyph = 102 },
+    { .first = 0x00e4, .count =   1, .glyph = 103 },
+    { .first = 0x00f6, .count =   1, .glyph = 104 },
+    { .first = 0x00fc, .count =   1, .glyph = 105 },
 };
 
 const struct font font_terminus16bold = {
-    .data   = terminus16bold_data,
-    .width  = 8,  /* Width */
-    .height = 16, /* Height */
-    .offsets = { /* Offsets to individual characters */
-          0, //   0
-          0, //   1
-          0, //   2
-          0, //   3
-          0, //   4
-          0, //   5
-          0, //   6
-          0, //   7
-          0, //   8
-          0, //   9
-          0, //  10
-          0, //  11
-          0, //  12
-          0, //  13
-          0, //  14
-          0, //  15
-          0, //  16
-          0, //  17
-          0, //  18
-          0, //  19
-          0, //  20
-          0, //  21
-          0, //  22
-          0, //  23
-          0, //  24
-          0, //  25
-          0, //  26
-          0, //  27
-          0, //  28
-          0, //  29
-          0, //  30
-          0, //  31
-          1, //  32
-          2, //  33
-          3, //  34
-          4, //  35
-          5, //  36
-          6, //  37
-          7, //  38
-          8, //  39
-          9, //  40
-         10, //  41
-         11, //  42
-         12, //  43
-         13, //  44
-         14, //  45
-         15, //  46
-         16, //  47
-         17, //  48
-         18, //  49
-         19, //  50
-         20, //  51
-         21, //  52
-         22, //  53
-         23, //  54
-         24, //  55
-         25, //  56
-         26, //  57
-         27, //  58
-         28, //  59
-         29, //  60
-         30, //  61
-         31, //  62
-         32, //  63
-         33, //  64
-         34, //  65
-         35, //  66
-         36, //  67
-         37, //  68
-         38, //  69
-         39, //  70
-         40, //  71
-         41, //  72
-         42, //  73
-         43, //  74
-         44, //  75
-         45, //  76
-         46, //  77
-         47, //  78
-         48, //  79
-         49, //  80
-         50, //  81
-         51, //  82
-         52, //  83
-         53, //  84
-         54, //  85
-         55, //  86
-         56, //  87
-         57, //  88
-         58, //  89
-         59, //  90
-         60, //  91
-         61, //  92
-         62, //  93
-         63, //  94
-         64, //  95
-         65, //  96
-         66, //  97
-         67, //  98
-         68, //  99
-         69, // 100
-         70, // 101
-         71, // 102
-         72, // 103
-         73, // 104
-         74, // 105
-         75, // 106
-         76, // 107
-         77, // 108
-         78, // 109
-         79, // 110
-         80, // 111
-         81, // 112
-         82, // 113
-         83, // 114
-         84, // 115
-         85, // 116
-         86, // 117
-         87, // 118
-         88, // 119
-         89, // 120
-         90, // 121
-         91, // 122
-         92, // 123
-         93, // 124
-         94, // 125
-         95, // 126
-          0, // 127
-          0, // 128
-          0, // 129
-          0, // 130
-          0, // 131
-          0, // 132
-          0, // 133
-          0, // 134
-          0, // 135
-          0, // 136
-          0, // 137
-          0, // 138
-          0, // 139
-          0, // 140
-          0, // 141
-          0, // 142
-          0, // 143
-          0, // 144
-          0, // 145
-          0, // 146
-          0, // 147
-          0, // 148
-          0, // 149
-          0, // 150
-          0, // 151
-          0, // 152
-          0, // 153
-          0, // 154
-          0, // 155
-          0, // 156
-          0, // 157
-          0, // 158
-          0, // 159
-          0, // 160
-          0, // 161
-          0, // 162
-          0, // 163
-          0, // 164
-          0, // 165
-          0, // 166
-          0, // 167
-          0, // 168
-          0, // 169
-          0, // 170
-          0, // 171
-          0, // 172
-          0, // 173
-          0, // 174
-          0, // 175
-          0, // 176
-        100, // 177
-         97, // 178
-         98, // 179
-          0, // 180
-         99, // 181
-          0, // 182
-          0, // 183
-          0, // 184
-          0, // 185
-         96, // 186
-          0, // 187
-          0, // 188
-          0, // 189
-          0, // 190
-          0, // 191
-          0, // 192
-          0, // 193
-          0, // 194
-          0, // 195
-        101, // 196
-          0, // 197
-          0, // 198
-          0, // 199
-          0, // 200
-          0, // 201
-          0, // 202
-          0, // 203
-          0, // 204
-          0, // 205
-          0, // 206
-          0, // 207
-          0, // 208
-          0, // 209
-          0, // 210
-          0, // 211
-          0, // 212
-          0, // 213
-        102, // 214
-          0, // 215
-          0, // 216
-          0, // 217
-          0, // 218
-          0, // 219
-        103, // 220
-          0, // 221
-          0, // 222
-          0, // 223
-          0, // 224
-          0, // 225
-          0, // 226
-          0, // 227
-        104, // 228
-          0, // 229
-          0, // 230
-          0, // 231
-          0, // 232
-          0, // 233
-          0, // 234
-          0, // 235
-          0, // 236
-          0, // 237
-          0, // 238
-          0, // 239
-          0, // 240
-          0, // 241
-          0, // 242
-          0, // 243
-          0, // 244
-          0, // 245
-        105, // 246
-          0, // 247
-          0, // 248
-          0, // 249
-          0, // 250
-          0, // 251
-        106, // 252
-          0, // 253
-          0, // 254
-          0, // 255
-    }
+    .data     = terminus16bold_data,
+    .glyphs   = terminus16bold_glyphs,
+    .ranges   = terminus16bold_ranges,
+    .nrranges = 9,
+    .width    = 8, /* widest advance */
+    .height   = 16, /* line height */
 };
 
@@ -1,4413 +1,2611 @@
-/* Font definition: Terminus font in size 38 pixels.
- * width is 19 pixels. This uses 3 bytes
- * per character. Font weight was bold.
- * This was obviously generated by script from the TTF version
- * of the font (because it gets harder and harder to use the
- * original bitmap font).
- * The Terminus Font is licensed under the SIL Open Font License,
- * version 1.1.
+/* Font definition: terminus38bold, compiled from terminus38bold.bdf
+ * by tools/compile-font.py.
+ * Line height is 38 pixels, width is 19 pixels, 106 glyphs in 3522 bytes.
+ * The Terminus Font is licensed under the SIL Open Font License, version 1.1.
  */
 
 #include "font.h"
 
-const uint8_t terminus38bold_data[] = {
-    /* Next character:   (space) (ord 32) at offset 1 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ! (ord 33) at offset 2 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: " (ord 34) at offset 3 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: # (ord 35) at offset 4 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: $ (ord 36) at offset 5 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7D, 0xDF, 0x00, //  ##### ### #####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xC0, 0x00, //  ####  ###              
-    0x79, 0xC0, 0x00, //  ####  ###              
-    0x79, 0xC0, 0x00, //  ####  ###              
-    0x79, 0xC0, 0x00, //  ####  ###              
-    0x7D, 0xC0, 0x00, //  ##### ###              
-    0x3F, 0xFC, 0x00, //   ############          
-    0x1F, 0xFE, 0x00, //    ############         
-    0x01, 0xDF, 0x00, //        ### #####        
-    0x01, 0xCF, 0x00, //        ###  ####        
-    0x01, 0xCF, 0x00, //        ###  ####        
-    0x01, 0xCF, 0x00, //        ###  ####        
-    0x01, 0xCF, 0x00, //        ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x7D, 0xDF, 0x00, //  ##### ### #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: % (ord 37) at offset 6 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0x8F, 0x00, //    ######   ####        
-    0x3F, 0xCF, 0x00, //   ########  ####        
-    0x3D, 0xDE, 0x00, //   #### ### ####         
-    0x3D, 0xDE, 0x00, //   #### ### ####         
-    0x3F, 0xFC, 0x00, //   ############          
-    0x1F, 0xBC, 0x00, //    ###### ####          
-    0x0F, 0xB8, 0x00, //     ##### ###           
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x80, 0x00, //      ####               
-    0x0F, 0x7E, 0x00, //     #### ######         
-    0x0F, 0xFF, 0x00, //     ############        
-    0x1E, 0xEF, 0x00, //    #### ### ####        
-    0x1E, 0xEF, 0x00, //    #### ### ####        
-    0x3C, 0xFF, 0x00, //   ####  ########        
-    0x3C, 0x7E, 0x00, //   ####   ######         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: & (ord 38) at offset 7 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x0F, 0xE0, 0x00, //     #######             
-    0x1F, 0xF0, 0x00, //    #########            
-    0x3C, 0x38, 0x00, //   ####    ###           
-    0x3C, 0x3C, 0x00, //   ####    ####          
-    0x3C, 0x3C, 0x00, //   ####    ####          
-    0x3C, 0x3C, 0x00, //   ####    ####          
-    0x3C, 0x3C, 0x00, //   ####    ####          
-    0x1C, 0x38, 0x00, //    ###    ###           
-    0x0E, 0x70, 0x00, //     ###  ###            
-    0x0F, 0xE0, 0x00, //     #######             
-    0x0F, 0xC0, 0x00, //     ######              
-    0x1F, 0xE3, 0x80, //    ########   ###       
-    0x3C, 0x77, 0x80, //   ####   ### ####       
-    0x78, 0x3F, 0x00, //  ####     ######        
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x7C, 0x3F, 0x00, //  #####    ######        
-    0x3F, 0xF7, 0x80, //   ########## ####       
-    0x1F, 0xE7, 0x80, //    ########  ####       
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ' (ord 39) at offset 8 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ( (ord 40) at offset 9 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x00, 0x00, //      ###                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x07, 0x00, 0x00, //      ###                
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ) (ord 41) at offset 10 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x07, 0x00, 0x00, //      ###                
-    0x03, 0x80, 0x00, //       ###               
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x00, 0x00, //      ###                
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: * (ord 42) at offset 11 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x38, 0x1C, 0x00, //   ###      ###          
-    0x1C, 0x3C, 0x00, //    ###    ####          
-    0x0E, 0x38, 0x00, //     ###   ###           
-    0x07, 0x70, 0x00, //      ### ###            
-    0x03, 0xE0, 0x00, //       #####             
-    0x01, 0xC0, 0x00, //        ###              
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0xE0, 0x00, //       #####             
-    0x07, 0x70, 0x00, //      ### ###            
-    0x0E, 0x78, 0x00, //     ###  ####           
-    0x1C, 0x3C, 0x00, //    ###    ####          
-    0x38, 0x1C, 0x00, //   ###      ###          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: + (ord 43) at offset 12 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: , (ord 44) at offset 13 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x00, 0x00, //      ###                
-    0x06, 0x00, 0x00, //      ##                 
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: - (ord 45) at offset 14 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: . (ord 46) at offset 15 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: / (ord 47) at offset 16 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x38, 0x00, //           ###           
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x80, 0x00, //      ####               
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x1E, 0x00, 0x00, //    ####                 
-    0x1E, 0x00, 0x00, //    ####                 
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 0 (ord 48) at offset 17 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x3F, 0x00, //  ####     ######        
-    0x78, 0x7F, 0x00, //  ####    #######        
-    0x78, 0xEF, 0x00, //  ####   ### ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x7B, 0x8F, 0x00, //  #### ###   ####        
-    0x7F, 0x0F, 0x00, //  #######    ####        
-    0x7E, 0x0F, 0x00, //  ######     ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 1 (ord 49) at offset 18 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0xC0, 0x00, //       ####              
-    0x07, 0xC0, 0x00, //      #####              
-    0x1F, 0xC0, 0x00, //    #######              
-    0x1F, 0xC0, 0x00, //    #######              
-    0x03, 0xC0, 0x00, //       ####              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x1F, 0xF8, 0x00, //    ##########           
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 2 (ord 50) at offset 19 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x70, 0x0F, 0x00, //  ###        ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x80, 0x00, //      ####               
-    0x0F, 0x00, 0x00, //     ####                
-    0x1E, 0x00, 0x00, //    ####                 
-    0x3C, 0x00, 0x00, //   ####                  
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 3 (ord 51) at offset 20 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1F, 0x00, //            #####        
-    0x0F, 0xFE, 0x00, //     ###########         
-    0x0F, 0xFE, 0x00, //     ###########         
-    0x00, 0x1F, 0x00, //            #####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 4 (ord 52) at offset 21 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1F, 0x00, //            #####        
-    0x00, 0x3F, 0x00, //           ######        
-    0x00, 0x7F, 0x00, //          #######        
-    0x00, 0xEF, 0x00, //         ### ####        
-    0x01, 0xCF, 0x00, //        ###  ####        
-    0x03, 0xCF, 0x00, //       ####  ####        
-    0x07, 0x8F, 0x00, //      ####   ####        
-    0x0F, 0x0F, 0x00, //     ####    ####        
-    0x1E, 0x0F, 0x00, //    ####     ####        
-    0x3C, 0x0F, 0x00, //   ####      ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 5 (ord 53) at offset 22 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x00, 0x1F, 0x00, //            #####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 6 (ord 54) at offset 23 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFE, 0x00, //    ############         
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x00, 0x00, //  #####                  
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 7 (ord 55) at offset 24 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0E, 0x00, //  ####       ###         
-    0x30, 0x1E, 0x00, //   ##       ####         
-    0x00, 0x1C, 0x00, //            ###          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x38, 0x00, //           ###           
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 8 (ord 56) at offset 25 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: 9 (ord 57) at offset 26 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1F, 0x00, //            #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x3F, 0xFC, 0x00, //   ############          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: : (ord 58) at offset 27 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ; (ord 59) at offset 28 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x00, 0x00, //      ###                
-    0x06, 0x00, 0x00, //      ##                 
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: < (ord 60) at offset 29 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0xC0, 0x00, //       ####              
-    0x07, 0x80, 0x00, //      ####               
-    0x0F, 0x00, 0x00, //     ####                
-    0x1E, 0x00, 0x00, //    ####                 
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x1E, 0x00, 0x00, //    ####                 
-    0x0F, 0x00, 0x00, //     ####                
-    0x07, 0x80, 0x00, //      ####               
-    0x03, 0x80, 0x00, //       ###               
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: = (ord 61) at offset 30 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: > (ord 62) at offset 31 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x3C, 0x00, 0x00, //   ####                  
-    0x1E, 0x00, 0x00, //    ####                 
-    0x0F, 0x00, 0x00, //     ####                
-    0x03, 0x80, 0x00, //       ###               
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0xF0, 0x00, //         ####            
-    0x00, 0x78, 0x00, //          ####           
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x78, 0x00, //          ####           
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x0F, 0x00, 0x00, //     ####                
-    0x1E, 0x00, 0x00, //    ####                 
-    0x3C, 0x00, 0x00, //   ####                  
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ? (ord 63) at offset 32 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x70, 0x0E, 0x00, //  ###        ###         
-    0x00, 0x1C, 0x00, //            ###          
-    0x00, 0x38, 0x00, //           ###           
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: @ (ord 64) at offset 33 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFE, 0x00, //    ############         
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x7C, 0x07, 0x80, //  #####       ####       
-    0x78, 0x01, 0x80, //  ####          ##       
-    0x78, 0xFF, 0x80, //  ####   #########       
-    0x79, 0xFF, 0x80, //  ####  ##########       
-    0x7B, 0xFF, 0x80, //  #### ###########       
-    0x7B, 0xC7, 0x80, //  #### ####   ####       
-    0x7B, 0x87, 0x80, //  #### ###    ####       
-    0x7B, 0x87, 0x80, //  #### ###    ####       
-    0x7B, 0x87, 0x80, //  #### ###    ####       
-    0x7B, 0x87, 0x80, //  #### ###    ####       
-    0x7B, 0x87, 0x80, //  #### ###    ####       
-    0x7B, 0x87, 0x80, //  #### ###    ####       
-    0x7B, 0xC7, 0x80, //  #### ####   ####       
-    0x7B, 0xEF, 0x80, //  #### ##### #####       
-    0x79, 0xFF, 0x80, //  ####  ##########       
-    0x78, 0xF9, 0x80, //  ####   #####  ##       
-    0x78, 0x00, 0x00, //  ####                   
-    0x7C, 0x00, 0x00, //  #####                  
-    0x3F, 0xFF, 0x80, //   ###############       
-    0x1F, 0xFF, 0x80, //    ##############       
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: A (ord 65) at offset 34 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: B (ord 66) at offset 35 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0E, 0x00, //  ####       ###         
-    0x78, 0x1C, 0x00, //  ####      ###          
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFC, 0x00, //  #############          
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: C (ord 67) at offset 36 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: D (ord 68) at offset 37 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xE0, 0x00, //  ##########             
-    0x7F, 0xFC, 0x00, //  #############          
-    0x78, 0x3E, 0x00, //  ####     #####         
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x3E, 0x00, //  ####     #####         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xE0, 0x00, //  ##########             
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: E (ord 69) at offset 38 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xF0, 0x00, //  ###########            
-    0x7F, 0xF0, 0x00, //  ###########            
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: F (ord 70) at offset 39 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xF0, 0x00, //  ###########            
-    0x7F, 0xF0, 0x00, //  ###########            
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: G (ord 71) at offset 40 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0xFF, 0x00, //  ####   ########        
-    0x78, 0xFF, 0x00, //  ####   ########        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: H (ord 72) at offset 41 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: I (ord 73) at offset 42 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x0F, 0xF0, 0x00, //     ########            
-    0x0F, 0xF0, 0x00, //     ########            
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x07, 0xF0, 0x00, //      #######            
-    0x0F, 0xF0, 0x00, //     ########            
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: J (ord 74) at offset 43 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x7F, 0x80, //          ########       
-    0x00, 0x7F, 0x80, //          ########       
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x7C, 0x3E, 0x00, //  #####    #####         
-    0x3F, 0xFC, 0x00, //   ############          
-    0x1F, 0xF0, 0x00, //    #########            
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: K (ord 75) at offset 44 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x07, 0x00, //  ####        ###        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x3C, 0x00, //  ####     ####          
-    0x78, 0x78, 0x00, //  ####    ####           
-    0x78, 0xF0, 0x00, //  ####   ####            
-    0x79, 0xE0, 0x00, //  ####  ####             
-    0x7B, 0xC0, 0x00, //  #### ####              
-    0x7F, 0x80, 0x00, //  ########               
-    0x7F, 0x00, 0x00, //  #######                
-    0x7E, 0x00, 0x00, //  ######                 
-    0x7E, 0x00, 0x00, //  ######                 
-    0x7F, 0x00, 0x00, //  #######                
-    0x7F, 0x80, 0x00, //  ########               
-    0x7B, 0xC0, 0x00, //  #### ####              
-    0x79, 0xE0, 0x00, //  ####  ####             
-    0x78, 0xF0, 0x00, //  ####   ####            
-    0x78, 0x78, 0x00, //  ####    ####           
-    0x78, 0x3C, 0x00, //  ####     ####          
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x07, 0x00, //  ####        ###        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: L (ord 76) at offset 45 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: M (ord 77) at offset 46 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x7C, 0x0F, 0x80, //  #####      #####       
-    0x7E, 0x1F, 0x80, //  ######    ######       
-    0x7F, 0x3F, 0x80, //  #######  #######       
-    0x7F, 0x3F, 0x80, //  #######  #######       
-    0x7F, 0x3F, 0x80, //  #######  #######       
-    0x7B, 0xF7, 0x80, //  #### ###### ####       
-    0x79, 0xE7, 0x80, //  ####  ####  ####       
-    0x79, 0xE7, 0x80, //  ####  ####  ####       
-    0x78, 0xC7, 0x80, //  ####   ##   ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: N (ord 78) at offset 47 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x7E, 0x0F, 0x00, //  ######     ####        
-    0x7F, 0x0F, 0x00, //  #######    ####        
-    0x7B, 0x8F, 0x00, //  #### ###   ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x78, 0xEF, 0x00, //  ####   ### ####        
-    0x78, 0x7F, 0x00, //  ####    #######        
-    0x78, 0x3F, 0x00, //  ####     ######        
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: O (ord 79) at offset 48 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: P (ord 80) at offset 49 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: Q (ord 81) at offset 50 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x7C, 0xFF, 0x00, //  #####  ########        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x1C, 0x00, //            ###          
-    0x00, 0x0E, 0x00, //             ###         
-    0x00, 0x06, 0x00, //              ##         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: R (ord 82) at offset 51 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0x00, 0x00, //  #######                
-    0x7F, 0x80, 0x00, //  ########               
-    0x7B, 0x80, 0x00, //  #### ###               
-    0x79, 0xC0, 0x00, //  ####  ###              
-    0x78, 0xE0, 0x00, //  ####   ###             
-    0x78, 0x70, 0x00, //  ####    ###            
-    0x78, 0x3C, 0x00, //  ####     ####          
-    0x78, 0x1E, 0x00, //  ####      ####         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: S (ord 83) at offset 52 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7C, 0x00, 0x00, //  #####                  
-    0x3F, 0xFC, 0x00, //   ############          
-    0x1F, 0xFE, 0x00, //    ############         
-    0x00, 0x1F, 0x00, //            #####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: T (ord 84) at offset 53 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: U (ord 85) at offset 54 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: V (ord 86) at offset 55 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x38, 0x0E, 0x00, //   ###       ###         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0E, 0x38, 0x00, //     ###   ###           
-    0x0F, 0x70, 0x00, //     #### ###            
-    0x0F, 0x70, 0x00, //     #### ###            
-    0x07, 0x70, 0x00, //      ### ###            
-    0x03, 0xE0, 0x00, //       #####             
-    0x03, 0xE0, 0x00, //       #####             
-    0x03, 0xE0, 0x00, //       #####             
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: W (ord 87) at offset 56 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0xC7, 0x80, //  ####   ##   ####       
-    0x79, 0xE7, 0x80, //  ####  ####  ####       
-    0x79, 0xE7, 0x80, //  ####  ####  ####       
-    0x7B, 0xF7, 0x80, //  #### ###### ####       
-    0x7F, 0xFF, 0x80, //  ################       
-    0x7F, 0x3F, 0x80, //  #######  #######       
-    0x7F, 0x3F, 0x80, //  #######  #######       
-    0x7E, 0x1F, 0x80, //  ######    ######       
-    0x7C, 0x0F, 0x80, //  #####      #####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x78, 0x07, 0x80, //  ####        ####       
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: X (ord 88) at offset 57 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0E, 0x38, 0x00, //     ###   ###           
-    0x0F, 0x70, 0x00, //     #### ###            
-    0x07, 0x70, 0x00, //      ### ###            
-    0x03, 0xE0, 0x00, //       #####             
-    0x03, 0xE0, 0x00, //       #####             
-    0x03, 0xE0, 0x00, //       #####             
-    0x03, 0xE0, 0x00, //       #####             
-    0x07, 0x70, 0x00, //      ### ###            
-    0x0F, 0x70, 0x00, //     #### ###            
-    0x0E, 0x78, 0x00, //     ###  ####           
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: Y (ord 89) at offset 58 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x1C, 0x3C, 0x00, //    ###    ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0E, 0x38, 0x00, //     ###   ###           
-    0x0F, 0x70, 0x00, //     #### ###            
-    0x07, 0x70, 0x00, //      ### ###            
-    0x03, 0xE0, 0x00, //       #####             
-    0x03, 0xE0, 0x00, //       #####             
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: Z (ord 90) at offset 59 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0E, 0x00, //             ###         
-    0x00, 0x1C, 0x00, //            ###          
-    0x00, 0x38, 0x00, //           ###           
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x00, 0x00, //      ###                
-    0x0E, 0x00, 0x00, //     ###                 
-    0x1C, 0x00, 0x00, //    ###                  
-    0x38, 0x00, 0x00, //   ###                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: [ (ord 91) at offset 60 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x0F, 0xFC, 0x00, //     ##########          
-    0x0F, 0xFC, 0x00, //     ##########          
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0xF8, 0x00, //     #########           
-    0x0F, 0xFC, 0x00, //     ##########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: \\ (ord 92) at offset 61 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x1E, 0x00, 0x00, //    ####                 
-    0x1E, 0x00, 0x00, //    ####                 
-    0x0F, 0x00, 0x00, //     ####                
-    0x0F, 0x00, 0x00, //     ####                
-    0x07, 0x00, 0x00, //      ###                
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0xE0, 0x00, //         ###             
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0x78, 0x00, //          ####           
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ] (ord 93) at offset 62 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x0F, 0xFC, 0x00, //     ##########          
-    0x0F, 0xFC, 0x00, //     ##########          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x3C, 0x00, //           ####          
-    0x07, 0xFC, 0x00, //      #########          
-    0x0F, 0xFC, 0x00, //     ##########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ^ (ord 94) at offset 63 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x03, 0xC0, 0x00, //       ####              
-    0x07, 0xE0, 0x00, //      ######             
-    0x0F, 0x70, 0x00, //     #### ###            
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: _ (ord 95) at offset 64 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ` (ord 96) at offset 65 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x0E, 0x00, 0x00, //     ###                 
-    0x0F, 0x00, 0x00, //     ####                
-    0x07, 0x00, 0x00, //      ###                
-    0x03, 0x80, 0x00, //       ###               
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: a (ord 97) at offset 66 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x3F, 0xFC, 0x00, //   ############          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x00, 0x1F, 0x00, //            #####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: b (ord 98) at offset 67 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: c (ord 99) at offset 68 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: d (ord 100) at offset 69 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: e (ord 101) at offset 70 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFE, 0x00, //    ############         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: f (ord 102) at offset 71 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x7F, 0x80, //          ########       
-    0x00, 0xFF, 0x80, //         #########       
-    0x01, 0xE0, 0x00, //        ####             
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0xE0, 0x00, //       #####             
-    0x3F, 0xFE, 0x00, //   #############         
-    0x3F, 0xFC, 0x00, //   ############          
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: g (ord 103) at offset 72 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFF, 0x00, //    #############        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1E, 0x00, //            ####         
-    0x3F, 0xFC, 0x00, //   ############          
-    0x3F, 0xF8, 0x00, //   ###########           
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: h (ord 104) at offset 73 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: i (ord 105) at offset 74 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x0F, 0xC0, 0x00, //     ######              
-    0x07, 0xC0, 0x00, //      #####              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x07, 0xF0, 0x00, //      #######            
-    0x0F, 0xF0, 0x00, //     ########            
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: j (ord 106) at offset 75 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x7E, 0x00, //          ######         
-    0x00, 0x7E, 0x00, //          ######         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x1E, 0x00, //            ####         
-    0x38, 0x1E, 0x00, //   ###      ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0F, 0xF8, 0x00, //     #########           
-    0x07, 0xF0, 0x00, //      #######            
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: k (ord 107) at offset 76 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x00, 0x00, //   ####                  
-    0x3C, 0x0E, 0x00, //   ####      ###         
-    0x3C, 0x1C, 0x00, //   ####     ###          
-    0x3C, 0x38, 0x00, //   ####    ###           
-    0x3C, 0x70, 0x00, //   ####   ###            
-    0x3C, 0xE0, 0x00, //   ####  ###             
-    0x3D, 0xC0, 0x00, //   #### ###              
-    0x3F, 0x80, 0x00, //   #######               
-    0x3F, 0x80, 0x00, //   #######               
-    0x3F, 0x80, 0x00, //   #######               
-    0x3D, 0xC0, 0x00, //   #### ###              
-    0x3C, 0xE0, 0x00, //   ####  ###             
-    0x3C, 0x70, 0x00, //   ####   ###            
-    0x3C, 0x3C, 0x00, //   ####    ####          
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x0F, 0x00, //   ####      ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: l (ord 108) at offset 77 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x0F, 0xC0, 0x00, //     ######              
-    0x0F, 0xC0, 0x00, //     ######              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x07, 0xF0, 0x00, //      #######            
-    0x0F, 0xF0, 0x00, //     ########            
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: m (ord 109) at offset 78 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x79, 0xDF, 0x00, //  ####  ### #####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: n (ord 110) at offset 79 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: o (ord 111) at offset 80 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: p (ord 112) at offset 81 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x7F, 0xFE, 0x00, //  ##############         
-    0x7F, 0xFC, 0x00, //  #############          
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x70, 0x00, 0x00, //  ###                    
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: q (ord 113) at offset 82 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFF, 0x00, //    #############        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: r (ord 114) at offset 83 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7B, 0xFF, 0x00, //  #### ##########        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0x00, 0x00, //  #######                
-    0x7E, 0x00, 0x00, //  ######                 
-    0x7C, 0x00, 0x00, //  #####                  
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: s (ord 115) at offset 84 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x7C, 0x00, 0x00, //  #####                  
-    0x3F, 0xF8, 0x00, //   ###########           
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x0F, 0xFE, 0x00, //     ###########         
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: t (ord 116) at offset 85 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x80, 0x00, //      ####               
-    0x7F, 0xFC, 0x00, //  #############          
-    0x7F, 0xF8, 0x00, //  ############           
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0xC0, 0x00, //       ####              
-    0x01, 0xFF, 0x00, //        #########        
-    0x00, 0xFF, 0x00, //         ########        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: u (ord 117) at offset 86 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: v (ord 118) at offset 87 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0E, 0x38, 0x00, //     ###   ###           
-    0x0F, 0x70, 0x00, //     #### ###            
-    0x07, 0x70, 0x00, //      ### ###            
-    0x03, 0xE0, 0x00, //       #####             
-    0x03, 0xE0, 0x00, //       #####             
-    0x03, 0xE0, 0x00, //       #####             
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: w (ord 119) at offset 88 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x79, 0xCF, 0x00, //  ####  ###  ####        
-    0x7D, 0xDF, 0x00, //  ##### ### #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: x (ord 120) at offset 89 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0F, 0x70, 0x00, //     #### ###            
-    0x07, 0xE0, 0x00, //      ######             
-    0x03, 0xE0, 0x00, //       #####             
-    0x07, 0xF0, 0x00, //      #######            
-    0x0F, 0x78, 0x00, //     #### ####           
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x3C, 0x1E, 0x00, //   ####     ####         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: y (ord 121) at offset 90 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x1E, 0x00, //            ####         
-    0x3F, 0xFC, 0x00, //   ############          
-    0x3F, 0xF8, 0x00, //   ###########           
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: z (ord 122) at offset 91 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x1E, 0x00, //            ####         
-    0x00, 0x3C, 0x00, //           ####          
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x80, 0x00, //      ####               
-    0x0F, 0x00, 0x00, //     ####                
-    0x1E, 0x00, 0x00, //    ####                 
-    0x3C, 0x00, 0x00, //   ####                  
-    0x78, 0x00, 0x00, //  ####                   
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: { (ord 123) at offset 92 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0xFC, 0x00, //         ######          
-    0x01, 0xFC, 0x00, //        #######          
-    0x03, 0xC0, 0x00, //       ####              
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x3F, 0x00, 0x00, //   ######                
-    0x3F, 0x00, 0x00, //   ######                
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0x80, 0x00, //       ###               
-    0x03, 0xC0, 0x00, //       ####              
-    0x01, 0xF8, 0x00, //        ######           
-    0x00, 0xFC, 0x00, //         ######          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: | (ord 124) at offset 93 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: } (ord 125) at offset 94 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x3F, 0x00, 0x00, //   ######                
-    0x3F, 0x80, 0x00, //   #######               
-    0x03, 0xC0, 0x00, //       ####              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0xFC, 0x00, //         ######          
-    0x00, 0xFC, 0x00, //         ######          
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0xC0, 0x00, //       ####              
-    0x3F, 0x80, 0x00, //   #######               
-    0x3F, 0x00, 0x00, //   ######                
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ~ (ord 126) at offset 95 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0x0F, 0x00, //    #####    ####        
-    0x3F, 0x8F, 0x00, //   #######   ####        
-    0x7B, 0xCF, 0x00, //  #### ####  ####        
-    0x79, 0xEF, 0x00, //  ####  #### ####        
-    0x78, 0xFE, 0x00, //  ####   #######         
-    0x78, 0x7C, 0x00, //  ####    #####          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ° (ord 186) at offset 96 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x0F, 0xF8, 0x00, //     #########           
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x0F, 0xF8, 0x00, //     #########           
-    0x07, 0xF0, 0x00, //      #######            
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ² (ord 178) at offset 97 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x07, 0xF0, 0x00, //      #######            
-    0x0F, 0xF8, 0x00, //     #########           
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x38, 0x00, //    ####   ###           
-    0x00, 0x70, 0x00, //          ###            
-    0x00, 0xE0, 0x00, //         ###             
-    0x01, 0xC0, 0x00, //        ###              
-    0x03, 0x80, 0x00, //       ###               
-    0x07, 0x00, 0x00, //      ###                
-    0x0F, 0x00, 0x00, //     ####                
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x0F, 0xF8, 0x00, //     #########           
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ³ (ord 179) at offset 98 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x07, 0xF0, 0x00, //      #######            
-    0x0F, 0xF8, 0x00, //     #########           
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x0E, 0x3C, 0x00, //     ###   ####          
-    0x00, 0x38, 0x00, //           ###           
-    0x01, 0xF0, 0x00, //        #####            
-    0x01, 0xF0, 0x00, //        #####            
-    0x00, 0x38, 0x00, //           ###           
-    0x00, 0x3C, 0x00, //           ####          
-    0x0C, 0x3C, 0x00, //     ##    ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0F, 0xF8, 0x00, //     #########           
-    0x07, 0xF0, 0x00, //      #######            
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: µ (ord 181) at offset 99 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x1F, 0x00, //  ####      #####        
-    0x78, 0x3F, 0x00, //  ####     ######        
-    0x78, 0x7F, 0x00, //  ####    #######        
-    0x7F, 0xEF, 0x00, //  ########## ####        
-    0x7F, 0xCF, 0x00, //  #########  ####        
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x78, 0x00, 0x00, //  ####                   
-    0x70, 0x00, 0x00, //  ###                    
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ± (ord 177) at offset 100 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x01, 0xC0, 0x00, //        ###              
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: Ä (ord 196) at offset 101 */
-    0x00, 0x00, 0x00, //                         
-    0x1E, 0x38, 0x00, //    ####   ###           
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0C, 0x38, 0x00, //     ##    ###           
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x7F, 0xFF, 0x00, //  ###############        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: Ö (ord 214) at offset 102 */
-    0x00, 0x00, 0x00, //                         
-    0x1E, 0x38, 0x00, //    ####   ###           
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0C, 0x38, 0x00, //     ##    ###           
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: Ü (ord 220) at offset 103 */
-    0x00, 0x00, 0x00, //                         
-    0x1E, 0x38, 0x00, //    ####   ###           
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x0C, 0x38, 0x00, //     ##    ###           
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ä (ord 228) at offset 104 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x3F, 0xFC, 0x00, //   ############          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x00, 0x1F, 0x00, //            #####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x00, 0x0F, 0x00, //             ####        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ö (ord 246) at offset 105 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x3F, 0xFE, 0x00, //   #############         
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x1F, 0x00, //  #####     #####        
-    0x3F, 0xFE, 0x00, //   #############         
-    0x1F, 0xFC, 0x00, //    ###########          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    /* Next character: ü (ord 252) at offset 106 */
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x1E, 0x3C, 0x00, //    ####   ####          
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x78, 0x0F, 0x00, //  ####       ####        
-    0x7C, 0x0F, 0x00, //  #####      ####        
-    0x3F, 0xFF, 0x00, //   ##############        
-    0x1F, 0xFF, 0x00, //    #############        
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
-    0x00, 0x00, 0x00, //                         
+static const uint8_t terminus38bold_data[] = {
+    /* U+0020 (space): 0x0 at 0/0 */
+    /* U+0021 !: 3x22 at 7/7 */
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ...
+    // ...
+    // ...
+    // ...
+    // ###
+    // ###
+    // ###
+    // ###
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xc0,
+    /* U+0022 ": 11x6 at 3/5 */
+    // ####...####
+    // ####...####
+    // ####...####
+    // ####...####
+    // ####...####
+    // ####...####
+    0xf1, 0xfe, 0x3f, 0xc7, 0xf8, 0xff, 0x1f, 0xe3, 0xc0,
+    /* U+0023 #: 15x22 at 1/7 */
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ##############.
+    // ###############
+    // ##############.
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ##############.
+    // ###############
+    // ##############.
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    0x3c, 0x78, 0x78, 0xf0, 0xf1, 0xe1, 0xe3, 0xc3, 0xc7, 0x9f, 0xff, 0xbf,
+    0xff, 0xff, 0xfe, 0x3c, 0x78, 0x78, 0xf0, 0xf1, 0xe1, 0xe3, 0xc3, 0xc7,
+    0x87, 0x8f, 0x3f, 0xff, 0x7f, 0xff, 0xff, 0xfc, 0x78, 0xf0, 0xf1, 0xe1,
+    0xe3, 0xc3, 0xc7, 0x87, 0x8f, 0x00,
+    /* U+0024 $: 15x27 at 1/5 */
+    // ......###......
+    // ......###......
+    // ......###......
+    // ..###########..
+    // .#############.
+    // #####.###.#####
+    // ####..###..####
+    // ####..###......
+    // ####..###......
+    // ####..###......
+    // ####..###......
+    // #####.###......
+    // .############..
+    // ..############.
+    // ......###.#####
+    // ......###..####
+    // ......###..####
+    // ......###..####
+    // ......###..####
+    // ####..###..####
+    // #####.###.#####
+    // .#############.
+    // ..###########..
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    0x03, 0x80, 0x07, 0x00, 0x0e, 0x01, 0xff, 0xc7, 0xff, 0xdf, 0x77, 0xfc,
+    0xe7, 0xf9, 0xc0, 0xf3, 0x81, 0xe7, 0x03, 0xce, 0x07, 0xdc, 0x07, 0xff,
+    0x87, 0xff, 0x80, 0xef, 0x81, 0xcf, 0x03, 0x9e, 0x07, 0x3c, 0x0e, 0x7f,
+    0x9c, 0xff, 0xbb, 0xef, 0xff, 0x8f, 0xfe, 0x01, 0xc0, 0x03, 0x80, 0x07,
+    0x00, 0x0e, 0x00,
+    /* U+0025 %: 14x22 at 2/7 */
+    // .######...####
+    // ########..####
+    // ####.###.####.
+    // ####.###.####.
+    // ############..
+    // .######.####..
+    // ..#####.###...
+    // .......###....
+    // .......###....
+    // ......###.....
+    // ......###.....
+    // .....###......
+    // .....###......
+    // ....###.......
+    // ....###.......
+    // ...####.......
+    // ..####.######.
+    // ..############
+    // .####.###.####
+    // .####.###.####
+    // ####..########
+    // ####...######.
+    0x7e, 0x3f, 0xfc, 0xff, 0x77, 0xbd, 0xde, 0xff, 0xf1, 0xfb, 0xc3, 0xee,
+    0x00, 0x70, 0x01, 0xc0, 0x0e, 0x00, 0x38, 0x01, 0xc0, 0x07, 0x00, 0x38,
+    0x00, 0xe0, 0x07, 0x80, 0x3d, 0xf8, 0xff, 0xf7, 0xbb, 0xde, 0xef, 0xf3,
+    0xff, 0xc7, 0xe0,
+    /* U+0026 &: 16x22 at 1/7 */
+    // ...#######......
+    // ..#########.....
+    // .####....###....
+    // .####....####...
+    // .####....####...
+    // .####....####...
+    // .####....####...
+    // ..###....###....
+    // ...###..###.....
+    // ...#######......
+    // ...######.......
+    // ..########...###
+    // .####...###.####
+    // ####.....######.
+    // ####......####..
+    // ####......####..
+    // ####......####..
+    // ####......####..
+    // ####......####..
+    // #####....######.
+    // .##########.####
+    // ..########..####
+    0x1f, 0xc0, 0x3f, 0xe0, 0x78, 0x70, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x38, 0x70, 0x1c, 0xe0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0xc7,
+    0x78, 0xef, 0xf0, 0x7e, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf8, 0x7e, 0x7f, 0xef, 0x3f, 0xcf,
+    /* U+0027 ': 3x6 at 7/5 */
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    0xff, 0xff, 0xc0,
+    /* U+0028 (: 8x22 at 4/7 */
+    // .....###
+    // ....###.
+    // ...###..
+    // ..###...
+    // ..###...
+    // .###....
+    // ####....
+    // ####....
+    // ####....
+    // ####....
+    // ####....
+    // ####....
+    // ####....
+    // ####....
+    // ####....
+    // ####....
+    // .###....
+    // ..###...
+    // ..###...
+    // ...###..
+    // ....###.
+    // .....###
+    0x07, 0x0e, 0x1c, 0x38, 0x38, 0x70, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0x70, 0x38, 0x38, 0x1c, 0x0e, 0x07,
+    /* U+0029 ): 7x22 at 5/7 */
+    // ###....
+    // .###...
+    // ..###..
+    // ...###.
+    // ...###.
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ....###
+    // ...###.
+    // ...###.
+    // ..###..
+    // .###...
+    // ###....
+    0xe0, 0xe0, 0xe0, 0xe1, 0xc1, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x70, 0xe1,
+    0xc3, 0x87, 0x0e, 0x38, 0x71, 0xc7, 0x1c, 0x00,
+    /* U+002A *: 15x14 at 1/11 */
+    // .###......###..
+    // ..###....####..
+    // ...###...###...
+    // ....###.###....
+    // .....#####.....
+    // ......###......
+    // ###############
+    // ###############
+    // ......###......
+    // .....#####.....
+    // ....###.###....
+    // ...###..####...
+    // ..###....####..
+    // .###......###..
+    0x70, 0x38, 0x70, 0xf0, 0x71, 0xc0, 0x77, 0x00, 0x7c, 0x00, 0x70, 0x3f,
+    0xff, 0xff, 0xff, 0x03, 0x80, 0x0f, 0x80, 0x3b, 0x80, 0xe7, 0x83, 0x87,
+    0x8e, 0x07, 0x00,
+    /* U+002B +: 15x14 at 1/11 */
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ###############
+    // ###############
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x3f,
+    0xff, 0xff, 0xff, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38,
+    0x00, 0x70, 0x00,
+    /* U+002C ,: 5x7 at 5/25 */
+    // ..###
+    // ..###
+    // ..###
+    // ..###
+    // .###.
+    // ###..
+    // ##...
+    0x39, 0xce, 0x77, 0x73, 0x00,
+    /* U+002D -: 15x2 at 1/17 */
+    // ###############
+    // ###############
+    0xff, 0xff, 0xff, 0xfc,
+    /* U+002E .: 3x4 at 7/25 */
+    // ###
+    // ###
+    // ###
+    // ###
+    0xff, 0xf0,
+    /* U+002F: 14x22 at 2/7 */
+    // ..........####
+    // ..........####
+    // .........####.
+    // .........####.
+    // ........####..
+    // ........####..
+    // ........###...
+    // .......###....
+    // .......###....
+    // ......###.....
+    // ......###.....
+    // .....###......
+    // .....###......
+    // ....###.......
+    // ....###.......
+    // ...####.......
+    // ..####........
+    // ..####........
+    // .####.........
+    // .####.........
+    // ####..........
+    // ####..........
+    0x00, 0x3c, 0x00, 0xf0, 0x07, 0x80, 0x1e, 0x00, 0xf0, 0x03, 0xc0, 0x0e,
+    0x00, 0x70, 0x01, 0xc0, 0x0e, 0x00, 0x38, 0x01, 0xc0, 0x07, 0x00, 0x38,
+    0x00, 0xe0, 0x07, 0x80, 0x3c, 0x00, 0xf0, 0x07, 0x80, 0x1e, 0x00, 0xf0,
+    0x03, 0xc0, 0x00,
+    /* U+0030 0: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####......#####
+    // ####.....######
+    // ####....#######
+    // ####...###.####
+    // ####..###..####
+    // ####.###...####
+    // #######....####
+    // ######.....####
+    // #####......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x0f, 0xf8, 0x3f, 0xf0, 0xff, 0xe3, 0xbf, 0xce, 0x7f, 0xb8, 0xff, 0xe1,
+    0xff, 0x83, 0xfe, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0031 1: 11x22 at 3/7 */
+    // ....###....
+    // ...####....
+    // ..#####....
+    // #######....
+    // #######....
+    // ...####....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ....###....
+    // ##########.
+    // ###########
+    0x0e, 0x03, 0xc0, 0xf8, 0x7f, 0x0f, 0xe0, 0x3c, 0x03, 0x80, 0x70, 0x0e,
+    0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01,
+    0xc0, 0x38, 0x07, 0x0f, 0xfd, 0xff, 0xc0,
+    /* U+0032 2: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ###........####
+    // ...........####
+    // ..........####.
+    // .........####..
+    // ........###....
+    // .......###.....
+    // ......###......
+    // .....###.......
+    // ....####.......
+    // ...####........
+    // ..####.........
+    // .####..........
+    // ####...........
+    // ###############
+    // ###############
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf0, 0x0f, 0x00, 0x1e, 0x00, 0x78, 0x01, 0xe0, 0x07, 0x00, 0x1c,
+    0x00, 0x70, 0x01, 0xc0, 0x07, 0x80, 0x1e, 0x00, 0x78, 0x01, 0xe0, 0x07,
+    0x80, 0x0f, 0xff, 0xff, 0xff, 0xc0,
+    /* U+0033 3: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ..........#####
+    // ...###########.
+    // ...###########.
+    // ..........#####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xe0, 0x03, 0xc0,
+    0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x7c, 0x7f, 0xf0, 0xff, 0xe0, 0x03,
+    0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0034 4: 15x22 at 1/7 */
+    // ...........####
+    // ..........#####
+    // .........######
+    // ........#######
+    // .......###.####
+    // ......###..####
+    // .....####..####
+    // ....####...####
+    // ...####....####
+    // ..####.....####
+    // .####......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ###############
+    // ###############
+    // ###############
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    0x00, 0x1e, 0x00, 0x7c, 0x01, 0xf8, 0x07, 0xf0, 0x1d, 0xe0, 0x73, 0xc1,
+    0xe7, 0x87, 0x8f, 0x1e, 0x1e, 0x78, 0x3d, 0xe0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3c, 0x00, 0x78,
+    0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0,
+    /* U+0035 5: 15x22 at 1/7 */
+    // ###############
+    // ###############
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // #############..
+    // ##############.
+    // ..........#####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ####.......####
+    // #####......####
+    // .#############.
+    // ..###########..
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xff, 0xf3, 0xff, 0xf0, 0x01, 0xf0, 0x01,
+    0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3f, 0xc0, 0x7f,
+    0xc0, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0036 6: 15x22 at 1/7 */
+    // ..############.
+    // .#############.
+    // #####..........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // #############..
+    // ##############.
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xfc, 0xff, 0xfb, 0xe0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xff, 0xf3, 0xff, 0xf7, 0x81, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0037 7: 15x22 at 1/7 */
+    // ###############
+    // ###############
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......###.
+    // .##.......####.
+    // ..........###..
+    // .........####..
+    // .........###...
+    // ........###....
+    // ........###....
+    // .......###.....
+    // .......###.....
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0x98,
+    0x0f, 0x00, 0x1c, 0x00, 0x78, 0x00, 0xe0, 0x03, 0x80, 0x07, 0x00, 0x1c,
+    0x00, 0x38, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
+    0x1c, 0x00, 0x38, 0x00, 0x70, 0x00,
+    /* U+0038 8: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xf0, 0x7d, 0xff, 0xf3, 0xff, 0xef, 0x83,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0039 9: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ..........#####
+    // .#############.
+    // .############..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xe0, 0x7b, 0xff, 0xf3, 0xff,
+    0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x78,
+    0x01, 0xf7, 0xff, 0xcf, 0xff, 0x00,
+    /* U+003A :: 3x15 at 7/14 */
+    // ###
+    // ###
+    // ###
+    // ###
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ###
+    // ###
+    // ###
+    // ###
+    0xff, 0xf0, 0x00, 0x00, 0x7f, 0xf8,
+    /* U+003B ;: 5x18 at 5/14 */
+    // ..###
+    // ..###
+    // ..###
+    // ..###
+    // .....
+    // .....
+    // .....
+    // .....
+    // .....
+    // .....
+    // .....
+    // ..###
+    // ..###
+    // ..###
+    // ..###
+    // .###.
+    // ###..
+    // ##...
+    0x39, 0xce, 0x70, 0x00, 0x00, 0x00, 0x00, 0x73, 0x9c, 0xee, 0xe6, 0x00,
+    /* U+003C <: 14x22 at 2/7 */
+    // ..........####
+    // .........####.
+    // ........####..
+    // .......###....
+    // ......###.....
+    // .....###......
+    // ....####......
+    // ...####.......
+    // ..####........
+    // .####.........
+    // ####..........
+    // ####..........
+    // .####.........
+    // ..####........
+    // ...####.......
+    // ....###.......
+    // .....###......
+    // ......###.....
+    // .......###....
+    // ........####..
+    // .........####.
+    // ..........####
+    0x00, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xf0,
+    0x07, 0x80, 0x3c, 0x01, 0xe0, 0x0f, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0,
+    0x01, 0xe0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x3c, 0x00,
+    0x78, 0x00, 0xf0,
+    /* U+003D =: 15x9 at 1/14 */
+    // ###############
+    // ###############
+    // ...............
+    // ...............
+    // ...............
+    // ...............
+    // ###############
+    // ###############
+    // .#############.
+    0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+    0xff, 0xff, 0xff, 0x7f, 0xfc,
+    /* U+003E >: 14x22 at 2/7 */
+    // ####..........
+    // .####.........
+    // ..####........
+    // ....###.......
+    // .....###......
+    // ......###.....
+    // ......####....
+    // .......####...
+    // ........####..
+    // .........####.
+    // ..........####
+    // ..........####
+    // .........####.
+    // ........####..
+    // .......####...
+    // .......###....
+    // ......###.....
+    // .....###......
+    // ....###.......
+    // ..####........
+    // .####.........
+    // ####..........
+    0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x0f, 0x00, 0x78, 0x03,
+    0xc0, 0x1e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x0f, 0x00, 0x78,
+    0x03, 0xc0, 0x00,
+    /* U+003F ?: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ###........###.
+    // ..........###..
+    // .........###...
+    // ........###....
+    // .......###.....
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ...............
+    // ...............
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf0, 0x0e, 0x00, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x38,
+    0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x1c, 0x00, 0x38, 0x00, 0x70, 0x00,
+    /* U+0040 @: 16x22 at 1/7 */
+    // ..############..
+    // .##############.
+    // #####.......####
+    // ####..........##
+    // ####...#########
+    // ####..##########
+    // ####.###########
+    // ####.####...####
+    // ####.###....####
+    // ####.###....####
+    // ####.###....####
+    // ####.###....####
+    // ####.###....####
+    // ####.###....####
+    // ####.####...####
+    // ####.#####.#####
+    // ####..##########
+    // ####...#####..##
+    // ####............
+    // #####...........
+    // .###############
+    // ..##############
+    0x3f, 0xfc, 0x7f, 0xfe, 0xf8, 0x0f, 0xf0, 0x03, 0xf1, 0xff, 0xf3, 0xff,
+    0xf7, 0xff, 0xf7, 0x8f, 0xf7, 0x0f, 0xf7, 0x0f, 0xf7, 0x0f, 0xf7, 0x0f,
+    0xf7, 0x0f, 0xf7, 0x0f, 0xf7, 0x8f, 0xf7, 0xdf, 0xf3, 0xff, 0xf1, 0xf3,
+    0xf0, 0x00, 0xf8, 0x00, 0x7f, 0xff, 0x3f, 0xff,
+    /* U+0041 A: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ###############
+    // ###############
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0xff, 0xff, 0xff,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0x80, 0xff, 0x01, 0xfe, 0x03, 0xc0,
+    /* U+0042 B: 15x22 at 1/7 */
+    // #############..
+    // ##############.
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......###.
+    // ####......###..
+    // #############..
+    // #############..
+    // ####......####.
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####......#####
+    // ##############.
+    // #############..
+    0xff, 0xf9, 0xff, 0xfb, 0xc0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0e, 0xf0, 0x39, 0xff, 0xf3, 0xff, 0xe7, 0x81, 0xef, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0x81, 0xff, 0xff, 0xdf, 0xff, 0x00,
+    /* U+0043 C: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00,
+    0x1e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0044 D: 15x22 at 1/7 */
+    // ##########.....
+    // #############..
+    // ####.....#####.
+    // ####......####.
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####......####.
+    // ####.....#####.
+    // #############..
+    // ##########.....
+    0xff, 0xc1, 0xff, 0xf3, 0xc1, 0xf7, 0x81, 0xef, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0xf7,
+    0x83, 0xef, 0xff, 0x9f, 0xf8, 0x00,
+    /* U+0045 E: 15x22 at 1/7 */
+    // ###############
+    // ###############
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ###########....
+    // ###########....
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ###############
+    // ###############
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xff, 0x87, 0xff, 0x0f, 0x00,
+    0x1e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0f, 0xff, 0xff, 0xff, 0xc0,
+    /* U+0046 F: 15x22 at 1/7 */
+    // ###############
+    // ###############
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ###########....
+    // ###########....
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xff, 0x87, 0xff, 0x0f, 0x00,
+    0x1e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0f, 0x00, 0x1e, 0x00, 0x00,
+    /* U+0047 G: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...########
+    // ####...########
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc7, 0xff, 0x8f, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0048 H: 15x22 at 1/7 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ###############
+    // ###############
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0x80, 0xff, 0x01, 0xfe, 0x03, 0xc0,
+    /* U+0049 I: 8x22 at 4/7 */
+    // ########
+    // ########
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // .#######
+    // ########
+    0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x7f, 0xff,
+    /* U+004A J: 16x22 at 1/7 */
+    // ........########
+    // ........########
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ..........####..
+    // ####......####..
+    // ####......####..
+    // ####......####..
+    // #####....#####..
+    // .############...
+    // ..#########.....
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf8, 0x7c, 0x7f, 0xf8, 0x3f, 0xe0,
+    /* U+004B K: 15x22 at 1/7 */
+    // ####........###
+    // ####.......####
+    // ####......####.
+    // ####.....####..
+    // ####....####...
+    // ####...####....
+    // ####..####.....
+    // ####.####......
+    // ########.......
+    // #######........
+    // ######.........
+    // ######.........
+    // #######........
+    // ########.......
+    // ####.####......
+    // ####..####.....
+    // ####...####....
+    // ####....####...
+    // ####.....####..
+    // ####......####.
+    // ####.......####
+    // ####........###
+    0xf0, 0x0f, 0xe0, 0x3f, 0xc0, 0xf7, 0x83, 0xcf, 0x0f, 0x1e, 0x3c, 0x3c,
+    0xf0, 0x7b, 0xc0, 0xff, 0x01, 0xfc, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xe0,
+    0x1f, 0xe0, 0x3d, 0xe0, 0x79, 0xe0, 0xf1, 0xe1, 0xe1, 0xe3, 0xc1, 0xe7,
+    0x81, 0xef, 0x01, 0xfe, 0x01, 0xc0,
+    /* U+004C L: 15x22 at 1/7 */
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ###############
+    // ###############
+    0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00,
+    0x1e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0f, 0xff, 0xff, 0xff, 0xc0,
+    /* U+004D M: 16x22 at 1/7 */
+    // ####........####
+    // ####........####
+    // #####......#####
+    // ######....######
+    // #######..#######
+    // #######..#######
+    // #######..#######
+    // ####.######.####
+    // ####..####..####
+    // ####..####..####
+    // ####...##...####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    0xf0, 0x0f, 0xf0, 0x0f, 0xf8, 0x1f, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f,
+    0xfe, 0x7f, 0xf7, 0xef, 0xf3, 0xcf, 0xf3, 0xcf, 0xf1, 0x8f, 0xf0, 0x0f,
+    0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f,
+    0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f,
+    /* U+004E N: 15x22 at 1/7 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // ######.....####
+    // #######....####
+    // ####.###...####
+    // ####..###..####
+    // ####...###.####
+    // ####....#######
+    // ####.....######
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfe,
+    0x07, 0xfe, 0x0f, 0xfe, 0x1f, 0xee, 0x3f, 0xce, 0x7f, 0x8e, 0xff, 0x0f,
+    0xfe, 0x0f, 0xfc, 0x0f, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0x80, 0xff, 0x01, 0xfe, 0x03, 0xc0,
+    /* U+004F O: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0050 P: 15x22 at 1/7 */
+    // #############..
+    // ##############.
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####......#####
+    // ##############.
+    // #############..
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    0xff, 0xf9, 0xff, 0xfb, 0xc0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0xff, 0xff, 0xef, 0xff,
+    0x9e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0f, 0x00, 0x1e, 0x00, 0x00,
+    /* U+0051 Q: 15x25 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####..###..####
+    // #####..########
+    // .#############.
+    // ..###########..
+    // ..........###..
+    // ...........###.
+    // ............##.
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xce, 0x7f,
+    0xcf, 0xf7, 0xff, 0xc7, 0xff, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0c,
+    /* U+0052 R: 15x22 at 1/7 */
+    // #############..
+    // ##############.
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####......#####
+    // ##############.
+    // #############..
+    // #######........
+    // ########.......
+    // ####.###.......
+    // ####..###......
+    // ####...###.....
+    // ####....###....
+    // ####.....####..
+    // ####......####.
+    // ####.......####
+    0xff, 0xf9, 0xff, 0xfb, 0xc0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0xff, 0xff, 0xef, 0xff,
+    0x9f, 0xc0, 0x3f, 0xc0, 0x7b, 0x80, 0xf3, 0x81, 0xe3, 0x83, 0xc3, 0x87,
+    0x83, 0xcf, 0x03, 0xde, 0x03, 0xc0,
+    /* U+0053 S: 15x22 at 1/7 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // #####..........
+    // .############..
+    // ..############.
+    // ..........#####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xe1, 0xff, 0xe0, 0x03,
+    0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0054 T: 15x22 at 1/7 */
+    // ###############
+    // ###############
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    0xff, 0xff, 0xff, 0xfc, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00,
+    0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38,
+    0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
+    0x1c, 0x00, 0x38, 0x00, 0x70, 0x00,
+    /* U+0055 U: 15x22 at 1/7 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+0056 V: 15x22 at 1/7 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // .###.......###.
+    // .####.....####.
+    // .####.....####.
+    // .####.....####.
+    // .####.....####.
+    // .####.....####.
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ...###...###...
+    // ...####.###....
+    // ...####.###....
+    // ....###.###....
+    // .....#####.....
+    // .....#####.....
+    // .....#####.....
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01, 0xee, 0x03, 0x9e,
+    0x0f, 0x3c, 0x1e, 0x78, 0x3c, 0xf0, 0x79, 0xe0, 0xf1, 0xe3, 0xc3, 0xc7,
+    0x87, 0x8f, 0x0f, 0x1e, 0x0e, 0x38, 0x1e, 0xe0, 0x3d, 0xc0, 0x3b, 0x80,
+    0x3e, 0x00, 0x7c, 0x00, 0xf8, 0x00,
+    /* U+0057 W: 16x22 at 1/7 */
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####........####
+    // ####...##...####
+    // ####..####..####
+    // ####..####..####
+    // ####.######.####
+    // ################
+    // #######..#######
+    // #######..#######
+    // ######....######
+    // #####......#####
+    // ####........####
+    // ####........####
+    0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f,
+    0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf1, 0x8f,
+    0xf3, 0xcf, 0xf3, 0xcf, 0xf7, 0xef, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f,
+    0xfc, 0x3f, 0xf8, 0x1f, 0xf0, 0x0f, 0xf0, 0x0f,
+    /* U+0058 X: 15x22 at 1/7 */
+    // ####.......####
+    // ####.......####
+    // .####.....####.
+    // .####.....####.
+    // ..####...####..
+    // ..####...####..
+    // ...###...###...
+    // ...####.###....
+    // ....###.###....
+    // .....#####.....
+    // .....#####.....
+    // .....#####.....
+    // .....#####.....
+    // ....###.###....
+    // ...####.###....
+    // ...###..####...
+    // ..####...####..
+    // ..####...####..
+    // .####.....####.
+    // .####.....####.
+    // ####.......####
+    // ####.......####
+    0xf0, 0x1f, 0xe0, 0x3d, 0xe0, 0xf3, 0xc1, 0xe3, 0xc7, 0x87, 0x8f, 0x07,
+    0x1c, 0x0f, 0x70, 0x0e, 0xe0, 0x0f, 0x80, 0x1f, 0x00, 0x3e, 0x00, 0x7c,
+    0x01, 0xdc, 0x07, 0xb8, 0x0e, 0x78, 0x3c, 0x78, 0x78, 0xf1, 0xe0, 0xf3,
+    0xc1, 0xef, 0x01, 0xfe, 0x03, 0xc0,
+    /* U+0059 Y: 15x22 at 1/7 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // .####.....####.
+    // .####.....####.
+    // ..###....####..
+    // ..####...####..
+    // ...###...###...
+    // ...####.###....
+    // ....###.###....
+    // .....#####.....
+    // .....#####.....
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7b, 0xc1, 0xe7, 0x83, 0xc7, 0x0f, 0x0f,
+    0x1e, 0x0e, 0x38, 0x1e, 0xe0, 0x1d, 0xc0, 0x1f, 0x00, 0x3e, 0x00, 0x38,
+    0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
+    0x1c, 0x00, 0x38, 0x00, 0x70, 0x00,
+    /* U+005A Z: 15x22 at 1/7 */
+    // ###############
+    // ###############
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........###.
+    // ..........###..
+    // .........###...
+    // ........###....
+    // .......###.....
+    // ......###......
+    // .....###.......
+    // ....###........
+    // ...###.........
+    // ..###..........
+    // .###...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ###############
+    // ###############
+    0xff, 0xff, 0xff, 0xfc, 0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0x80,
+    0x0e, 0x00, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xe0,
+    0x03, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0f, 0xff, 0xff, 0xff, 0xc0,
+    /* U+005B [: 10x22 at 4/7 */
+    // ##########
+    // ##########
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // ####......
+    // #########.
+    // ##########
+    0xff, 0xff, 0xff, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c,
+    0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03,
+    0xc0, 0xff, 0xbf, 0xf0,
+    /* U+005C \: 14x22 at 2/7 */
+    // ####..........
+    // ####..........
+    // .####.........
+    // .####.........
+    // ..####........
+    // ..####........
+    // ...###........
+    // ....###.......
+    // ....###.......
+    // .....###......
+    // .....###......
+    // ......###.....
+    // ......###.....
+    // .......###....
+    // .......###....
+    // .......####...
+    // ........####..
+    // ........####..
+    // .........####.
+    // .........####.
+    // ..........####
+    // ..........####
+    0xf0, 0x03, 0xc0, 0x07, 0x80, 0x1e, 0x00, 0x3c, 0x00, 0xf0, 0x01, 0xc0,
+    0x03, 0x80, 0x0e, 0x00, 0x1c, 0x00, 0x70, 0x00, 0xe0, 0x03, 0x80, 0x07,
+    0x00, 0x1c, 0x00, 0x78, 0x00, 0xf0, 0x03, 0xc0, 0x07, 0x80, 0x1e, 0x00,
+    0x3c, 0x00, 0xf0,
+    /* U+005D ]: 10x22 at 4/7 */
+    // ##########
+    // ##########
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // ......####
+    // .#########
+    // ##########
+    0xff, 0xff, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0,
+    0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c,
+    0x0f, 0x7f, 0xff, 0xf0,
+    /* U+005E ^: 15x6 at 1/5 */
+    // .....####......
+    // ....######.....
+    // ...####.###....
+    // ..####...####..
+    // .####.....####.
+    // ####.......####
+    0x07, 0x80, 0x1f, 0x80, 0x7b, 0x81, 0xe3, 0xc7, 0x83, 0xde, 0x03, 0xc0,
+    /* U+005F _: 15x3 at 1/30 */
+    // ##############.
+    // ###############
+    // ##############.
+    0xff, 0xfd, 0xff, 0xff, 0xff, 0xf0,
+    /* U+0060 `: 6x5 at 4/2 */
+    // ###...
+    // ####..
+    // .###..
+    // ..###.
+    // ...###
+    0xe3, 0xc7, 0x0e, 0x1c,
+    /* U+0061 a: 15x15 at 1/14 */
+    // .############..
+    // .#############.
+    // ..........#####
+    // ...........####
+    // ...........####
+    // ..#############
+    // .##############
+    // #####......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    0x7f, 0xf8, 0xff, 0xf8, 0x00, 0xf8, 0x00, 0xf0, 0x01, 0xe7, 0xff, 0xdf,
+    0xff, 0xfc, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x81,
+    0xef, 0xff, 0xcf, 0xff, 0x80,
+    /* U+0062 b: 15x22 at 1/7 */
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // #############..
+    // ##############.
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####......#####
+    // ##############.
+    // #############..
+    0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c,
+    0x00, 0x7f, 0xfc, 0xff, 0xfd, 0xe0, 0x7f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0x81, 0xff, 0xff, 0xdf, 0xff, 0x00,
+    /* U+0063 c: 15x15 at 1/14 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x00, 0x1e, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0xff, 0x83,
+    0xef, 0xff, 0x8f, 0xfe, 0x00,
+    /* U+0064 d: 15x22 at 1/7 */
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ..#############
+    // .##############
+    // #####......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    0x00, 0x1e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0,
+    0x07, 0x9f, 0xff, 0x7f, 0xff, 0xf0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc0, 0xf7, 0xff, 0xe7, 0xff, 0xc0,
+    /* U+0065 e: 15x15 at 1/14 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ###############
+    // ###############
+    // ##############.
+    // ####...........
+    // ####...........
+    // ####...........
+    // #####......####
+    // .##############
+    // ..############.
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x81,
+    0xef, 0xff, 0xcf, 0xff, 0x00,
+    /* U+0066 f: 15x22 at 2/7 */
+    // .......########
+    // ......#########
+    // .....####......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // ....#####......
+    // #############..
+    // ############...
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    0x01, 0xfe, 0x07, 0xfc, 0x1e, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x03,
+    0xe0, 0x7f, 0xfc, 0xff, 0xf0, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70,
+    0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+    0x38, 0x00, 0x70, 0x00, 0xe0, 0x00,
+    /* U+0067 g: 15x21 at 1/14 */
+    // ..#############
+    // .##############
+    // #####......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    // ...........####
+    // ...........####
+    // ...........####
+    // ..........####.
+    // .############..
+    // .###########...
+    0x3f, 0xfe, 0xff, 0xff, 0xe0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x81,
+    0xef, 0xff, 0xcf, 0xff, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0xf3,
+    0xff, 0xc7, 0xff, 0x00,
+    /* U+0068 h: 15x22 at 1/7 */
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // #############..
+    // ##############.
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c,
+    0x00, 0x7f, 0xfc, 0xff, 0xfd, 0xe0, 0x7f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0x80, 0xff, 0x01, 0xfe, 0x03, 0xc0,
+    /* U+0069 i: 8x22 at 4/7 */
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ........
+    // ........
+    // ........
+    // ######..
+    // .#####..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // .#######
+    // ########
+    0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0xfc, 0x7c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x7f, 0xff,
+    /* U+006A j: 13x28 at 2/7 */
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .............
+    // .............
+    // .............
+    // .......######
+    // .......######
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // .........####
+    // ###......####
+    // ####.....####
+    // ####.....####
+    // .####...####.
+    // ..#########..
+    // ...#######...
+    0x00, 0x78, 0x03, 0xc0, 0x1e, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x01, 0xf8, 0x03, 0xc0, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x3c, 0x01,
+    0xe0, 0x0f, 0x00, 0x78, 0x03, 0xc0, 0x1e, 0x00, 0xf0, 0x07, 0x80, 0x3f,
+    0x81, 0xfe, 0x0f, 0xf0, 0x7b, 0xc7, 0x8f, 0xf8, 0x3f, 0x80,
+    /* U+006B k: 14x22 at 2/7 */
+    // ####..........
+    // ####..........
+    // ####..........
+    // ####..........
+    // ####..........
+    // ####..........
+    // ####..........
+    // ####......###.
+    // ####.....###..
+    // ####....###...
+    // ####...###....
+    // ####..###.....
+    // ####.###......
+    // #######.......
+    // #######.......
+    // #######.......
+    // ####.###......
+    // ####..###.....
+    // ####...###....
+    // ####....####..
+    // ####.....####.
+    // ####......####
+    0xf0, 0x03, 0xc0, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0x00,
+    0x3c, 0x0e, 0xf0, 0x73, 0xc3, 0x8f, 0x1c, 0x3c, 0xe0, 0xf7, 0x03, 0xf8,
+    0x0f, 0xe0, 0x3f, 0x80, 0xf7, 0x03, 0xce, 0x0f, 0x1c, 0x3c, 0x3c, 0xf0,
+    0x7b, 0xc0, 0xf0,
+    /* U+006C l: 8x22 at 4/7 */
+    // ######..
+    // ######..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // ...###..
+    // .#######
+    // ########
+    0xfc, 0xfc, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x7f, 0xff,
+    /* U+006D m: 15x15 at 1/14 */
+    // #############..
+    // ##############.
+    // ####..###.#####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    0xff, 0xf9, 0xff, 0xfb, 0xce, 0xff, 0x9c, 0xff, 0x39, 0xfe, 0x73, 0xfc,
+    0xe7, 0xf9, 0xcf, 0xf3, 0x9f, 0xe7, 0x3f, 0xce, 0x7f, 0x9c, 0xff, 0x39,
+    0xfe, 0x73, 0xfc, 0xe7, 0x80,
+    /* U+006E n: 15x15 at 1/14 */
+    // #############..
+    // ##############.
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    0xff, 0xf9, 0xff, 0xfb, 0xc0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0x80,
+    /* U+006F o: 15x15 at 1/14 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x83,
+    0xef, 0xff, 0x8f, 0xfe, 0x00,
+    /* U+0070 p: 15x21 at 1/14 */
+    // #############..
+    // ##############.
+    // ####......#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####......#####
+    // ##############.
+    // #############..
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ###............
+    0xff, 0xf9, 0xff, 0xfb, 0xc0, 0xff, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x03,
+    0xff, 0xff, 0xbf, 0xfe, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0e, 0x00, 0x00,
+    /* U+0071 q: 15x21 at 1/14 */
+    // ..#############
+    // .##############
+    // #####......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    // ...........####
+    0x3f, 0xfe, 0xff, 0xff, 0xe0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x81,
+    0xef, 0xff, 0xcf, 0xff, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x78,
+    0x00, 0xf0, 0x01, 0xe0,
+    /* U+0072 r: 15x15 at 1/14 */
+    // ####.##########
+    // ###############
+    // #######........
+    // ######.........
+    // #####..........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    0xf7, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xe0, 0x0f, 0x80, 0x1e, 0x00, 0x3c,
+    0x00, 0x78, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00,
+    0x1e, 0x00, 0x3c, 0x00, 0x00,
+    /* U+0073 s: 15x15 at 1/14 */
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####...........
+    // ####...........
+    // #####..........
+    // .###########...
+    // ..###########..
+    // ...###########.
+    // ...........####
+    // ...........####
+    // ...........####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3f, 0xf8, 0xff, 0xfb, 0xe0, 0xff, 0x80, 0x0f, 0x00, 0x1f, 0x00, 0x1f,
+    0xfc, 0x1f, 0xfc, 0x1f, 0xfc, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xff, 0x83,
+    0xef, 0xff, 0x8f, 0xfe, 0x00,
+    /* U+0074 t: 15x22 at 1/7 */
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // ....####.......
+    // #############..
+    // ############...
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....###.......
+    // .....####......
+    // ......#########
+    // .......########
+    0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x03,
+    0xc0, 0x7f, 0xfc, 0xff, 0xf0, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70,
+    0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+    0x3c, 0x00, 0x3f, 0xe0, 0x3f, 0xc0,
+    /* U+0075 u: 15x15 at 1/14 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x81,
+    0xef, 0xff, 0xcf, 0xff, 0x80,
+    /* U+0076 v: 15x15 at 1/14 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // .####.....####.
+    // .####.....####.
+    // .####.....####.
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ...###...###...
+    // ...####.###....
+    // ....###.###....
+    // .....#####.....
+    // .....#####.....
+    // .....#####.....
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7b, 0xc1, 0xe7, 0x83, 0xcf, 0x07, 0x8f,
+    0x1e, 0x1e, 0x3c, 0x3c, 0x78, 0x38, 0xe0, 0x7b, 0x80, 0x77, 0x00, 0x7c,
+    0x00, 0xf8, 0x01, 0xf0, 0x00,
+    /* U+0077 w: 15x15 at 1/14 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // ####..###..####
+    // #####.###.#####
+    // .#############.
+    // ..###########..
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x39, 0xfe, 0x73, 0xfc,
+    0xe7, 0xf9, 0xcf, 0xf3, 0x9f, 0xe7, 0x3f, 0xce, 0x7f, 0x9c, 0xff, 0xbb,
+    0xef, 0xff, 0x8f, 0xfe, 0x00,
+    /* U+0078 x: 15x15 at 1/14 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // .####.....####.
+    // ..####...####..
+    // ...####.###....
+    // ....######.....
+    // .....#####.....
+    // ....#######....
+    // ...####.####...
+    // ..####...####..
+    // .####.....####.
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7b, 0xc1, 0xe3, 0xc7, 0x83, 0xdc, 0x03,
+    0xf0, 0x03, 0xe0, 0x0f, 0xe0, 0x3d, 0xe0, 0xf1, 0xe3, 0xc1, 0xef, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0x80,
+    /* U+0079 y: 15x21 at 1/14 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    // ...........####
+    // ...........####
+    // ...........####
+    // ..........####.
+    // .############..
+    // .###########...
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x81,
+    0xef, 0xff, 0xcf, 0xff, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0xf3,
+    0xff, 0xc7, 0xff, 0x00,
+    /* U+007A z: 15x15 at 1/14 */
+    // ###############
+    // ###############
+    // ..........####.
+    // .........####..
+    // ........###....
+    // .......###.....
+    // ......###......
+    // .....###.......
+    // ....####.......
+    // ...####........
+    // ..####.........
+    // .####..........
+    // ####...........
+    // ###############
+    // ###############
+    0xff, 0xff, 0xff, 0xfc, 0x00, 0xf0, 0x03, 0xc0, 0x0e, 0x00, 0x38, 0x00,
+    0xe0, 0x03, 0x80, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0x00,
+    0x1f, 0xff, 0xff, 0xff, 0x80,
+    /* U+007B {: 12x22 at 2/7 */
+    // ......######
+    // .....#######
+    // ....####....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ######......
+    // ######......
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....####....
+    // .....######.
+    // ......######
+    0x03, 0xf0, 0x7f, 0x0f, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0,
+    0x0e, 0x00, 0xe0, 0xfc, 0x0f, 0xc0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0,
+    0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xf0, 0x07, 0xe0, 0x3f,
+    /* U+007C |: 3x22 at 7/7 */
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    // ###
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    /* U+007D }: 12x22 at 2/7 */
+    // ######......
+    // #######.....
+    // ....####....
+    // .....###....
+    // .....###....
+    // .....###....
+    // .....###....
+    // .....###....
+    // .....###....
+    // .....###....
+    // ......######
+    // ......######
+    // .....###....
+    // .....###....
+    // .....###....
+    // .....###....
+    // .....###....
+    // .....###....
+    // .....###....
+    // ....####....
+    // #######.....
+    // ######......
+    0xfc, 0x0f, 0xe0, 0x0f, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70,
+    0x07, 0x00, 0x70, 0x03, 0xf0, 0x3f, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70,
+    0x07, 0x00, 0x70, 0x07, 0x00, 0xf0, 0xfe, 0x0f, 0xc0,
+    /* U+007E ~: 15x6 at 1/5 */
+    // ..#####....####
+    // .#######...####
+    // ####.####..####
+    // ####..####.####
+    // ####...#######.
+    // ####....#####..
+    0x3e, 0x1e, 0xfe, 0x3f, 0xde, 0x7f, 0x9e, 0xff, 0x1f, 0xde, 0x1f, 0x00,
+    /* U+00B0: 11x9 at 3/5 */
+    // .#########.
+    // ###########
+    // ####...####
+    // ####...####
+    // ####...####
+    // ####...####
+    // ###########
+    // .#########.
+    // ..#######..
+    0x7f, 0xdf, 0xff, 0xc7, 0xf8, 0xff, 0x1f, 0xe3, 0xff, 0xfb, 0xfe, 0x3f,
+    0x80,
+    /* U+00B1: 15x18 at 1/11 */
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ###############
+    // ###############
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ......###......
+    // ...............
+    // ...............
+    // ###############
+    // ###############
+    0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x3f,
+    0xff, 0xff, 0xff, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38,
+    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc,
+    /* U+00B2: 11x13 at 3/3 */
+    // ..#######..
+    // .#########.
+    // ###########
+    // ####...####
+    // ####...###.
+    // ......###..
+    // .....###...
+    // ....###....
+    // ...###.....
+    // ..###......
+    // .####......
+    // ###########
+    // .#########.
+    0x3f, 0x8f, 0xfb, 0xff, 0xf8, 0xff, 0x1c, 0x07, 0x01, 0xc0, 0x70, 0x1c,
+    0x07, 0x01, 0xe0, 0x7f, 0xf7, 0xfc,
+    /* U+00B3: 11x13 at 3/3 */
+    // ..#######..
+    // .#########.
+    // ###########
+    // .###...####
+    // .......###.
+    // ....#####..
+    // ....#####..
+    // .......###.
+    // .......####
+    // .##....####
+    // ####...####
+    // .#########.
+    // ..#######..
+    0x3f, 0x8f, 0xfb, 0xff, 0xb8, 0xf0, 0x1c, 0x1f, 0x03, 0xe0, 0x0e, 0x01,
+    0xec, 0x3f, 0xc7, 0xbf, 0xe3, 0xf8,
+    /* U+00B5: 15x21 at 1/14 */
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####......#####
+    // ####.....######
+    // ####....#######
+    // ##########.####
+    // #########..####
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ####...........
+    // ###............
+    0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0xff, 0x83, 0xff, 0x0f,
+    0xff, 0xfb, 0xff, 0xe7, 0xf8, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0e, 0x00, 0x00,
+    /* U+00C4: 15x28 at 1/1 */
+    // ..####...###...
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ...##....###...
+    // ...............
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ###############
+    // ###############
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    0x3c, 0x70, 0x78, 0xf0, 0xf1, 0xe1, 0xe3, 0xc1, 0x87, 0x00, 0x00, 0x0f,
+    0xfe, 0x3f, 0xfe, 0xf8, 0x3f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0,
+    0x3f, 0xc0, 0x7f, 0x80, 0xf0,
+    /* U+00D6: 15x28 at 1/1 */
+    // ..####...###...
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ...##....###...
+    // ...............
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3c, 0x70, 0x78, 0xf0, 0xf1, 0xe1, 0xe3, 0xc1, 0x87, 0x00, 0x00, 0x0f,
+    0xfe, 0x3f, 0xfe, 0xf8, 0x3f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xf0,
+    0x7d, 0xff, 0xf1, 0xff, 0xc0,
+    /* U+00DC: 15x28 at 1/1 */
+    // ..####...###...
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ...##....###...
+    // ...............
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3c, 0x70, 0x78, 0xf0, 0xf1, 0xe1, 0xe3, 0xc1, 0x87, 0x00, 0x00, 0x3c,
+    0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0x80, 0xff, 0x01, 0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xf0,
+    0x7d, 0xff, 0xf1, 0xff, 0xc0,
+    /* U+00E4: 15x22 at 1/7 */
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ...............
+    // ...............
+    // ...............
+    // .############..
+    // .#############.
+    // ..........#####
+    // ...........####
+    // ...........####
+    // ..#############
+    // .##############
+    // #####......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    0x3c, 0x78, 0x78, 0xf0, 0xf1, 0xe1, 0xe3, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0xfc, 0x7f, 0xfc, 0x00, 0x7c, 0x00, 0x78, 0x00, 0xf3, 0xff,
+    0xef, 0xff, 0xfe, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc0, 0xf7, 0xff, 0xe7, 0xff, 0xc0,
+    /* U+00F6: 15x22 at 1/7 */
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ...............
+    // ...............
+    // ...............
+    // ..###########..
+    // .#############.
+    // #####.....#####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####.....#####
+    // .#############.
+    // ..###########..
+    0x3c, 0x78, 0x78, 0xf0, 0xf1, 0xe1, 0xe3, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1f, 0xfc, 0x7f, 0xfd, 0xf0, 0x7f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc1, 0xf7, 0xff, 0xc7, 0xff, 0x00,
+    /* U+00FC: 15x22 at 1/7 */
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ..####...####..
+    // ...............
+    // ...............
+    // ...............
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // ####.......####
+    // #####......####
+    // .##############
+    // ..#############
+    0x3c, 0x78, 0x78, 0xf0, 0xf1, 0xe1, 0xe3, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f, 0x80, 0xff, 0x01,
+    0xfe, 0x03, 0xfc, 0x07, 0xf8, 0x0f, 0xf0, 0x1f, 0xe0, 0x3f, 0xc0, 0x7f,
+    0xc0, 0xf7, 0xff, 0xe7, 0xff, 0xc0,
+};
+
+static const struct fontglyph terminus38bold_glyphs[] = {
+    { .dataoff =     0, .w =  0, .h =  0, .xoff =  0, .yoff =  0, .advance = 19 }, /* U+0020 */
+    { .dataoff =     0, .w =  3, .h = 22, .xoff =  7, .yoff =  7, .advance = 19 }, /* U+0021 */
+    { .dataoff =     9, .w = 11, .h =  6, .xoff =  3, .yoff =  5, .advance = 19 }, /* U+0022 */
+    { .dataoff =    18, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0023 */
+    { .dataoff =    60, .w = 15, .h = 27, .xoff =  1, .yoff =  5, .advance = 19 }, /* U+0024 */
+    { .dataoff =   111, .w = 14, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+0025 */
+    { .dataoff =   150, .w = 16, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0026 */
+    { .dataoff =   194, .w =  3, .h =  6, .xoff =  7, .yoff =  5, .advance = 19 }, /* U+0027 */
+    { .dataoff =   197, .w =  8, .h = 22, .xoff =  4, .yoff =  7, .advance = 19 }, /* U+0028 */
+    { .dataoff =   219, .w =  7, .h = 22, .xoff =  5, .yoff =  7, .advance = 19 }, /* U+0029 */
+    { .dataoff =   239, .w = 15, .h = 14, .xoff =  1, .yoff = 11, .advance = 19 }, /* U+002A */
+    { .dataoff =   266, .w = 15, .h = 14, .xoff =  1, .yoff = 11, .advance = 19 }, /* U+002B */
+    { .dataoff =   293, .w =  5, .h =  7, .xoff =  5, .yoff = 25, .advance = 19 }, /* U+002C */
+    { .dataoff =   298, .w = 15, .h =  2, .xoff =  1, .yoff = 17, .advance = 19 }, /* U+002D */
+    { .dataoff =   302, .w =  3, .h =  4, .xoff =  7, .yoff = 25, .advance = 19 }, /* U+002E */
+    { .dataoff =   304, .w = 14, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+002F */
+    { .dataoff =   343, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0030 */
+    { .dataoff =   385, .w = 11, .h = 22, .xoff =  3, .yoff =  7, .advance = 19 }, /* U+0031 */
+    { .dataoff =   416, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0032 */
+    { .dataoff =   458, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0033 */
+    { .dataoff =   500, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0034 */
+    { .dataoff =   542, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0035 */
+    { .dataoff =   584, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0036 */
+    { .dataoff =   626, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0037 */
+    { .dataoff =   668, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0038 */
+    { .dataoff =   710, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0039 */
+    { .dataoff =   752, .w =  3, .h = 15, .xoff =  7, .yoff = 14, .advance = 19 }, /* U+003A */
+    { .dataoff =   758, .w =  5, .h = 18, .xoff =  5, .yoff = 14, .advance = 19 }, /* U+003B */
+    { .dataoff =   770, .w = 14, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+003C */
+    { .dataoff =   809, .w = 15, .h =  9, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+003D */
+    { .dataoff =   826, .w = 14, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+003E */
+    { .dataoff =   865, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+003F */
+    { .dataoff =   907, .w = 16, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0040 */
+    { .dataoff =   951, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0041 */
+    { .dataoff =   993, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0042 */
+    { .dataoff =  1035, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0043 */
+    { .dataoff =  1077, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0044 */
+    { .dataoff =  1119, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0045 */
+    { .dataoff =  1161, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0046 */
+    { .dataoff =  1203, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0047 */
+    { .dataoff =  1245, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0048 */
+    { .dataoff =  1287, .w =  8, .h = 22, .xoff =  4, .yoff =  7, .advance = 19 }, /* U+0049 */
+    { .dataoff =  1309, .w = 16, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+004A */
+    { .dataoff =  1353, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+004B */
+    { .dataoff =  1395, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+004C */
+    { .dataoff =  1437, .w = 16, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+004D */
+    { .dataoff =  1481, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+004E */
+    { .dataoff =  1523, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+004F */
+    { .dataoff =  1565, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0050 */
+    { .dataoff =  1607, .w = 15, .h = 25, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0051 */
+    { .dataoff =  1654, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0052 */
+    { .dataoff =  1696, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0053 */
+    { .dataoff =  1738, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0054 */
+    { .dataoff =  1780, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0055 */
+    { .dataoff =  1822, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0056 */
+    { .dataoff =  1864, .w = 16, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0057 */
+    { .dataoff =  1908, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0058 */
+    { .dataoff =  1950, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0059 */
+    { .dataoff =  1992, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+005A */
+    { .dataoff =  2034, .w = 10, .h = 22, .xoff =  4, .yoff =  7, .advance = 19 }, /* U+005B */
+    { .dataoff =  2062, .w = 14, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+005C */
+    { .dataoff =  2101, .w = 10, .h = 22, .xoff =  4, .yoff =  7, .advance = 19 }, /* U+005D */
+    { .dataoff =  2129, .w = 15, .h =  6, .xoff =  1, .yoff =  5, .advance = 19 }, /* U+005E */
+    { .dataoff =  2141, .w = 15, .h =  3, .xoff =  1, .yoff = 30, .advance = 19 }, /* U+005F */
+    { .dataoff =  2147, .w =  6, .h =  5, .xoff =  4, .yoff =  2, .advance = 19 }, /* U+0060 */
+    { .dataoff =  2151, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0061 */
+    { .dataoff =  2180, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0062 */
+    { .dataoff =  2222, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0063 */
+    { .dataoff =  2251, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0064 */
+    { .dataoff =  2293, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0065 */
+    { .dataoff =  2322, .w = 15, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+0066 */
+    { .dataoff =  2364, .w = 15, .h = 21, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0067 */
+    { .dataoff =  2404, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0068 */
+    { .dataoff =  2446, .w =  8, .h = 22, .xoff =  4, .yoff =  7, .advance = 19 }, /* U+0069 */
+    { .dataoff =  2468, .w = 13, .h = 28, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+006A */
+    { .dataoff =  2514, .w = 14, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+006B */
+    { .dataoff =  2553, .w =  8, .h = 22, .xoff =  4, .yoff =  7, .advance = 19 }, /* U+006C */
+    { .dataoff =  2575, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+006D */
+    { .dataoff =  2604, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+006E */
+    { .dataoff =  2633, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+006F */
+    { .dataoff =  2662, .w = 15, .h = 21, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0070 */
+    { .dataoff =  2702, .w = 15, .h = 21, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0071 */
+    { .dataoff =  2742, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0072 */
+    { .dataoff =  2771, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0073 */
+    { .dataoff =  2800, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+0074 */
+    { .dataoff =  2842, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0075 */
+    { .dataoff =  2871, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0076 */
+    { .dataoff =  2900, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0077 */
+    { .dataoff =  2929, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0078 */
+    { .dataoff =  2958, .w = 15, .h = 21, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+0079 */
+    { .dataoff =  2998, .w = 15, .h = 15, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+007A */
+    { .dataoff =  3027, .w = 12, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+007B */
+    { .dataoff =  3060, .w =  3, .h = 22, .xoff =  7, .yoff =  7, .advance = 19 }, /* U+007C */
+    { .dataoff =  3069, .w = 12, .h = 22, .xoff =  2, .yoff =  7, .advance = 19 }, /* U+007D */
+    { .dataoff =  3102, .w = 15, .h =  6, .xoff =  1, .yoff =  5, .advance = 19 }, /* U+007E */
+    { .dataoff =  3114, .w = 11, .h =  9, .xoff =  3, .yoff =  5, .advance = 19 }, /* U+00B0 */
+    { .dataoff =  3127, .w = 15, .h = 18, .xoff =  1, .yoff = 11, .advance = 19 }, /* U+00B1 */
+    { .dataoff =  3161, .w = 11, .h = 13, .xoff =  3, .yoff =  3, .advance = 19 }, /* U+00B2 */
+    { .dataoff =  3179, .w = 11, .h = 13, .xoff =  3, .yoff =  3, .advance = 19 }, /* U+00B3 */
+    { .dataoff =  3197, .w = 15, .h = 21, .xoff =  1, .yoff = 14, .advance = 19 }, /* U+00B5 */
+    { .dataoff =  3237, .w = 15, .h = 28, .xoff =  1, .yoff =  1, .advance = 19 }, /* U+00C4 */
+    { .dataoff =  3290, .w = 15, .h = 28, .xoff =  1, .yoff =  1, .advance = 19 }, /* U+00D6 */
+    { .dataoff =  3343, .w = 15, .h = 28, .xoff =  1, .yoff =  1, .advance = 19 }, /* U+00DC */
+    { .dataoff =  3396, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+00E4 */
+    { .dataoff =  3438, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+00F6 */
+    { .dataoff =  3480, .w = 15, .h = 22, .xoff =  1, .yoff =  7, .advance = 19 }, /* U+00FC */
+};
+
+static const struct fontrange terminus38bold_ranges[] = {
+    { .first = 0x0020, .count =  95, .glyph =   0 },
+    { .first = 0x00b0, .count =   4, .glyph =  95 },
+    { .first = 0x00b5, .count =   1, .glyph =  99 },
+    { .first = 0x00c4, .count =   1, .glyph = 100 },
+    { .first = 0x00d6, .count =   1, .glyph = 101 },
+    { .first = 0x00dc, .count =   1, .glyph = 102 },
+    { .first = 0x00e4, .count =   1, .glyph = 103 },
+    { .first = 0x00f6, .count =   1, .glyph = 104 },
+    { .first = 0x00fc, .count =   1, .glyph = 105 },
 };
 
 const struct font font_terminus38bold = {
-    .data   = terminus38bold_data,
-    .width  = 19,  /* Width */
-    .height = 38, /* Height */
-    .offsets = { /* Offsets to individual characters */
-          0, //   0
-          0, //   1
-          0, //   2
-          0, //   3
-          0, //   4
-          0, //   5
-          0, //   6
-          0, //   7
-          0, //   8
-          0, //   9
-          0, //  10
-          0, //  11
-          0, //  12
-          0, //  13
-          0, //  14
-          0, //  15
-          0, //  16
-          0, //  17
-          0, //  18
-          0, //  19
-          0, //  20
-          0, //  21
-          0, //  22
-          0, //  23
-          0, //  24
-          0, //  25
-          0, //  26
-          0, //  27
-          0, //  28
-          0, //  29
-          0, //  30
-          0, //  31
-          1, //  32
-          2, //  33
-          3, //  34
-          4, //  35
-          5, //  36
-          6, //  37
-          7, //  38
-          8, //  39
-          9, //  40
-         10, //  41
-         11, //  42
-         12, //  43
-         13, //  44
-         14, //  45
-         15, //  46
-         16, //  47
-         17, //  48
-         18, //  49
-         19, //  50
-         20, //  51
-         21, //  52
-         22, //  53
-         23, //  54
-         24, //  55
-         25, //  56
-         26, //  57
-         27, //  58
-         28, //  59
-         29, //  60
-         30, //  61
-         31, //  62
-         32, //  63
-         33, //  64
-         34, //  65
-         35, //  66
-         36, //  67
-         37, //  68
-         38, //  69
-         39, //  70
-         40, //  71
-         41, //  72
-         42, //  73
-         43, //  74
-         44, //  75
-         45, //  76
-         46, //  77
-         47, //  78
-         48, //  79
-         49, //  80
-         50, //  81
-         51, //  82
-         52, //  83
-         53, //  84
-         54, //  85
-         55, //  86
-         56, //  87
-         57, //  88
-         58, //  89
-         59, //  90
-         60, //  91
-         61, //  92
-         62, //  93
-         63, //  94
-         64, //  95
-         65, //  96
-         66, //  97
-         67, //  98
-         68, //  99
-         69, // 100
-         70, // 101
-         71, // 102
-         72, // 103
-         73, // 104
-         74, // 105
-         75, // 106
-         76, // 107
-         77, // 108
-         78, // 109
-         79, // 110
-         80, // 111
-         81, // 112
-         82, // 113
-         83, // 114
-         84, // 115
-         85, // 116
-         86, // 117
-         87, // 118
-         88, // 119
-         89, // 120
-         90, // 121
-         91, // 122
-         92, // 123
-         93, // 124
-         94, // 125
-         95, // 126
-          0, // 127
-          0, // 128
-          0, // 129
-          0, // 130
-          0, // 131
-          0, // 132
-          0, // 133
-          0, // 134
-          0, // 135
-          0, // 136
-          0, // 137
-          0, // 138
-          0, // 139
-          0, // 140
-          0, // 141
-          0, // 142
-          0, // 143
-          0, // 144
-          0, // 145
-          0, // 146
-          0, // 147
-          0, // 148
-          0, // 149
-          0, // 150
-          0, // 151
-          0, // 152
-          0, // 153
-          0, // 154
-          0, // 155
-          0, // 156
-          0, // 157
-          0, // 158
-          0, // 159
-          0, // 160
-          0, // 161
-          0, // 162
-          0, // 163
-          0, // 164
-          0, // 165
-          0, // 166
-          0, // 167
-          0, // 168
-          0, // 169
-          0, // 170
-          0, // 171
-          0, // 172
-          0, // 173
-          0, // 174
-          0, // 175
-          0, // 176
-        100, // 177
-         97, // 178
-         98, // 179
-          0, // 180
-         99, // 181
-          0, // 182
-          0, // 183
-          0, // 184
-          0, // 185
-         96, // 186
-          0, // 187
-          0, // 188
-          0, // 189
-          0, // 190
-          0, // 191
-          0, // 192
-          0, // 193
-          0, // 194
-          0, // 195
-        101, // 196
-          0, // 197
-          0, // 198
-          0, // 199
-          0, // 200
-          0, // 201
-          0, // 202
-          0, // 203
-          0, // 204
-          0, // 205
-          0, // 206
-          0, // 207
-          0, // 208
-          0, // 209
-          0, // 210
-          0, // 211
-          0, // 212
-          0, // 213
-        102, // 214
-          0, // 215
-          0, // 216
-          0, // 217
-          0, // 218
-          0, // 219
-        103, // 220
-          0, // 221
-          0, // 222
-          0, // 223
-          0, // 224
-          0, // 225
-          0, // 226
-          0, // 227
-        104, // 228
-          0, // 229
-          0, // 230
-          0, // 231
-          0, // 232
-          0, // 233
-          0, // 234
-          0, // 235
-          0, // 236
-          0, // 237
-          0, // 238
-          0, // 239
-          0, // 240
-          0, // 241
-          0, // 242
-          0, // 243
-          0, // 244
-          0, // 245
-        105, // 246
-          0, // 247
-          0, // 248
-          0, // 249
-          0, // 250
-          0, // 251
-        106, // 252
-          0, // 253
-          0, // 254
-          0, // 255
-    }
+    .data     = terminus38bold_data,
+    .glyphs   = terminus38bold_glyphs,
+    .ranges   = terminus38bold_ranges,
+    .nrranges = 9,
+    .width    = 19, /* widest advance */
+    .height   = 38, /* line height */
 };
 
@@ -2,6 +2,7 @@
  */
 #include "sdkconfig.h"
 #include <stdio.h>
+#include <string.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <esp_system.h>
@@ -16,6 +17,7 @@
 #include <math.h>
 #include <esp_netif.h>
 #include "console.h"
+#include "displaypages.h"
 #include "displays.h"
 #include "i2c.h"
 #include "lps35hw.h"
@@ -38,7 +40,7 @@ static const char *TAG = "foxesptemp";
 struct ev evs[2] = { [0 ... 1] = {
                      .hum = NAN, .press = NAN, .raing = NAN, .temp = NAN,
                      .pm010 = NAN, .pm025 = NAN, .pm040 = NAN, .pm100 = NAN,
-                     .co2 = 0xffff
+                     .vocidx = NAN, .noxidx = NAN, .co2 = 0xffff
                    } };
 int activeevs = 0;
 /* Has the firmware been marked as "good" yet, or is ist still pending
@@ -57,51 +59,31 @@ int forcesht4xheater = 0;
  * a lower temperature delta more often. */
 #define HEATERITS 3
 
-struct di_dispbuf * db; /* Our main display buffer (we currently only use one) */
-#define PAGE_TEMP  0
-#define PAGE_HUM   1
-#define PAGE_PRESS 2
-#define PAGE_CO2   3
-#define PAGE_PM010 4
-#define PAGE_PM025 5
-#define PAGE_PM040 6
-#define PAGE_PM100 7
-#define MAXDISPPAGES 8
+/* Time between two measurements, in seconds */
+#define MEASINTERVAL 60
+
 uint32_t ispageenabled = 0;
 
 /* we need this to display our IP, it is in network.c */
 extern esp_netif_t * mainnetif;
 
+/* Decides what to show next, and hands that to the display task. This
+ * never waits for the display. */
 void dodisplayupdate(void)
 {
     static int curdisppage = -2;
-    static uint8_t invertcounter = 0;
-    /* First clear the whole display */
-    di_drawrect(db, 0, 0, db->sizex - 1, db->sizey - 1, -1, 0x00, 0x00, 0x00);
-    if (curdisppage == -100) {
-      di_drawtext(db, 0,  0, &font_terminus16bold, 0xff, 0xff, 0xff, "ERROR:");
-      di_drawtext(db, 0, 16, &font_terminus13norm, 0xff, 0xff, 0xff, "No sensors seem to");
-      di_drawtext(db, 0, 32, &font_terminus13norm, 0xff, 0xff, 0xff, "be enabled at all,");
-      di_drawtext(db, 0, 48, &font_terminus13norm, 0xff, 0xff, 0xff, "nothing to show.");
-    } else if (curdisppage == -2) { /* The first startup message */
-      di_drawtext(db, 0,  0, &font_terminus13norm, 0xff, 0xff, 0xff, "Hi! I'm a display!");
-      di_drawtext(db, 0, 16, &font_terminus13norm, 0xff, 0xff, 0xff, "I will display mea-");
-      di_drawtext(db, 0, 32, &font_terminus13norm, 0xff, 0xff, 0xff, "surements as soon");
-      di_drawtext(db, 0, 48, &font_terminus13norm, 0xff, 0xff, 0xff, "as I have some.");
-    } else if (curdisppage == -1) { /* Show Firmware Ver and IP, fill ispageenabled array */
-      di_drawtext(db, 0,  0, &font_terminus13norm, 0xff, 0xff, 0xff, "~~~ FoxESPTemp ~~~");
-      di_drawtext(db, 0, 13, &font_terminus13norm, 0xff, 0xff, 0xff, "Firmware compiled");
+    struct dispsnap snap;
+    memset(&snap, 0, sizeof(snap));
+    snap.page = curdisppage;
+    snap.ev = evs[activeevs];
+    dp_gethist(curdisppage, snap.hist);
+    if (curdisppage == -1) { /* Get our IP, fill ispageenabled array */
       const esp_app_desc_t * appd = esp_app_get_description();
-      di_drawtext(db, 0, 26, &font_terminus13norm, 0xff, 0xff, 0xff, appd->date);
+      strlcpy(snap.fwdate, appd->date, sizeof(snap.fwdate));
       esp_netif_ip_info_t ip_info;
       if (esp_netif_get_ip_info(mainnetif, &ip_info) == ESP_OK) {
-        uint8_t ippfb[20];
-        sprintf(ippfb, IPSTR, IP2STR(&ip_info.ip));
-        di_drawtext(db, 0, 39, &font_terminus13norm, 0xff, 0xff, 0xff, ippfb);
-      } else {
-        di_drawtext(db, 0, 39, &font_terminus13norm, 0xff, 0xff, 0xff, "No IPv4 address");
+        sprintf(snap.ip, IPSTR, IP2STR(&ip_info.ip));
       }
-      di_drawtext(db, 0, 52, &font_terminus13norm, 0xff, 0xff, 0xff, "ABCabc.,_!0123456789");
       /* Fill the ispageenabled array depending on enabled sensors */
       if (settings.sht4x_i2cport > 0) {
         ispageenabled |= 1 << PAGE_TEMP;
@@ -109,92 +91,24 @@ void dodisplayupdate(void)
       }
       if (settings.lps35hw_i2cport > 0) { ispageenabled |= 1 << PAGE_PRESS; }
       if (settings.scd41_i2cport > 0) { ispageenabled |= 1 << PAGE_CO2; }
+      if ((settings.sen50_i2cport > 0) && (sen50_getvariant() >= 54)) {
+        /* SEN54 and SEN55 also measure temperature, humidity and VOCs */
+        ispageenabled |= 1 << PAGE_TEMP;
+        ispageenabled |= 1 << PAGE_HUM;
+        ispageenabled |= 1 << PAGE_VOC;
+      }
+      if ((settings.sen50_i2cport > 0) && (sen50_getvariant() == 55)) {
+        ispageenabled |= 1 << PAGE_NOX;
+      }
+      if (settings.sgp40_i2cport > 0) { ispageenabled |= 1 << PAGE_VOC; }
       if (settings.sen50_i2cport > 0) {
         /* we display only 2 of the 4 values we have, the others don't add much
          * in terms of information but use way too much screen time and space. */
         ispageenabled |= 1 << PAGE_PM010;
         ispageenabled |= 1 << PAGE_PM100;
       }
-    } else { /* curdisppage >= 0 - show values. */
-      uint8_t label[30]; uint8_t value[20]; uint8_t unit[20];
-      label[0] = 0; value[0] = 0; unit[0] = 0;
-      if (curdisppage == PAGE_TEMP) { /* Show temp */
-        strcpy(label, "Temperatur"); // we might want to translate this.
-        if (isnan(evs[activeevs].temp)) {
-          strcpy(value, "-.--");
-        } else {
-          sprintf(value, "%.2f", evs[activeevs].temp);
-        }
-        sprintf(unit, "%cC", 186);
-      } else if (curdisppage == PAGE_HUM) { /* Show humidity */
-        strcpy(label, "Luftfeuchtigkeit");
-        if (isnan(evs[activeevs].hum)) {
-          strcpy(value, "-.--");
-        } else {
-          sprintf(value, "%.2f", evs[activeevs].hum);
-        }
-        strcpy(unit, "%");
-      } else if (curdisppage == PAGE_PRESS) { /* Show pressure */
-        strcpy(label, "Luftdruck");
-        if (isnan(evs[activeevs].press)) {
-          strcpy(value, "---.--");
-        } else {
-          sprintf(value, "%.2f", evs[activeevs].press);
-        }
-        strcpy(unit, "hPa");
-      } else if (curdisppage == PAGE_CO2) { /* Show CO2 */
-        sprintf(label, "CO%c", 178);
-        if (evs[activeevs].co2 == 0xffff) { /* Invalid */
-          strcpy(value, "----");
-        } else {
-          sprintf(value, "%u", evs[activeevs].co2);
-        }
-        strcpy(unit, "ppm");
-      } else if ((curdisppage == PAGE_PM010)
-              || (curdisppage == PAGE_PM025)
-              || (curdisppage == PAGE_PM040)
-              || (curdisppage == PAGE_PM100)) { /* Show particulate matter */
-        strcpy(label, "Feinstaub PM 1.0");
-        float fv = evs[activeevs].pm010;
-        if (curdisppage == PAGE_PM025) {
-          strcpy(label, "Feinstaub PM 2.5");
-          fv = evs[activeevs].pm025;
-        } else if (curdisppage == PAGE_PM040) {
-          strcpy(label, "Feinstaub PM 4.0");
-          fv = evs[activeevs].pm040;
-        } else if (curdisppage == PAGE_PM100) {
-          strcpy(label, "Feinstaub PM 10");
-          fv = evs[activeevs].pm100;
-        }
-        if (isnan(fv)) {
-          strcpy(value, "--.-");
-        } else {
-          sprintf(value, "%.1f", fv);
-        }
-        sprintf(unit, "%cg/m%c", 181, 179);
-      }
-      /* Center the label */
-      int xpos = di_calctextcenter(&font_terminus16bold, 0, db->sizex - 1, label);
-      di_drawtext(db, xpos, 0, &font_terminus16bold, 0xff, 0xff, 0xff, label);
-      /* With the values + unit, it's a bit more complicated, because they
-       * are using different font sizes. */
-      int vwi = strlen(value) * font_terminus38bold.width
-              + strlen(unit) * font_terminus16bold.width;
-      xpos = ((int)db->sizex - vwi) / 2;
-      if (xpos < 0) { xpos = 0; }
-      di_drawtext(db, xpos, 20, &font_terminus38bold, 0xff, 0xff, 0xff, value);
-      xpos += strlen(value) * font_terminus38bold.width;
-      di_drawtext(db, xpos, 20, &font_terminus16bold, 0xff, 0xff, 0xff, unit);
-    }
-    /* We're switching between displaying all pixels as normal and as inverted
-     * to make sure all the pixels in our OLED are "on" for approximately the
-     * same amount of time, as otherwise they would have very different
-     * brightness levels as the display ages. */
-    if (invertcounter >= 0x80) {
-      di_invertall(db);
     }
-    invertcounter++;
-    di_display(db);
+    di_queueframe(&snap);
     int numcycles = 0;
     do {
       if (curdisppage > -100) { // <= -100 are error pages that should display permanently.
@@ -237,13 +151,15 @@ void app_main(void)
     sht4x_init();
     lps35hw_init();
     rg15_init();
-    scd41_init();
+    scd41_init(MEASINTERVAL);
     scd41_startmeas();
     sen50_init();
     sen50_startmeas(); /* FIXME Perhaps we don't want this on all the time. */
     sgp40_init();
-    di_init();  /* Initialize display */
-    db = di_newdispbuf();
+    sgp40_starttask();
+    /* Initialize display. That happens in the display task, in the
+     * background, as does all talking to the display. */
+    di_starttask(dp_drawframe, sizeof(struct dispsnap));
     dodisplayupdate();
     vTaskDelay(pdMS_TO_TICKS(3000)); /* Mainly to give the RG15 a chance to */
     /* process our initialization sequence, though that doesn't always work. */
@@ -254,6 +170,7 @@ void app_main(void)
     time_t lastsht4xheat = lastmeasts;
     time_t lastsuccsubmit = lastmeasts;
     time_t lastdispupd = lastmeasts;
+    int scd41triggered = 0;
 
     /* We do NTP to provide useful timestamps in our webserver output. */
     esp_sntp_setoperatingmode(SNTP_OPMODE_POLL);
@@ -304,14 +221,21 @@ void app_main(void)
         lastdispupd = lastmeasts;
       }
       time_t curts = time(NULL);
-      if ((curts - lastmeasts) >= 60) {
+      if ((scd41triggered == 0)
+       && ((curts - lastmeasts) >= (MEASINTERVAL - scd41_getleadtime()))) {
+        /* The SCD41 needs to start single shot measurements some
+         * seconds before we read them. */
+        scd41_trigger();
+        scd41triggered = 1;
+      }
+      if ((curts - lastmeasts) >= MEASINTERVAL) {
         lastmeasts = curts;
+        scd41triggered = 0;
         ESP_LOGI("main.c", "Telling sensors to sense...");
         /* Request update from the sensors that don't autoupdate all the time */
         lps35hw_startmeas();
         rg15_requestread();
         sht4x_startmeas();
-        sgp40_startmeasraw(25.0, 50.0);
         sleep_ms(1111); /* Slightly more than a second should be enough for all sensors */
         ESP_LOGI("main.c", "Reading sensors...");
         double press = lps35hw_readpressure();
@@ -341,6 +265,8 @@ void app_main(void)
           /* submit that measurement */
           evs[naevs].press = press;
           submit_queuevalue(ST_PRESSURE, press, 100);
+          /* The SCD41 uses this for its next measurement. */
+          scd41_setpressure(press);
         } else {
           evs[naevs].press = NAN;
         }
@@ -381,6 +307,8 @@ void app_main(void)
           }
           evs[naevs].temp = temphum.temp;
           evs[naevs].hum = temphum.hum;
+          /* The SGP40 task uses these for all its next measurements. */
+          sgp40_setcompensation(temphum.temp, temphum.hum);
           submit_queuevalue(ST_TEMPERATURE, temphum.temp, 100);
           submit_queuevalue(ST_HUMIDITY, temphum.hum, 100);
         } else {
@@ -413,19 +341,48 @@ void app_main(void)
           submit_queuevalue(ST_PM025, pmdata.pm025, 100);
           submit_queuevalue(ST_PM040, pmdata.pm040, 100);
           submit_queuevalue(ST_PM100, pmdata.pm100, 100);
+          /* The SEN54/SEN55 values are only used where we have nothing
+           * better, so they get a lower priority. */
+          if (!isnan(pmdata.temp) && !isnan(pmdata.hum)) {
+            ESP_LOGI(TAG, "SEN5x Temp: %.2f degC, Hum: %.2f %%", pmdata.temp, pmdata.hum);
+            if (isnan(evs[naevs].temp)) {
+              evs[naevs].temp = pmdata.temp;
+              evs[naevs].hum = pmdata.hum;
+              sgp40_setcompensation(pmdata.temp, pmdata.hum);
+            }
+            submit_queuevalue(ST_TEMPERATURE, pmdata.temp, 50);
+            submit_queuevalue(ST_HUMIDITY, pmdata.hum, 50);
+          }
+          if (!isnan(pmdata.noxidx)) {
+            ESP_LOGI(TAG, "NOx index: %.0f", pmdata.noxidx);
+            evs[naevs].noxidx = pmdata.noxidx;
+            submit_queuevalue(ST_NOXINDEX, pmdata.noxidx, 100);
+          } else {
+            evs[naevs].noxidx = NAN;
+          }
         } else {
           evs[naevs].pm010 = NAN;
           evs[naevs].pm025 = NAN;
           evs[naevs].pm040 = NAN;
           evs[naevs].pm100 = NAN;
+          evs[naevs].noxidx = NAN;
         }
 
-        if (vocdata.valid > 0) {
-          ESP_LOGI(TAG, "VOC: raw %x", vocdata.vocraw);
+        if ((vocdata.valid > 0) && (vocdata.vocindex > 0)) {
+          ESP_LOGI(TAG, "VOC index: %u (raw: %x)", vocdata.vocindex, vocdata.vocraw);
+          evs[naevs].vocidx = vocdata.vocindex;
+          submit_queuevalue(ST_VOCINDEX, vocdata.vocindex, 100);
+        } else if ((pmdata.valid > 0) && !isnan(pmdata.vocidx)) {
+          ESP_LOGI(TAG, "VOC index (SEN5x): %.0f", pmdata.vocidx);
+          evs[naevs].vocidx = pmdata.vocidx;
+          submit_queuevalue(ST_VOCINDEX, pmdata.vocidx, 50);
+        } else {
+          evs[naevs].vocidx = NAN;
         }
 
         /* Now mark the updated values as the current ones for the webserver */
         activeevs = naevs;
+        dp_addvalues(&evs[naevs]);
 
         /* submit values (if any). Record if we succeeded doing so. */
         ESP_LOGI(TAG, "submitting values to wetter.poempelfox.de...");
@@ -0,0 +1,541 @@
+
+/* Firmware updates (OTA - Over The Air). */
+
+#include <esp_crt_bundle.h>
+#include <esp_http_client.h>
+#include <esp_https_ota.h>
+#include <esp_log.h>
+#include <esp_ota_ops.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <psa/crypto.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ota.h"
+
+static struct ota_status otast = { .state = OTA_ST_IDLE, .imagesize = -1 };
+/* Protects otast, which is written by the OTA task and read by the webserver. */
+static portMUX_TYPE otastmux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t otaurl[200];
+/* State for uploaded images. Only accessed from whoever called
+ * ota_upload_begin successfully, so it does not need locking. */
+static esp_ota_handle_t uplotah;
+static const esp_partition_t * uplpart = NULL;
+static psa_hash_operation_t uplsha = PSA_HASH_OPERATION_INIT;
+static int uplexpsize = 0;
+static int uplwritten = 0;
+static int uplactive = 0; /* ota_upload_prepare succeeded, not finished/aborted yet */
+
+void ota_getstatus(struct ota_status * st)
+{
+  portENTER_CRITICAL(&otastmux);
+  memcpy(st, &otast, sizeof(struct ota_status));
+  portEXIT_CRITICAL(&otastmux);
+}
+
+static void ota_setprogress(int bytesdone, int imagesize)
+{
+  portENTER_CRITICAL(&otastmux);
+  otast.bytesdone = bytesdone;
+  otast.imagesize = imagesize;
+  otast.lastupdtime = esp_timer_get_time();
+  portEXIT_CRITICAL(&otastmux);
+}
+
+static void ota_setstate(uint8_t state, const uint8_t * msg)
+{
+  portENTER_CRITICAL(&otastmux);
+  otast.state = state;
+  strlcpy(otast.msg, msg, sizeof(otast.msg));
+  otast.lastupdtime = esp_timer_get_time();
+  portEXIT_CRITICAL(&otastmux);
+}
+
+/* Marks an update as running, unless there already is one.
+ * Returns ESP_ERR_INVALID_STATE in that case. */
+static esp_err_t ota_claim(const uint8_t * msg, int imagesize)
+{
+  portENTER_CRITICAL(&otastmux);
+  if (otast.state == OTA_ST_RUNNING) {
+    portEXIT_CRITICAL(&otastmux);
+    return ESP_ERR_INVALID_STATE;
+  }
+  otast.state = OTA_ST_RUNNING;
+  otast.bytesdone = 0;
+  otast.imagesize = imagesize;
+  otast.starttime = esp_timer_get_time();
+  otast.lastupdtime = otast.starttime;
+  strlcpy(otast.msg, msg, sizeof(otast.msg));
+  portEXIT_CRITICAL(&otastmux);
+  return ESP_OK;
+}
+
+/* Prepares the inactive partition for writing an image of imagesize bytes
+ * through ota_upload_write. The caller needs to have claimed the update. */
+static esp_err_t ota_upload_prepare(int imagesize)
+{
+  esp_err_t e;
+  uplpart = esp_ota_get_next_update_partition(NULL);
+  if (uplpart == NULL) {
+    ESP_LOGE("ota.c", "No OTA partition to write the update to.");
+    ota_setstate(OTA_ST_FAILED, "No OTA partition to write the update to.");
+    return ESP_ERR_NOT_FOUND;
+  }
+  if ((imagesize <= 0) || (imagesize > uplpart->size)) {
+    ESP_LOGE("ota.c", "Image size %d does not fit into OTA partition (%lu bytes).",
+             imagesize, (unsigned long)uplpart->size);
+    ota_setstate(OTA_ST_FAILED, "The image does not fit into the OTA partition.");
+    return ESP_ERR_INVALID_SIZE;
+  }
+  if ((psa_crypto_init() != PSA_SUCCESS)
+   || (psa_hash_setup(&uplsha, PSA_ALG_SHA_256) != PSA_SUCCESS)) {
+    ota_setstate(OTA_ST_FAILED, "Failed to initialize SHA-256 calculation.");
+    return ESP_FAIL;
+  }
+  /* Telling esp_ota_begin the size means it only erases what is needed. */
+  e = esp_ota_begin(uplpart, imagesize, &uplotah);
+  if (e != ESP_OK) {
+    ESP_LOGE("ota.c", "esp_ota_begin failed: %s", esp_err_to_name(e));
+    psa_hash_abort(&uplsha);
+    ota_setstate(OTA_ST_FAILED, "Failed to prepare the OTA partition.");
+    return e;
+  }
+  uplexpsize = imagesize;
+  uplwritten = 0;
+  uplactive = 1;
+  ESP_LOGI("ota.c", "Receiving uploaded image of %d bytes into partition %s",
+           imagesize, uplpart->label);
+  return ESP_OK;
+}
+
+esp_err_t ota_upload_begin(int imagesize)
+{
+  if (ota_claim("Receiving and flashing uploaded image.", imagesize) != ESP_OK) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  return ota_upload_prepare(imagesize);
+}
+
+esp_err_t ota_upload_write(const uint8_t * data, size_t len)
+{
+  if ((uplwritten + len) > uplexpsize) {
+    ota_upload_abort("Received more data than announced.");
+    return ESP_ERR_INVALID_SIZE;
+  }
+  psa_hash_update(&uplsha, data, len);
+  esp_err_t e = esp_ota_write(uplotah, data, len);
+  if (e != ESP_OK) {
+    ESP_LOGE("ota.c", "esp_ota_write failed: %s", esp_err_to_name(e));
+    ota_upload_abort("Writing to flash failed.");
+    return e;
+  }
+  uplwritten += len;
+  ota_setprogress(uplwritten, uplexpsize);
+  return ESP_OK;
+}
+
+esp_err_t ota_upload_finish(const uint8_t * expsha256, uint8_t * sha256out)
+{
+  uint8_t sha[32];
+  size_t shalen;
+  esp_err_t e;
+  if (uplwritten != uplexpsize) {
+    ota_upload_abort("Received less data than announced.");
+    return ESP_ERR_INVALID_SIZE;
+  }
+  if (psa_hash_finish(&uplsha, sha, sizeof(sha), &shalen) != PSA_SUCCESS) {
+    ota_upload_abort("Failed to calculate SHA-256.");
+    return ESP_FAIL;
+  }
+  uplactive = 0;
+  if (sha256out != NULL) {
+    memcpy(sha256out, sha, sizeof(sha));
+  }
+  if ((expsha256 != NULL) && (memcmp(sha, expsha256, sizeof(sha)) != 0)) {
+    ESP_LOGE("ota.c", "SHA-256 of uploaded image does not match.");
+    esp_ota_abort(uplotah);
+    ota_setstate(OTA_ST_FAILED, "SHA-256 of the uploaded image does not match.");
+    return ESP_ERR_INVALID_CRC;
+  }
+  /* This also verifies the image (header, checksum and signature). */
+  e = esp_ota_end(uplotah);
+  if (e != ESP_OK) {
+    ESP_LOGE("ota.c", "esp_ota_end failed: %s", esp_err_to_name(e));
+    if (e == ESP_ERR_OTA_VALIDATE_FAILED) {
+      ota_setstate(OTA_ST_FAILED, "The uploaded image is not a valid firmware.");
+    } else {
+      ota_setstate(OTA_ST_FAILED, "Failed to finish writing the new firmware.");
+    }
+    return e;
+  }
+  e = esp_ota_set_boot_partition(uplpart);
+  if (e != ESP_OK) {
+    ESP_LOGE("ota.c", "esp_ota_set_boot_partition failed: %s", esp_err_to_name(e));
+    ota_setstate(OTA_ST_FAILED, "Failed to activate the new firmware.");
+    return e;
+  }
+  ESP_LOGI("ota.c", "Uploaded image written and activated.");
+  ota_setstate(OTA_ST_SUCCESS, "Update successful, rebooting in 3 seconds.");
+  return ESP_OK;
+}
+
+void ota_upload_abort(const uint8_t * msg)
+{
+  ESP_LOGE("ota.c", "Upload of firmware aborted: %s", msg);
+  if (uplactive) {
+    psa_hash_abort(&uplsha);
+    esp_ota_abort(uplotah);
+    uplactive = 0;
+  }
+  ota_setstate(OTA_ST_FAILED, msg);
+}
+
+/* Delta updates.
+ * A delta describes the new image as a sequence of commands that either
+ * copy a range of the currently running image, or insert literal bytes.
+ * It is created by tools/mkfwdelta.py. All numbers are little endian.
+ * Header (80 bytes):
+ *   "FXDP", u8 version (1), 3 bytes reserved, u32 size of old image,
+ *   u32 size of new image, SHA-256 of old image, SHA-256 of new image
+ * Commands:
+ *   0x01 COPY:   u32 offset in old image, u32 length
+ *   0x02 INSERT: u32 length, followed by that many bytes of data
+ * The delta ends when all bytes of the new image have been produced.
+ * Both hashes are checked: The old one before anything is written, the
+ * new one before the new image is activated. */
+#define DELTA_HDRSIZE 80
+#define DELTA_CMD_COPY 0x01
+#define DELTA_CMD_INSERT 0x02
+#define DELTA_COPYBUFSIZE 4096
+
+enum deltastates {
+  DST_HEADER = 0, /* (still) receiving the header */
+  DST_CMD = 1,    /* receiving the next command */
+  DST_INSERT = 2, /* receiving data for an INSERT command */
+  DST_DONE = 3,   /* new image is complete */
+};
+
+static struct {
+  uint8_t state;            /* enum deltastates */
+  uint8_t buf[DELTA_HDRSIZE]; /* collects header and commands */
+  int buffill;
+  uint32_t oldsize;
+  uint32_t newsize;
+  uint32_t produced;
+  uint32_t insleft;
+  uint8_t newsha[32];
+  uint8_t * copybuf;
+} dlt;
+
+static uint32_t getu32le(const uint8_t * p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8)
+       | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void ota_delta_fail(const uint8_t * msg)
+{
+  free(dlt.copybuf);
+  dlt.copybuf = NULL;
+  if (uplactive) {
+    ota_upload_abort(msg);
+  } else {
+    /* If the upload failed, that already set a more precise message. */
+    ESP_LOGE("ota.c", "Delta update failed: %s", msg);
+    portENTER_CRITICAL(&otastmux);
+    if (otast.state == OTA_ST_RUNNING) {
+      otast.state = OTA_ST_FAILED;
+      strlcpy(otast.msg, msg, sizeof(otast.msg));
+    }
+    portEXIT_CRITICAL(&otastmux);
+  }
+}
+
+static esp_err_t ota_delta_start(void)
+{
+  memset(&dlt, 0, sizeof(dlt));
+  dlt.copybuf = malloc(DELTA_COPYBUFSIZE);
+  if (dlt.copybuf == NULL) {
+    ota_delta_fail("Out of memory.");
+    return ESP_ERR_NO_MEM;
+  }
+  return ESP_OK;
+}
+
+/* Checks the header, and that the running image is the one the delta
+ * was made against. Then prepares writing the new image. */
+static esp_err_t ota_delta_header(void)
+{
+  const esp_partition_t * running = esp_ota_get_running_partition();
+  psa_hash_operation_t oldsha = PSA_HASH_OPERATION_INIT;
+  uint8_t sha[32];
+  size_t shalen;
+  if ((memcmp(dlt.buf, "FXDP", 4) != 0) || (dlt.buf[4] != 1)) {
+    ota_delta_fail("Not a delta update file, or unsupported version.");
+    return ESP_ERR_INVALID_VERSION;
+  }
+  dlt.oldsize = getu32le(&dlt.buf[8]);
+  dlt.newsize = getu32le(&dlt.buf[12]);
+  memcpy(dlt.newsha, &dlt.buf[48], 32);
+  if ((running == NULL) || (dlt.oldsize > running->size)) {
+    ota_delta_fail("Delta was made for a different firmware.");
+    return ESP_ERR_INVALID_SIZE;
+  }
+  if ((psa_crypto_init() != PSA_SUCCESS)
+   || (psa_hash_setup(&oldsha, PSA_ALG_SHA_256) != PSA_SUCCESS)) {
+    ota_delta_fail("Failed to initialize SHA-256 calculation.");
+    return ESP_FAIL;
+  }
+  for (uint32_t off = 0; off < dlt.oldsize; off += DELTA_COPYBUFSIZE) {
+    uint32_t l = dlt.oldsize - off;
+    if (l > DELTA_COPYBUFSIZE) l = DELTA_COPYBUFSIZE;
+    if (esp_partition_read(running, off, dlt.copybuf, l) != ESP_OK) {
+      psa_hash_abort(&oldsha);
+      ota_delta_fail("Failed to read the running firmware.");
+      return ESP_FAIL;
+    }
+    psa_hash_update(&oldsha, dlt.copybuf, l);
+  }
+  if ((psa_hash_finish(&oldsha, sha, sizeof(sha), &shalen) != PSA_SUCCESS)
+   || (memcmp(sha, &dlt.buf[16], 32) != 0)) {
+    ota_delta_fail("Delta was made for a different firmware.");
+    return ESP_ERR_INVALID_CRC;
+  }
+  ESP_LOGI("ota.c", "Delta update from %lu to %lu bytes, old image matches.",
+           (unsigned long)dlt.oldsize, (unsigned long)dlt.newsize);
+  esp_err_t e = ota_upload_prepare(dlt.newsize);
+  if (e != ESP_OK) {
+    ota_delta_fail("Failed to prepare the OTA partition.");
+  }
+  return e;
+}
+
+static esp_err_t ota_delta_copy(uint32_t off, uint32_t len)
+{
+  const esp_partition_t * running = esp_ota_get_running_partition();
+  if ((off > dlt.oldsize) || (len > (dlt.oldsize - off))
+   || (len > (dlt.newsize - dlt.produced))) {
+    ota_delta_fail("Delta file is corrupt (invalid COPY).");
+    return ESP_ERR_INVALID_ARG;
+  }
+  while (len > 0) {
+    uint32_t l = (len > DELTA_COPYBUFSIZE) ? DELTA_COPYBUFSIZE : len;
+    if (esp_partition_read(running, off, dlt.copybuf, l) != ESP_OK) {
+      ota_delta_fail("Failed to read the running firmware.");
+      return ESP_FAIL;
+    }
+    if (ota_upload_write(dlt.copybuf, l) != ESP_OK) {
+      ota_delta_fail("Writing to flash failed.");
+      return ESP_FAIL;
+    }
+    off += l;
+    len -= l;
+    dlt.produced += l;
+  }
+  return ESP_OK;
+}
+
+esp_err_t ota_delta_begin(void)
+{
+  if (ota_claim("Receiving and applying delta update.", -1) != ESP_OK) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  return ota_delta_start();
+}
+
+esp_err_t ota_delta_write(const uint8_t * data, size_t len)
+{
+  esp_err_t e;
+  while (len > 0) {
+    if (dlt.state == DST_HEADER) {
+      size_t l = DELTA_HDRSIZE - dlt.buffill;
+      if (l > len) l = len;
+      memcpy(&dlt.buf[dlt.buffill], data, l);
+      dlt.buffill += l; data += l; len -= l;
+      if (dlt.buffill < DELTA_HDRSIZE) continue;
+      if ((e = ota_delta_header()) != ESP_OK) return e;
+      dlt.buffill = 0;
+      dlt.state = (dlt.newsize > 0) ? DST_CMD : DST_DONE;
+    } else if (dlt.state == DST_CMD) {
+      dlt.buf[dlt.buffill++] = *data++; len--;
+      if ((dlt.buf[0] == DELTA_CMD_COPY) && (dlt.buffill == 9)) {
+        e = ota_delta_copy(getu32le(&dlt.buf[1]), getu32le(&dlt.buf[5]));
+        if (e != ESP_OK) return e;
+        dlt.buffill = 0;
+      } else if ((dlt.buf[0] == DELTA_CMD_INSERT) && (dlt.buffill == 5)) {
+        dlt.insleft = getu32le(&dlt.buf[1]);
+        if (dlt.insleft > (dlt.newsize - dlt.produced)) {
+          ota_delta_fail("Delta file is corrupt (invalid INSERT).");
+          return ESP_ERR_INVALID_ARG;
+        }
+        dlt.buffill = 0;
+        dlt.state = DST_INSERT;
+      } else if ((dlt.buf[0] != DELTA_CMD_COPY) && (dlt.buf[0] != DELTA_CMD_INSERT)) {
+        ota_delta_fail("Delta file is corrupt (unknown command).");
+        return ESP_ERR_INVALID_ARG;
+      }
+    } else if (dlt.state == DST_INSERT) {
+      size_t l = (len > dlt.insleft) ? dlt.insleft : len;
+      if (ota_upload_write(data, l) != ESP_OK) {
+        ota_delta_fail("Writing to flash failed.");
+        return ESP_FAIL;
+      }
+      dlt.produced += l; dlt.insleft -= l; data += l; len -= l;
+      if (dlt.insleft == 0) dlt.state = DST_CMD;
+    } else { /* DST_DONE */
+      ota_delta_fail("Delta file has trailing garbage.");
+      return ESP_ERR_INVALID_SIZE;
+    }
+    if ((dlt.state == DST_CMD) && (dlt.buffill == 0) && (dlt.produced == dlt.newsize)) {
+      dlt.state = DST_DONE;
+    }
+  }
+  return ESP_OK;
+}
+
+esp_err_t ota_delta_finish(void)
+{
+  if (dlt.state != DST_DONE) {
+    ota_delta_fail("Delta file is incomplete.");
+    return ESP_ERR_INVALID_SIZE;
+  }
+  free(dlt.copybuf);
+  dlt.copybuf = NULL;
+  /* This checks the SHA-256 of the new image before activating it. */
+  return ota_upload_finish(dlt.newsha, NULL);
+}
+
+void ota_delta_abort(const uint8_t * msg)
+{
+  ota_delta_fail(msg);
+}
+
+/* Downloads a delta from otaurl and applies it. Runs within ota_task. */
+static esp_err_t ota_delta_fromurl(void)
+{
+  esp_http_client_config_t httpccfg = {
+      .url = otaurl,
+      .timeout_ms = 60000,
+      .crt_bundle_attach = esp_crt_bundle_attach
+  };
+  uint8_t * rxbuf;
+  esp_err_t e = ESP_OK;
+  int l;
+  if (ota_delta_start() != ESP_OK) {
+    return ESP_ERR_NO_MEM;
+  }
+  rxbuf = malloc(DELTA_COPYBUFSIZE);
+  esp_http_client_handle_t httpcl = esp_http_client_init(&httpccfg);
+  if ((rxbuf == NULL) || (httpcl == NULL)) {
+    ota_delta_fail("Out of memory.");
+    e = ESP_ERR_NO_MEM;
+    goto out;
+  }
+  if ((esp_http_client_open(httpcl, 0) != ESP_OK)
+   || (esp_http_client_fetch_headers(httpcl) < 0)
+   || (esp_http_client_get_status_code(httpcl) != 200)) {
+    ota_delta_fail("Failed to connect or to start the download.");
+    e = ESP_FAIL;
+    goto out;
+  }
+  ota_setstate(OTA_ST_RUNNING, "Downloading and applying delta update.");
+  while ((l = esp_http_client_read(httpcl, rxbuf, DELTA_COPYBUFSIZE)) > 0) {
+    if ((e = ota_delta_write(rxbuf, l)) != ESP_OK) {
+      goto out;
+    }
+  }
+  if (l < 0) {
+    ota_delta_fail("Download of the delta failed.");
+    e = ESP_FAIL;
+    goto out;
+  }
+  e = ota_delta_finish();
+out:
+  if (httpcl != NULL) {
+    esp_http_client_close(httpcl);
+    esp_http_client_cleanup(httpcl);
+  }
+  free(rxbuf);
+  return e;
+}
+
+static void ota_task(void * pvParameters)
+{
+  esp_https_ota_handle_t otah = NULL;
+  size_t ul = strlen(otaurl);
+  if ((ul > 8) && (strcmp(&otaurl[ul - 8], ".fxdelta") == 0)) {
+    ESP_LOGI("ota.c", "Starting delta update from %s", otaurl);
+    if (ota_delta_fromurl() == ESP_OK) {
+      ota_setstate(OTA_ST_SUCCESS, "Update successful, rebooting in 3 seconds.");
+      vTaskDelay(pdMS_TO_TICKS(3000));
+      esp_restart();
+    }
+    vTaskDelete(NULL);
+    return;
+  }
+  esp_http_client_config_t httpccfg = {
+      .url = otaurl,
+      .timeout_ms = 60000,
+      .keep_alive_enable = true,
+      .crt_bundle_attach = esp_crt_bundle_attach
+  };
+  esp_https_ota_config_t otacfg = {
+      .http_config = &httpccfg
+  };
+  ESP_LOGI("ota.c", "Starting firmware update from %s", otaurl);
+  esp_err_t e = esp_https_ota_begin(&otacfg, &otah);
+  if (e != ESP_OK) {
+    ESP_LOGE("ota.c", "esp_https_ota_begin failed: %s", esp_err_to_name(e));
+    ota_setstate(OTA_ST_FAILED, "Failed to connect or to start the update.");
+    vTaskDelete(NULL);
+    return;
+  }
+  ota_setstate(OTA_ST_RUNNING, "Downloading and flashing.");
+  do {
+    /* Every call reads and flashes another part of the image. */
+    e = esp_https_ota_perform(otah);
+    ota_setprogress(esp_https_ota_get_image_len_read(otah),
+                    esp_https_ota_get_image_size(otah));
+  } while (e == ESP_ERR_HTTPS_OTA_IN_PROGRESS);
+  if ((e != ESP_OK) || (esp_https_ota_is_complete_data_received(otah) != true)) {
+    ESP_LOGE("ota.c", "Firmware update failed while downloading: %s", esp_err_to_name(e));
+    esp_https_ota_abort(otah);
+    ota_setstate(OTA_ST_FAILED, "Download of the firmware failed or was incomplete.");
+    vTaskDelete(NULL);
+    return;
+  }
+  e = esp_https_ota_finish(otah);
+  if (e != ESP_OK) {
+    ESP_LOGE("ota.c", "Firmware update failed on finish: %s", esp_err_to_name(e));
+    if (e == ESP_ERR_OTA_VALIDATE_FAILED) {
+      ota_setstate(OTA_ST_FAILED, "The downloaded image is not a valid firmware.");
+    } else {
+      ota_setstate(OTA_ST_FAILED, "Failed to activate the new firmware.");
+    }
+    vTaskDelete(NULL);
+    return;
+  }
+  ESP_LOGI("ota.c", "OTA Succeed, Rebooting...");
+  ota_setstate(OTA_ST_SUCCESS, "Update successful, rebooting in 3 seconds.");
+  /* Give the admin a chance to see that. */
+  vTaskDelay(pdMS_TO_TICKS(3000));
+  esp_restart();
+}
+
+esp_err_t ota_startfromurl(const uint8_t * url)
+{
+  if (ota_claim("Connecting.", -1) != ESP_OK) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  strlcpy(otaurl, url, sizeof(otaurl));
+  /* TLS needs quite a bit of stack. We run at a lower priority than the
+   * webserver, so that it keeps responding while we're busy. */
+  if (xTaskCreate(ota_task, "ota", 8192, NULL, 3, NULL) != pdPASS) {
+    ota_setstate(OTA_ST_FAILED, "Could not create the update task.");
+    return ESP_ERR_NO_MEM;
+  }
+  return ESP_OK;
+}
+
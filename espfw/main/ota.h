@@ -0,0 +1,63 @@
+
+/* Firmware updates (OTA - Over The Air).
+ * Updates run in their own task, so that the webserver stays responsive
+ * while the new firmware is downloaded and flashed. */
+
+#ifndef _OTA_H_
+#define _OTA_H_
+
+enum ota_states {
+  OTA_ST_IDLE = 0,    /* no update has been started since boot */
+  OTA_ST_RUNNING = 1, /* update is in progress */
+  OTA_ST_SUCCESS = 2, /* update finished, about to reboot */
+  OTA_ST_FAILED = 3,  /* update failed, see msg */
+};
+
+struct ota_status {
+  uint8_t state;       /* enum ota_states */
+  int bytesdone;       /* number of bytes of the image written so far */
+  int imagesize;       /* total size of the image, or -1 if not known (yet) */
+  int64_t starttime;   /* esp_timer_get_time() when the update started */
+  int64_t lastupdtime; /* esp_timer_get_time() of the last change */
+  uint8_t msg[100];    /* human readable status message */
+};
+
+/* Starts an update from the firmware at url (HTTPS) in the background.
+ * If url ends in ".fxdelta", it is treated as a delta update against the
+ * running firmware instead of a full image.
+ * Returns ESP_OK if the update was started, ESP_ERR_INVALID_STATE if there
+ * already is an update running, or another error if the task could not be
+ * created. */
+esp_err_t ota_startfromurl(const uint8_t * url);
+
+/* Functions for an update where the image is pushed to us (e.g. uploaded
+ * through the webinterface) instead of us pulling it.
+ * ota_upload_begin prepares the inactive OTA partition for an image of
+ * imagesize bytes. It fails with ESP_ERR_INVALID_STATE if another update is
+ * already running, and ESP_ERR_INVALID_SIZE if the image cannot fit.
+ * ota_upload_write then needs to be called for all data of the image, in
+ * order. The SHA-256 of the image is calculated while writing.
+ * ota_upload_finish checks that exactly imagesize bytes were written, that
+ * the SHA-256 matches expsha256 (unless that is NULL), and that the image is
+ * valid, then makes it the boot partition. The calculated SHA-256 is copied
+ * to sha256out (32 bytes) if that is not NULL.
+ * ota_upload_abort cancels the update. It is safe to call after errors. */
+esp_err_t ota_upload_begin(int imagesize);
+esp_err_t ota_upload_write(const uint8_t * data, size_t len);
+esp_err_t ota_upload_finish(const uint8_t * expsha256, uint8_t * sha256out);
+void ota_upload_abort(const uint8_t * msg);
+
+/* Same as the ota_upload_* functions, but the data pushed through
+ * ota_delta_write is a delta (see ota.c for the format) against the
+ * currently running firmware, that is then applied on the fly.
+ * On any error, the update has already been aborted. */
+esp_err_t ota_delta_begin(void);
+esp_err_t ota_delta_write(const uint8_t * data, size_t len);
+esp_err_t ota_delta_finish(void);
+void ota_delta_abort(const uint8_t * msg);
+
+/* Gets a consistent copy of the current update status. */
+void ota_getstatus(struct ota_status * st);
+
+#endif /* _OTA_H_ */
+
@@ -2,40 +2,180 @@
 
 #include <driver/i2c_master.h>
 #include <esp_log.h>
+#include <stdlib.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-#include "i2c.h"
 #include "scd41.h"
+#include "sensirion.h"
 #include "sdkconfig.h"
 #include "settings.h"
 
 
 #define SCD41ADDR 0x62
 
-#define I2C_MASTER_TIMEOUT_MS 100  /* Timeout for I2C communication */
+/* Commands */
+#define SCD41_CMD_SETASC        0x2416 /* set automatic self calibration */
+#define SCD41_CMD_STARTPERIODIC 0x21b1 /* start periodic measurement (5 s) */
+#define SCD41_CMD_STARTLOWPOWER 0x21ac /* start low power periodic measurement (30 s) */
+#define SCD41_CMD_STOP          0x3f86 /* stop periodic measurement */
+#define SCD41_CMD_SINGLESHOT    0x219d /* measure single shot */
+#define SCD41_CMD_DATAREADY     0xe4b8 /* get data ready status */
+#define SCD41_CMD_READMEAS      0xec05 /* read measurement */
+#define SCD41_CMD_SETPRESSURE   0xe000 /* set ambient pressure */
+#define SCD41_CMD_REINIT        0x3646 /* reload settings from EEPROM */
+#define SCD41_CMD_GETASCINIT    0x2340 /* get ASC initial period */
+#define SCD41_CMD_SETASCINIT    0x2445 /* set ASC initial period */
+#define SCD41_CMD_GETASCSTD     0x234b /* get ASC standard period */
+#define SCD41_CMD_SETASCSTD     0x244e /* set ASC standard period */
 
-static i2c_master_dev_handle_t scd41i2cdev;
+/* A single shot measurement takes 5 seconds. We trigger it one second
+ * earlier than strictly necessary, because the main loop only has a
+ * granularity of one second. */
+#define SCD41_SINGLESHOTLEAD 6
 
-void scd41_init(void)
+/* Typical supply currents at 3.3V from the SCD41 datasheet: the average
+ * for the periodic modes, the idle current in single shot mode, and the
+ * charge one single shot costs on top of that (derived from the 0.45 mA
+ * average the datasheet gives for one single shot every 5 minutes). */
+#define SCD41_CURPERIODIC 15.0  /* mA */
+#define SCD41_CURLOWPOWER  3.2  /* mA */
+#define SCD41_CURIDLE      0.15 /* mA */
+#define SCD41_CHARGESHOT  90.0  /* mAs per single shot */
+
+/* The CO2 reading changes by roughly 0.1 percent per hPa. Sending the
+ * pressure again for changes smaller than this isn't worth it. */
+#define SCD41_PRESSTHRESHOLD 2
+
+/* In single shot mode, the sensor measures the ASC periods by counting
+ * shots, and assumes one shot every 5 minutes. */
+#define SCD41_ASCSHOTINTERVAL 300
+
+static struct sensirion_dev scd41dev;
+static uint16_t scd41lastpress = 0; /* 0 = never sent */
+static unsigned int scd41measinterval = 60;
+static int scd41mode = SCD41_MODE_LOWPOWER;
+
+void scd41_getmodeinfo(int m, struct scd41modeinfo * mi)
+{
+    float t = scd41measinterval;
+    switch (m) {
+    case SCD41_MODE_PERIODIC:
+      mi->name = "periodic";
+      mi->usable = (scd41measinterval >= 5);
+      mi->maxage = 5;
+      mi->avgcurrent = SCD41_CURPERIODIC;
+      break;
+    case SCD41_MODE_LOWPOWER:
+      mi->name = "low power periodic";
+      mi->usable = (scd41measinterval >= 30);
+      mi->maxage = 30;
+      mi->avgcurrent = SCD41_CURLOWPOWER;
+      break;
+    default: /* SCD41_MODE_SINGLESHOT */
+      mi->name = "single shot";
+      mi->usable = (scd41measinterval > SCD41_SINGLESHOTLEAD);
+      /* The main loop reads about 1 s after the nominal time */
+      mi->maxage = SCD41_SINGLESHOTLEAD - 5 + 2;
+      mi->avgcurrent = SCD41_CURIDLE + (SCD41_CHARGESHOT / t);
+      break;
+    }
+    mi->energy = mi->avgcurrent * 3.3 * t;
+}
+
+int scd41_getmode(void)
+{
+    return scd41mode;
+}
+
+/* Select the mode that uses the least power while still delivering a
+ * new value for every measurement interval. */
+static int scd41_automode(void)
 {
-    if (settings.scd41_i2cport > 0) {
-      /* An I2C-port is configured, but is that port disabled? */
-      if ((settings.i2c_n_scl[settings.scd41_i2cport - 1] == 0)
-       || (settings.i2c_n_sda[settings.scd41_i2cport - 1] == 0)) {
-        /* It is. Force disabled-setting for us too. */
-        settings.scd41_i2cport = 0;
-        ESP_LOGW("scd41.c", "WARNING: SCD41 automatically disabled because it is connected to a disabled I2C port.");
+    int best = SCD41_MODE_PERIODIC;
+    struct scd41modeinfo bmi;
+    scd41_getmodeinfo(best, &bmi);
+    for (int m = SCD41_MODE_LOWPOWER; m <= SCD41_MODE_SINGLESHOT; m++) {
+      struct scd41modeinfo mi;
+      scd41_getmodeinfo(m, &mi);
+      if ((mi.usable) && (mi.avgcurrent < bmi.avgcurrent)) {
+        best = m;
+        bmi = mi;
       }
     }
-    if (settings.scd41_i2cport == 0) return;
-    i2c_device_config_t dc = {
-      .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-      .device_address = SCD41ADDR,
-      .scl_speed_hz = i2c_settingtoi2cclock(settings.i2c_n_speed[settings.scd41_i2cport - 1])
-    };
-    if (i2c_master_bus_add_device(i2c_bushandles[settings.scd41_i2cport - 1], &dc, &scd41i2cdev) != ESP_OK) {
-      ESP_LOGW("scd41.c", "WARNING: i2c_master_bus_add_device failed for SCD41.");
+    return best;
+}
+
+/* Converts an ASC period of hours into what we need to tell the sensor
+ * so it gets hours of real time with one single shot per measurement
+ * interval. The sensor only takes multiples of 4 hours. */
+static uint16_t scd41_scaleascperiod(uint16_t hours)
+{
+    uint32_t h = ((uint32_t)hours * SCD41_ASCSHOTINTERVAL + (scd41measinterval / 2))
+               / scd41measinterval;
+    h = ((h + 2) / 4) * 4;
+    if (h < 4) h = 4;
+    if (h > 0xfffc) h = 0xfffc;
+    return h;
+}
+
+/* Scales the ASC initial and standard periods the sensor has in its
+ * EEPROM (by default 44 and 156 hours) to our measurement interval.
+ * Without this, at one shot per minute, ASC would assume the room
+ * gets fresh air every 31 hours instead of about once a week, and
+ * readings in badly ventilated rooms would drift low. The scaled values
+ * are not persisted, the sensor forgets them on a power cycle. */
+static void scd41_scaleascperiods(void)
+{
+    const uint16_t getcmds[2] = { SCD41_CMD_GETASCINIT, SCD41_CMD_GETASCSTD };
+    const uint16_t setcmds[2] = { SCD41_CMD_SETASCINIT, SCD41_CMD_SETASCSTD };
+    uint16_t p[2];
+    for (int i = 0; i < 2; i++) {
+      esp_err_t e = sensirion_cmdread(&scd41dev, getcmds[i], 1, &p[i], 1);
+      if (e != ESP_OK) {
+        ESP_LOGW("scd41.c", "got I2C error when trying to read ASC periods: %s", esp_err_to_name(e));
+        return;
+      }
+    }
+    for (int i = 0; i < 2; i++) {
+      uint16_t arg = scd41_scaleascperiod(p[i]);
+      esp_err_t e = sensirion_sendcmd(&scd41dev, setcmds[i], &arg, 1);
+      if (e != ESP_OK) {
+        ESP_LOGW("scd41.c", "got I2C error when trying to set ASC periods: %s", esp_err_to_name(e));
+        return;
+      }
+      vTaskDelay(pdMS_TO_TICKS(2));
+    }
+    ESP_LOGI("scd41.c", "Scaled SCD41 ASC periods from %u/%u h to %u/%u shot-hours for single shot mode.",
+                        p[0], p[1], scd41_scaleascperiod(p[0]), scd41_scaleascperiod(p[1]));
+}
+
+void scd41_init(unsigned int measinterval)
+{
+    scd41measinterval = measinterval;
+    if (sensirion_init(&scd41dev, "SCD41", 2, &settings.scd41_i2cport, SCD41ADDR) != 0) {
+      return;
+    }
+
+    if ((settings.scd41_mode > SCD41_MODE_AUTO) && (settings.scd41_mode <= SCD41_MODE_SINGLESHOT)) {
+      scd41mode = settings.scd41_mode;
+    } else {
+      scd41mode = scd41_automode();
     }
+    struct scd41modeinfo mi;
+    scd41_getmodeinfo(scd41mode, &mi);
+    ESP_LOGI("scd41.c", "Using %s mode for SCD41 (estimated %.2f mA average).",
+                        mi.name, mi.avgcurrent);
+
+    /* The sensor might still be running periodic measurements if we
+     * were only reset, but it was not power cycled. In that state, it
+     * ignores most commands, so stop them. The datasheet says the
+     * sensor needs 500 ms after that before it responds again. */
+    scd41_stopmeas();
+    vTaskDelay(pdMS_TO_TICKS(500));
+    /* Also undo any settings a previous run might have changed without
+     * persisting them, like the scaled ASC periods below. */
+    sensirion_sendcmd(&scd41dev, SCD41_CMD_REINIT, NULL, 0);
+    vTaskDelay(pdMS_TO_TICKS(30));
 
     /* The default power-on-config of the sensor should
      * be perfectly fine for us, so there is not much to
@@ -43,13 +183,8 @@ void scd41_init(void)
      * We will however configure the Automatic Self Calibration
      * feature on or off if the user requested it. */
     if (settings.scd41_selfcal > 0) {
-      uint8_t cmd[3] = { 0x24, 0x16, 0x00 };
-      if (settings.scd41_selfcal == 1) {
-        cmd[2] = 0x01;
-      }
-      esp_err_t e = i2c_master_transmit(scd41i2cdev,
-                                        cmd, sizeof(cmd),
-                                        I2C_MASTER_TIMEOUT_MS);
+      uint16_t arg = (settings.scd41_selfcal == 1) ? 0x0001 : 0x0000;
+      esp_err_t e = sensirion_sendcmd(&scd41dev, SCD41_CMD_SETASC, &arg, 1);
       if (e == ESP_OK) {
         ESP_LOGI("scd41.c", "Told SCD41 to %s Automatic Self Calibration",
                             ((settings.scd41_selfcal == 1) ? "Enable" : "Disable"));
@@ -57,15 +192,19 @@ void scd41_init(void)
         ESP_LOGW("scd41.c", "got I2C error when trying to configure ASC: %s", esp_err_to_name(e));
       }
     }
+    if ((scd41mode == SCD41_MODE_SINGLESHOT) && (settings.scd41_selfcal != 2)) {
+      scd41_scaleascperiods();
+    }
 }
 
 void scd41_startmeas(void)
 {
     if (settings.scd41_i2cport == 0) return;
-    uint8_t cmd[2] = { 0x21, 0xac };
-    i2c_master_transmit(scd41i2cdev,
-                        cmd, sizeof(cmd),
-                        I2C_MASTER_TIMEOUT_MS);
+    if (scd41mode == SCD41_MODE_SINGLESHOT) return;
+    sensirion_sendcmd(&scd41dev,
+                      ((scd41mode == SCD41_MODE_PERIODIC) ? SCD41_CMD_STARTPERIODIC
+                                                          : SCD41_CMD_STARTLOWPOWER),
+                      NULL, 0);
     /* We ignore the return value. If that failed, we'll notice
      * soon enough, namely when we try to read the result... */
 }
@@ -73,78 +212,79 @@ void scd41_startmeas(void)
 void scd41_stopmeas(void)
 {
     if (settings.scd41_i2cport == 0) return;
-    uint8_t cmd[2] = { 0x3f, 0x86 };
-    i2c_master_transmit(scd41i2cdev,
-                        cmd, sizeof(cmd),
-                        I2C_MASTER_TIMEOUT_MS);
+    sensirion_sendcmd(&scd41dev, SCD41_CMD_STOP, NULL, 0);
     /* We ignore the return value. If that failed, we'll notice
      * soon enough, namely when we try to read the result... */
 }
 
-/* This function is based on Sensirons example code and datasheet
- * for the SHT3x and was written for that. CRC-calculation is
- * exactly the same for the SCD41, so we reuse it. */
-static uint8_t scd41_crc(uint8_t b1, uint8_t b2)
+unsigned int scd41_getleadtime(void)
 {
-    uint8_t crc = 0xff; /* Start value */
-    uint8_t b;
-    crc ^= b1;
-    for (b = 0; b < 8; b++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x131;
-      } else {
-        crc = crc << 1;
-      }
+    return (scd41mode == SCD41_MODE_SINGLESHOT) ? SCD41_SINGLESHOTLEAD : 0;
+}
+
+void scd41_trigger(void)
+{
+    if (settings.scd41_i2cport == 0) return;
+    if (scd41mode != SCD41_MODE_SINGLESHOT) return;
+    sensirion_sendcmd(&scd41dev, SCD41_CMD_SINGLESHOT, NULL, 0);
+    /* Again, if that failed, we'll notice when reading. */
+}
+
+void scd41_setpressure(double press)
+{
+    if (settings.scd41_i2cport == 0) return;
+    /* The sensor accepts 700 to 1200 hPa, in steps of 1 hPa. */
+    if ((press < 700.0) || (press > 1200.0)) return;
+    uint16_t p = (uint16_t)(press + 0.5);
+    if ((scd41lastpress != 0)
+     && (abs((int)p - (int)scd41lastpress) < SCD41_PRESSTHRESHOLD)) {
+      return;
     }
-    crc ^= b2;
-    for (b = 0; b < 8; b++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x131;
-      } else {
-        crc = crc << 1;
-      }
+    if (sensirion_sendcmd(&scd41dev, SCD41_CMD_SETPRESSURE, &p, 1) == ESP_OK) {
+      ESP_LOGI("scd41.c", "Told SCD41 the ambient pressure is %u hPa.", p);
+      scd41lastpress = p;
     }
-    return crc;
+}
+
+/* Returns 1 if the sensor has a new measurement for us. */
+static int scd41_dataready(void)
+{
+    uint16_t w;
+    if (sensirion_cmdread(&scd41dev, SCD41_CMD_DATAREADY, 2, &w, 1) != ESP_OK) {
+      return 0;
+    }
+    /* The lower 11 bits are all 0 if there is no new data. */
+    return ((w & 0x07ff) != 0);
 }
 
 void scd41_read(struct scd41data * d)
 {
+    uint16_t w[3];
     d->valid = 0;
     d->co2 = 0xffff;  d->tempraw = 0xffff; d->humraw = 0xffff;
     d->temp = -999.9; d->hum = -999.99;
     if (settings.scd41_i2cport == 0) return;
-    uint8_t readbuf[9];
-    uint8_t cmd[2] = { 0xec, 0x05 };
-    i2c_master_transmit(scd41i2cdev,
-                        cmd, sizeof(cmd),
-                        I2C_MASTER_TIMEOUT_MS);
+    /* Reading when there is no new data would only get us a NACK. In
+     * single shot mode, the measurement might need a moment more to
+     * finish, so give it up to another second. */
+    int tries = (scd41mode == SCD41_MODE_SINGLESHOT) ? 10 : 1;
+    while (scd41_dataready() == 0) {
+      tries--;
+      if (tries <= 0) {
+        ESP_LOGW("scd41.c", "SCD41 has no new data for us.");
+        return;
+      }
+      vTaskDelay(pdMS_TO_TICKS(100));
+    }
     /* Datasheet says we need to give the sensor at least 1 ms time before
      * we can read the data */
-    vTaskDelay(pdMS_TO_TICKS(2));
-    int res = i2c_master_receive(scd41i2cdev,
-                                 readbuf, sizeof(readbuf),
-                                 I2C_MASTER_TIMEOUT_MS);
-    if (res != ESP_OK) {
-      ESP_LOGE("scd41.c", "ERROR: I2C-read from SCD41 failed.");
-      return;
-    }
-    /* Check CRC */
-    if (scd41_crc(readbuf[0], readbuf[1]) != readbuf[2]) {
-      ESP_LOGE("scd41.c", "ERROR: CRC-check for read part 1 failed.");
-      return;
-    }
-    if (scd41_crc(readbuf[3], readbuf[4]) != readbuf[5]) {
-      ESP_LOGE("scd41.c", "ERROR: CRC-check for read part 2 failed.");
-      return;
-    }
-    if (scd41_crc(readbuf[6], readbuf[7]) != readbuf[8]) {
-      ESP_LOGE("scd41.c", "ERROR: CRC-check for read part 3 failed.");
+    if (sensirion_cmdread(&scd41dev, SCD41_CMD_READMEAS, 2, w, 3) != ESP_OK) {
       return;
     }
     /* OK, CRC matches, this is looking good. */
-    d->co2 = (readbuf[0] << 8) | readbuf[1];
-    d->tempraw = (readbuf[3] << 8) | readbuf[4];
-    d->humraw = (readbuf[6] << 8) | readbuf[7];
+    d->co2 = w[0];
+    d->tempraw = w[1];
+    d->humraw = w[2];
     if ((d->co2 == 0xffff) || (d->tempraw == 0xffff) || (d->humraw == 0xffff)) {
       ESP_LOGE("scd41.c", "ERROR: SCD41 reported at least one value as unknown.");
       return;
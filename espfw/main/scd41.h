@@ -16,19 +16,52 @@ struct scd41data {
   float hum; /* rel.hum. */
 };
 
-/* Initialize the SCD41 */
-void scd41_init(void);
+/* Measurement modes, for settings.scd41_mode */
+#define SCD41_MODE_AUTO       0 /* choose from the measurement interval */
+#define SCD41_MODE_PERIODIC   1 /* new value every 5 s */
+#define SCD41_MODE_LOWPOWER   2 /* new value every 30 s */
+#define SCD41_MODE_SINGLESHOT 3 /* one measurement per sample, takes 5 s */
 
-/* Start periodic measurements on the SCD41.
- * Note: We use the low power mode that provides a measurement every 30s,
- * not the normal mode that does so every 5s. */
+/* Rough estimates of what a mode costs, for the debug page */
+struct scd41modeinfo {
+  const char * name;
+  uint8_t usable;    /* can the mode deliver a new value every interval? */
+  uint16_t maxage;   /* max. age in seconds of the value when we read it */
+  float avgcurrent;  /* average supply current in mA at 3.3V */
+  float energy;      /* energy per measurement interval in mJ */
+};
+
+/* Initialize the SCD41. measinterval is the time between two
+ * scd41_read()s in seconds, the measurement mode is chosen from that
+ * unless the user set one explicitly. In single shot mode, this also
+ * scales the ASC periods, see scd41.c. */
+void scd41_init(unsigned int measinterval);
+
+/* Start measurements on the SCD41. In the periodic modes, this starts
+ * them, in single shot mode it does nothing, see scd41_trigger(). */
 void scd41_startmeas(void);
 /* Stop measurements */
 void scd41_stopmeas(void);
 
-/* Read measurement data from the sensor.
- * This will return an error if no new data is available on this sensor type! */
+/* How many seconds before scd41_read() scd41_trigger() needs to be
+ * called. 0 if no trigger is needed because we're in a periodic mode. */
+unsigned int scd41_getleadtime(void);
+/* Trigger a single shot measurement. Does nothing in the periodic modes. */
+void scd41_trigger(void);
+
+/* Tell the SCD41 the current ambient pressure in hPa, so it can
+ * compensate its CO2 readings. To keep I2C traffic down, this is only
+ * sent to the sensor if it differs enough from what it already has. */
+void scd41_setpressure(double press);
+
+/* Read measurement data from the sensor. This first asks the sensor
+ * whether it has new data, and returns an invalid result if not. */
 void scd41_read(struct scd41data * d);
 
+/* The mode we chose (one of SCD41_MODE_*, never _AUTO), and the
+ * estimates for mode m at our measurement interval. */
+int scd41_getmode(void);
+void scd41_getmodeinfo(int m, struct scd41modeinfo * mi);
+
 #endif /* _SCD41_H_ */
 
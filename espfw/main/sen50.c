@@ -1,41 +1,66 @@
-/* Talking to SEN50 particulate matter sensors */
+/* Talking to SEN5x (SEN50, SEN54, SEN55) particulate matter sensors */
 
 #include <driver/i2c_master.h>
 #include <esp_log.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
-#include "i2c.h"
+#include <math.h>
+#include <string.h>
 #include "sen50.h"
+#include "sensirion.h"
 #include "sdkconfig.h"
 #include "settings.h"
 
 
 #define SEN50ADDR 0x69 /* This is fixed. */
 
-#define I2C_MASTER_TIMEOUT_MS 100  /* Timeout for I2C communication */
+/* Commands */
+#define SEN50_CMD_START    0x0021 /* start measurement */
+#define SEN50_CMD_STOP     0x0104 /* stop measurement */
+#define SEN50_CMD_READMEAS 0x03c4 /* read measured values */
+#define SEN50_CMD_READNAME 0xd014 /* read product name */
 
-static i2c_master_dev_handle_t sen50i2cdev;
+static struct sensirion_dev sen50dev;
+static int sen50variant = 0;
 
-void sen50_init(void)
+/* Finds out which variant we have from the product name, which is
+ * e.g. "SEN55", in up to 32 characters. */
+static void sen50_detectvariant(void)
 {
-  if (settings.sen50_i2cport > 0) {
-    /* An I2C-port is configured, but is that port disabled? */
-    if ((settings.i2c_n_scl[settings.sen50_i2cport - 1] == 0)
-     || (settings.i2c_n_sda[settings.sen50_i2cport - 1] == 0)) {
-      /* It is. Force disabled-setting for us too. */
-      settings.sen50_i2cport = 0;
-      ESP_LOGW("sen50.c", "WARNING: SEN50 automatically disabled because it is connected to a disabled I2C port.");
+  uint16_t w[16];
+  uint8_t name[33];
+  if (sensirion_cmdread(&sen50dev, SEN50_CMD_READNAME, 20, w, 16) != ESP_OK) {
+    ESP_LOGW("sen50.c", "Could not read product name, assuming SEN50.");
+    sen50variant = 50;
+    return;
+  }
+  for (int i = 0; i < 16; i++) {
+    name[i * 2] = w[i] >> 8;
+    name[(i * 2) + 1] = w[i] & 0xff;
+  }
+  name[32] = 0;
+  if (strcmp(name, "SEN54") == 0) {
+    sen50variant = 54;
+  } else if (strcmp(name, "SEN55") == 0) {
+    sen50variant = 55;
+  } else {
+    sen50variant = 50;
+    if (strcmp(name, "SEN50") != 0) {
+      ESP_LOGW("sen50.c", "Unknown product name '%s', treating it as SEN50.", name);
     }
   }
-  if (settings.sen50_i2cport == 0) return;
-  i2c_device_config_t dc = {
-    .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-    .device_address = SEN50ADDR,
-    .scl_speed_hz = i2c_settingtoi2cclock(settings.i2c_n_speed[settings.sen50_i2cport - 1])
-  };
-  if (i2c_master_bus_add_device(i2c_bushandles[settings.sen50_i2cport - 1], &dc, &sen50i2cdev) != ESP_OK) {
-    ESP_LOGW("sen50.c", "WARNING: i2c_master_bus_add_device failed for SEN50.");
+  ESP_LOGI("sen50.c", "Detected a SEN%d.", sen50variant);
+}
+
+int sen50_getvariant(void)
+{
+  return sen50variant;
+}
+
+void sen50_init(void)
+{
+  if (sensirion_init(&sen50dev, "SEN5x", 2, &settings.sen50_i2cport, SEN50ADDR) != 0) {
+    return;
   }
+  sen50_detectvariant();
 
   /* The default power-on-config of the sensor should
    * be perfectly fine for us, so there is nothing to
@@ -45,10 +70,7 @@ void sen50_init(void)
 void sen50_startmeas(void)
 {
     if (settings.sen50_i2cport == 0) return;
-    uint8_t cmd[2] = { 0x00, 0x21 };
-    esp_err_t res = i2c_master_transmit(sen50i2cdev,
-                                        cmd, sizeof(cmd),
-                                        I2C_MASTER_TIMEOUT_MS);
+    esp_err_t res = sensirion_sendcmd(&sen50dev, SEN50_CMD_START, NULL, 0);
     if (res != ESP_OK) {
       ESP_LOGE("sen50.c", "ERROR: sending start-measurement-command to SEN50 failed with error '%s'.",
                           esp_err_to_name(res));
@@ -59,10 +81,7 @@ void sen50_startmeas(void)
 void sen50_stopmeas(void)
 {
     if (settings.sen50_i2cport == 0) return;
-    uint8_t cmd[2] = { 0x01, 0x04 };
-    esp_err_t res = i2c_master_transmit(sen50i2cdev,
-                                        cmd, sizeof(cmd),
-                                        I2C_MASTER_TIMEOUT_MS);
+    esp_err_t res = sensirion_sendcmd(&sen50dev, SEN50_CMD_STOP, NULL, 0);
     if (res != ESP_OK) {
       ESP_LOGE("sen50.c", "ERROR: sending stop-measurement-command to SEN50 failed with error '%s'.",
                           esp_err_to_name(res));
@@ -70,80 +89,46 @@ void sen50_stopmeas(void)
     }
 }
 
-/* This function is based on Sensirons example code and datasheet
- * for the SHT3x and was written for that. CRC-calculation is
- * exactly the same for the SEN50, so we reuse it. */
-static uint8_t sen50_crc(uint8_t b1, uint8_t b2)
-{
-    uint8_t crc = 0xff; /* Start value */
-    uint8_t b;
-    crc ^= b1;
-    for (b = 0; b < 8; b++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x131;
-      } else {
-        crc = crc << 1;
-      }
-    }
-    crc ^= b2;
-    for (b = 0; b < 8; b++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x131;
-      } else {
-        crc = crc << 1;
-      }
-    }
-    return crc;
-}
-
 void sen50_read(struct sen50data * d)
 {
+    uint16_t w[8];
     d->valid = 0;
     d->pm010raw = 0xffff;  d->pm025raw = 0xffff; d->pm040raw = 0xffff; d->pm100raw = 0xffff;
+    d->humraw = 0x7fff; d->tempraw = 0x7fff; d->vocraw = 0x7fff; d->noxraw = 0x7fff;
     d->pm010 = -999.99; d->pm025 = -999.9; d->pm040 = -999.99; d->pm100 = -999.9;
+    d->hum = NAN; d->temp = NAN; d->vocidx = NAN; d->noxidx = NAN;
     if (settings.sen50_i2cport == 0) return;
-    uint8_t readbuf[23];
-    uint8_t cmd[2] = { 0x03, 0xc4 };
-    i2c_master_transmit(sen50i2cdev,
-                        cmd, sizeof(cmd),
-                        I2C_MASTER_TIMEOUT_MS);
     /* Datasheet says we need to give the sensor at least 20 ms time before
      * we can read the data so that it can fill its internal buffers */
-    vTaskDelay(pdMS_TO_TICKS(22));
-    int res = i2c_master_receive(sen50i2cdev,
-                                 readbuf, sizeof(readbuf),
-                                 I2C_MASTER_TIMEOUT_MS);
-    if (res != ESP_OK) {
-      ESP_LOGE("sen50.c", "ERROR: I2C-read from SEN50 failed with error '%s'.",
-                          esp_err_to_name(res));
-      return;
-    }
-    /* Check CRC */
-    if (sen50_crc(readbuf[0], readbuf[1]) != readbuf[2]) {
-      ESP_LOGE("sen50.c", "ERROR: CRC-check for read part 1 failed.");
-      return;
-    }
-    if (sen50_crc(readbuf[3], readbuf[4]) != readbuf[5]) {
-      ESP_LOGE("sen50.c", "ERROR: CRC-check for read part 2 failed.");
+    /* All variants send all eight values, the ones they don't measure
+     * are 0x7fff. So we always read (and CRC-check) all of them in one
+     * go, and only look at what the variant has. */
+    if (sensirion_cmdread(&sen50dev, SEN50_CMD_READMEAS, 22, w, 8) != ESP_OK) {
       return;
     }
-    if (sen50_crc(readbuf[6], readbuf[7]) != readbuf[8]) {
-      ESP_LOGE("sen50.c", "ERROR: CRC-check for read part 3 failed.");
-      return;
+    /* OK, CRC matches, this is looking good. */
+    d->humraw = w[4];
+    d->tempraw = w[5];
+    d->vocraw = w[6];
+    d->noxraw = w[7];
+    /* 0x7fff means "no value (yet)". VOC and NOx index take a few
+     * seconds after starting the measurement until they're there. */
+    if (sen50variant >= 54) {
+      if ((d->humraw != 0x7fff) && (d->tempraw != 0x7fff)) {
+        d->hum = (float)d->humraw / 100.0;
+        d->temp = (float)d->tempraw / 200.0;
+      }
+      if (d->vocraw != 0x7fff) {
+        d->vocidx = (float)d->vocraw / 10.0;
+      }
     }
-    if (sen50_crc(readbuf[9], readbuf[10]) != readbuf[11]) {
-      ESP_LOGE("sen50.c", "ERROR: CRC-check for read part 4 failed.");
-      return;
+    if ((sen50variant == 55) && (d->noxraw != 0x7fff)) {
+      d->noxidx = (float)d->noxraw / 10.0;
     }
-    /* We could also check CRC for temperature / humidity / noxi data, but
-     * that doesn't contain valid values anyways (_should_ only contain
-     * 0xffff on our sensor because it doesn't measure those) and we
-     * throw that away anyways, so why should we care? */
-    /* OK, CRC matches, this is looking good. */
-    d->pm010raw = (readbuf[0] << 8) | readbuf[1];
-    d->pm025raw = (readbuf[3] << 8) | readbuf[4];
-    d->pm040raw = (readbuf[6] << 8) | readbuf[7];
-    d->pm100raw = (readbuf[9] << 8) | readbuf[10];
+    d->pm010raw = w[0];
+    d->pm025raw = w[1];
+    d->pm040raw = w[2];
+    d->pm100raw = w[3];
     /* Check for 0xffff, as that is the poweron-value of the register,
      * and never a valid reading. */
     if ((d->pm010raw == 0xffff) || (d->pm025raw == 0xffff)
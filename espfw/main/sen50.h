@@ -1,5 +1,5 @@
 
-/* Talking to SEN50 particulate matter sensors */
+/* Talking to SEN5x (SEN50, SEN54, SEN55) particulate matter sensors */
 
 #ifndef _SEN50_H_
 #define _SEN50_H_
@@ -10,22 +10,35 @@ struct sen50data {
   uint16_t pm025raw; /* PM 2.5 */
   uint16_t pm040raw; /* PM 4 */
   uint16_t pm100raw; /* PM10 */
+  int16_t humraw;    /* rel. humidity, SEN54/SEN55 only */
+  int16_t tempraw;   /* temperature, SEN54/SEN55 only */
+  int16_t vocraw;    /* VOC index, SEN54/SEN55 only */
+  int16_t noxraw;    /* NOx index, SEN55 only */
   float pm010; /* PM 1 */
   float pm025; /* PM 2.5 */
   float pm040; /* PM 4 */
   float pm100; /* PM10 */
+  /* The following are NAN if the sensor does not measure them, or
+   * doesn't have a value yet. */
+  float hum;
+  float temp;
+  float vocidx; /* see vocindex.h, calculated by the sensor itself */
+  float noxidx; /* like the VOC index, but 1 is "as usual" */
 };
 
-/* Initialize the SEN50 */
+/* Initialize the SEN5x, and find out which variant it is. */
 void sen50_init(void);
 
-/* Start measurements on the SEN50. */
+/* Which variant we have: 50, 54 or 55. 0 if we don't know (yet). */
+int sen50_getvariant(void);
+
+/* Start measurements on the SEN5x. */
 void sen50_startmeas(void);
 /* Stop measurements */
 void sen50_stopmeas(void);
 
-/* Read measurement data (particulate matter)
- * from the sensor. */
+/* Read measurement data (particulate matter, and depending on the
+ * variant temperature, humidity, VOC and NOx index) from the sensor. */
 void sen50_read(struct sen50data * d);
 
 #endif /* _SEN50_H_ */
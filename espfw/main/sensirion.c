@@ -0,0 +1,168 @@
+/* Things all Sensirion sensors have in common. See sensirion.h. */
+
+#include <driver/i2c_master.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "i2c.h"
+#include "sensirion.h"
+#include "sdkconfig.h"
+#include "settings.h"
+
+#define TAG "sensirion.c"
+
+#define I2C_MASTER_TIMEOUT_MS 100  /* Timeout for I2C communication */
+
+/* The longest command we send: 2 bytes command, 2 arguments with CRC */
+#define MAXCMDLEN (2 + (2 * 3))
+/* The longest reply we read: the SEN5x product name (16 words with CRC) */
+#define MAXWORDS 16
+
+/* crc8table[i] is the CRC (without start value) of the byte i, so the CRC
+ * can be calculated a whole byte at a time instead of bit by bit. */
+static const uint8_t crc8table[256] = {
+    0x00, 0x31, 0x62, 0x53, 0xc4, 0xf5, 0xa6, 0x97, 0xb9, 0x88, 0xdb, 0xea,
+    0x7d, 0x4c, 0x1f, 0x2e, 0x43, 0x72, 0x21, 0x10, 0x87, 0xb6, 0xe5, 0xd4,
+    0xfa, 0xcb, 0x98, 0xa9, 0x3e, 0x0f, 0x5c, 0x6d, 0x86, 0xb7, 0xe4, 0xd5,
+    0x42, 0x73, 0x20, 0x11, 0x3f, 0x0e, 0x5d, 0x6c, 0xfb, 0xca, 0x99, 0xa8,
+    0xc5, 0xf4, 0xa7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7c, 0x4d, 0x1e, 0x2f,
+    0xb8, 0x89, 0xda, 0xeb, 0x3d, 0x0c, 0x5f, 0x6e, 0xf9, 0xc8, 0x9b, 0xaa,
+    0x84, 0xb5, 0xe6, 0xd7, 0x40, 0x71, 0x22, 0x13, 0x7e, 0x4f, 0x1c, 0x2d,
+    0xba, 0x8b, 0xd8, 0xe9, 0xc7, 0xf6, 0xa5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xbb, 0x8a, 0xd9, 0xe8, 0x7f, 0x4e, 0x1d, 0x2c, 0x02, 0x33, 0x60, 0x51,
+    0xc6, 0xf7, 0xa4, 0x95, 0xf8, 0xc9, 0x9a, 0xab, 0x3c, 0x0d, 0x5e, 0x6f,
+    0x41, 0x70, 0x23, 0x12, 0x85, 0xb4, 0xe7, 0xd6, 0x7a, 0x4b, 0x18, 0x29,
+    0xbe, 0x8f, 0xdc, 0xed, 0xc3, 0xf2, 0xa1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5b, 0x6a, 0xfd, 0xcc, 0x9f, 0xae, 0x80, 0xb1, 0xe2, 0xd3,
+    0x44, 0x75, 0x26, 0x17, 0xfc, 0xcd, 0x9e, 0xaf, 0x38, 0x09, 0x5a, 0x6b,
+    0x45, 0x74, 0x27, 0x16, 0x81, 0xb0, 0xe3, 0xd2, 0xbf, 0x8e, 0xdd, 0xec,
+    0x7b, 0x4a, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xc2, 0xf3, 0xa0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xb2, 0xe1, 0xd0, 0xfe, 0xcf, 0x9c, 0xad,
+    0x3a, 0x0b, 0x58, 0x69, 0x04, 0x35, 0x66, 0x57, 0xc0, 0xf1, 0xa2, 0x93,
+    0xbd, 0x8c, 0xdf, 0xee, 0x79, 0x48, 0x1b, 0x2a, 0xc1, 0xf0, 0xa3, 0x92,
+    0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1a, 0x2b, 0xbc, 0x8d, 0xde, 0xef,
+    0x82, 0xb3, 0xe0, 0xd1, 0x46, 0x77, 0x24, 0x15, 0x3b, 0x0a, 0x59, 0x68,
+    0xff, 0xce, 0x9d, 0xac,
+};
+
+#define MAXDEVS 6
+static const struct sensirion_dev * devs[MAXDEVS];
+static int nrdevs = 0;
+
+int sensirion_init(struct sensirion_dev * sd, const char * name, uint8_t cmdlen,
+                   uint8_t * i2cport, uint8_t addr)
+{
+    sd->name = name;
+    sd->cmdlen = cmdlen;
+    sd->nrreads = 0;
+    sd->i2cerrors = 0;
+    sd->crcerrors = 0;
+    if (*i2cport > 0) {
+      /* An I2C-port is configured, but is that port disabled? */
+      if ((settings.i2c_n_scl[*i2cport - 1] == 0)
+       || (settings.i2c_n_sda[*i2cport - 1] == 0)) {
+        /* It is. Force disabled-setting for us too. */
+        *i2cport = 0;
+        ESP_LOGW(TAG, "WARNING: %s automatically disabled because it is connected to a disabled I2C port.", name);
+      }
+    }
+    if (*i2cport == 0) return 1;
+    i2c_device_config_t dc = {
+      .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+      .device_address = addr,
+      .scl_speed_hz = i2c_settingtoi2cclock(settings.i2c_n_speed[*i2cport - 1])
+    };
+    if (i2c_master_bus_add_device(i2c_bushandles[*i2cport - 1], &dc, &sd->i2cdev) != ESP_OK) {
+      ESP_LOGW(TAG, "WARNING: i2c_master_bus_add_device failed for %s.", name);
+      return 1;
+    }
+    if (nrdevs < MAXDEVS) {
+      devs[nrdevs] = sd;
+      nrdevs++;
+    }
+    return 0;
+}
+
+uint8_t sensirion_crc(const uint8_t * data, size_t len)
+{
+    uint8_t crc = 0xff; /* Start value */
+    for (size_t i = 0; i < len; i++) {
+      crc = crc8table[crc ^ data[i]];
+    }
+    return crc;
+}
+
+esp_err_t sensirion_sendcmd(struct sensirion_dev * sd, uint16_t cmd,
+                            const uint16_t * args, int nrargs)
+{
+    uint8_t buf[MAXCMDLEN];
+    int len = 0;
+    if ((nrargs * 3) > (MAXCMDLEN - 2)) {
+      return ESP_ERR_INVALID_ARG;
+    }
+    if (sd->cmdlen == 2) {
+      buf[len++] = cmd >> 8;
+    }
+    buf[len++] = cmd & 0xff;
+    for (int i = 0; i < nrargs; i++) {
+      buf[len] = args[i] >> 8;
+      buf[len + 1] = args[i] & 0xff;
+      buf[len + 2] = sensirion_crc(&buf[len], 2);
+      len += 3;
+    }
+    esp_err_t res = i2c_master_transmit(sd->i2cdev, buf, len, I2C_MASTER_TIMEOUT_MS);
+    if (res != ESP_OK) {
+      sd->i2cerrors++;
+    }
+    return res;
+}
+
+esp_err_t sensirion_readwords(struct sensirion_dev * sd, uint16_t * words, int nrwords)
+{
+    uint8_t buf[MAXWORDS * 3];
+    if (nrwords > MAXWORDS) {
+      return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t res = i2c_master_receive(sd->i2cdev, buf, nrwords * 3, I2C_MASTER_TIMEOUT_MS);
+    if (res != ESP_OK) {
+      sd->i2cerrors++;
+      ESP_LOGE(TAG, "ERROR: I2C-read from %s failed with error '%s'.",
+                    sd->name, esp_err_to_name(res));
+      return res;
+    }
+    for (int i = 0; i < nrwords; i++) {
+      if (sensirion_crc(&buf[i * 3], 2) != buf[(i * 3) + 2]) {
+        sd->crcerrors++;
+        ESP_LOGE(TAG, "ERROR: CRC-check for word %d read from %s failed.", i, sd->name);
+        return ESP_ERR_INVALID_CRC;
+      }
+      words[i] = (buf[i * 3] << 8) | buf[(i * 3) + 1];
+    }
+    sd->nrreads++;
+    return ESP_OK;
+}
+
+esp_err_t sensirion_cmdread(struct sensirion_dev * sd, uint16_t cmd, uint32_t delayms,
+                            uint16_t * words, int nrwords)
+{
+    esp_err_t res = sensirion_sendcmd(sd, cmd, NULL, 0);
+    if (res != ESP_OK) {
+      ESP_LOGE(TAG, "ERROR: sending command 0x%04x to %s failed with error '%s'.",
+                    cmd, sd->name, esp_err_to_name(res));
+      return res;
+    }
+    if (delayms > 0) {
+      vTaskDelay(pdMS_TO_TICKS(delayms));
+    }
+    return sensirion_readwords(sd, words, nrwords);
+}
+
+int sensirion_getnrdevs(void)
+{
+    return nrdevs;
+}
+
+const struct sensirion_dev * sensirion_getdev(int i)
+{
+    return devs[i];
+}
@@ -0,0 +1,50 @@
+
+/* Things all Sensirion sensors (SHT4x, SCD41, SEN5x, SGP40) have in
+ * common: They all take 8 or 16 bit commands, optionally followed by
+ * 16 bit arguments, and reply with 16 bit words. Every argument and
+ * every word in a reply is followed by a CRC-8. */
+
+#ifndef _SENSIRION_H_
+#define _SENSIRION_H_
+
+#include <driver/i2c_master.h>
+
+struct sensirion_dev {
+  const char * name;   /* for log messages, e.g. "SCD41" */
+  i2c_master_dev_handle_t i2cdev;
+  uint8_t cmdlen;      /* length of commands in bytes: 1 or 2 */
+  /* Error statistics */
+  uint32_t nrreads;    /* successful reads */
+  uint32_t i2cerrors;  /* failed I2C transfers, both directions */
+  uint32_t crcerrors;  /* reads with a bad CRC */
+};
+
+/* Set up sd for a sensor on I2C port *i2cport (1 or 2, 0 for disabled)
+ * with address addr. If the port itself is disabled, *i2cport is set to
+ * 0 too. Returns 0 on success. */
+int sensirion_init(struct sensirion_dev * sd, const char * name, uint8_t cmdlen,
+                   uint8_t * i2cport, uint8_t addr);
+
+/* CRC-8 over len bytes, as used by all Sensirion sensors: polynomial
+ * 0x31, start value 0xff. For the example in the datasheets, 0xBE 0xEF,
+ * this returns 0x92. */
+uint8_t sensirion_crc(const uint8_t * data, size_t len);
+
+/* Send a command, followed by nrargs arguments (with CRC added). */
+esp_err_t sensirion_sendcmd(struct sensirion_dev * sd, uint16_t cmd,
+                            const uint16_t * args, int nrargs);
+
+/* Read nrwords words from the sensor, and check their CRCs. Returns
+ * ESP_ERR_INVALID_CRC if any of them is bad. */
+esp_err_t sensirion_readwords(struct sensirion_dev * sd, uint16_t * words, int nrwords);
+
+/* Send a command, wait delayms milliseconds for the sensor to process
+ * it, and then read nrwords words. */
+esp_err_t sensirion_cmdread(struct sensirion_dev * sd, uint16_t cmd, uint32_t delayms,
+                            uint16_t * words, int nrwords);
+
+/* All devices set up with sensirion_init, for the statistics. */
+int sensirion_getnrdevs(void);
+const struct sensirion_dev * sensirion_getdev(int i);
+
+#endif /* _SENSIRION_H_ */
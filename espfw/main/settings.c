@@ -4,6 +4,7 @@
 #include <esp_mac.h>
 #include <esp_system.h>
 #include <nvs_flash.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 #include "settings.h"
@@ -28,9 +29,157 @@ static void loadstr(nvs_handle_t nvshandle, const char * key, char * out, size_t
   }
 }
 
+#define SOFF(m) offsetof(struct globalsettings, m)
+#define SSIZE(m) sizeof(settings.m)
+
+#define OPTS_I2CPORT "not connected|I2C 0|I2C 1"
+
+const struct settingdef settingsschema[] = {
+  /* WiFi */
+  { .key = "wifi_mode", .type = SETT_U8, .group = SG_WIFI,
+    .label = "WiFi mode:", .opts = "Access Point|Client", .max = 1,
+    .offset = SOFF(wifi_mode), .size = SSIZE(wifi_mode) },
+  { .type = SETT_HEADING, .group = SG_WIFI, .label = "For AccessPoint-Mode:" },
+  { .key = "wifi_ap_ssid", .type = SETT_STR, .group = SG_WIFI,
+    .label = "WiFi SSID (also used as hostname in client mode):",
+    .min = 2, .max = 32, .flags = SETF_SHOWRUNNING,
+    .offset = SOFF(wifi_ap_ssid), .size = SSIZE(wifi_ap_ssid) },
+  { .key = "wifi_ap_pw", .type = SETT_STR, .group = SG_WIFI,
+    .label = "WiFi password (leave empty for 'open' mode):", .max = 63,
+#ifdef DEFAULT_WIFI_AP_PW
+    .defstr = DEFAULT_WIFI_AP_PW,
+#endif /* DEFAULT_WIFI_AP_PW */
+    .offset = SOFF(wifi_ap_pw), .size = SSIZE(wifi_ap_pw) },
+  { .type = SETT_HEADING, .group = SG_WIFI, .label = "For Client-Mode:" },
+  { .key = "wifi_cl_ssid", .type = SETT_STR, .group = SG_WIFI,
+    .label = "WiFi SSID:", .min = 2, .max = 32,
+    .offset = SOFF(wifi_cl_ssid), .size = SSIZE(wifi_cl_ssid) },
+  { .key = "wifi_cl_pw", .type = SETT_STR, .group = SG_WIFI,
+    .label = "WiFi password:", .max = 63,
+    .offset = SOFF(wifi_cl_pw), .size = SSIZE(wifi_cl_pw) },
+  /* External wiring */
+  { .key = "i2c_%d_scl", .type = SETT_GPIO, .group = SG_WIRING,
+    .label = "I2C %d SCL GPIO", .max = 64, .arraysize = 2,
+    .offset = SOFF(i2c_n_scl), .size = SSIZE(i2c_n_scl[0]) },
+  { .key = "i2c_%d_sda", .type = SETT_GPIO, .group = SG_WIRING,
+    .label = "I2C %d SDA GPIO", .max = 64, .arraysize = 2,
+    .offset = SOFF(i2c_n_sda), .size = SSIZE(i2c_n_sda[0]) },
+  { .key = "i2c_%d_pullups", .type = SETT_U8, .group = SG_WIRING,
+    .label = "I2C %d pullups", .opts = "Disable pullups|Enable pullups",
+    .max = 1, .arraysize = 2,
+    .offset = SOFF(i2c_n_pullups), .size = SSIZE(i2c_n_pullups[0]) },
+  { .key = "i2c_%d_speed", .type = SETT_U8, .group = SG_WIRING,
+    .label = "I2C %d speed (Hz)", .opts = "100k (default)|25k|200k|400k|1000k",
+    .max = 4, .arraysize = 2,
+    .offset = SOFF(i2c_n_speed), .size = SSIZE(i2c_n_speed[0]) },
+  { .key = "ser_1_rx", .type = SETT_GPIO, .group = SG_WIRING,
+    .label = "Serial 1 RX GPIO", .max = 64,
+    .offset = SOFF(ser_1_rx), .size = SSIZE(ser_1_rx) },
+  { .key = "ser_1_tx", .type = SETT_GPIO, .group = SG_WIRING,
+    .label = "Serial 1 TX GPIO", .max = 64,
+    .offset = SOFF(ser_1_tx), .size = SSIZE(ser_1_tx) },
+  /* Sensors */
+  { .key = "scd41_i2cport", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "SCD41 I2C port", .opts = OPTS_I2CPORT, .max = 2,
+    .offset = SOFF(scd41_i2cport), .size = SSIZE(scd41_i2cport) },
+  { .key = "scd41_selfcal", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "SCD41 <abbr title=\"Automatic Self Calibration\">ASC</abbr>",
+    .opts = "use EEPROM setting|Enable|Disable", .max = 2,
+    .offset = SOFF(scd41_selfcal), .size = SSIZE(scd41_selfcal) },
+  { .key = "scd41_mode", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "SCD41 measurement mode (single shot adjusts the <abbr title=\"Automatic Self Calibration\">ASC</abbr> periods to the measurement interval)",
+    .opts = "automatic (default)|periodic (5s)|low power periodic (30s)|single shot", .max = 3,
+    .offset = SOFF(scd41_mode), .size = SSIZE(scd41_mode) },
+  { .key = "sen50_i2cport", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "SEN5x (SEN50/SEN54/SEN55) I2C port", .opts = OPTS_I2CPORT, .max = 2,
+    .offset = SOFF(sen50_i2cport), .size = SSIZE(sen50_i2cport) },
+  { .key = "sgp40_i2cport", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "SGP40 I2C port", .opts = OPTS_I2CPORT, .max = 2,
+    .offset = SOFF(sgp40_i2cport), .size = SSIZE(sgp40_i2cport) },
+  { .key = "sht4x_i2cport", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "SHT4x (SHT40/SHT41/SHT45) I2C port", .opts = OPTS_I2CPORT, .max = 2,
+    .offset = SOFF(sht4x_i2cport), .size = SSIZE(sht4x_i2cport) },
+  { .key = "sht4x_addr", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "SHT4x address", .opts = "0x44 (most common)|0x45|0x46", .max = 2,
+    .offset = SOFF(sht4x_addr), .size = SSIZE(sht4x_addr) },
+  { .key = "lps35hw_i2cport", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "LPS35HW I2C port", .opts = OPTS_I2CPORT, .max = 2,
+    .offset = SOFF(lps35hw_i2cport), .size = SSIZE(lps35hw_i2cport) },
+  { .key = "lps35hw_addr", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "LPS35HW address", .opts = "0x5c|0x5d", .max = 1,
+    .offset = SOFF(lps35hw_addr), .size = SSIZE(lps35hw_addr) },
+  { .key = "rg15_serport", .type = SETT_U8, .group = SG_SENSORS,
+    .label = "RG15 serial port", .opts = "not connected|Serial 1", .max = 1,
+    .offset = SOFF(rg15_serport), .size = SSIZE(rg15_serport) },
+  /* Display */
+  { .key = "di_type", .type = SETT_U8, .group = SG_DISPLAY,
+    .label = "Display type",
+    .opts = "none|SSD1306 variant 1|SSD1309 variant 1|Waveshare 2.9in e-paper V2"
+            "|ILI9341 240x320 TFT|ST7789 240x320 TFT",
+    .max = 5,
+    .offset = SOFF(di_type), .size = SSIZE(di_type) },
+  { .key = "di_i2cport", .type = SETT_U8, .group = SG_DISPLAY,
+    .label = "I2C-port<br><small>(for I2C displays)</small>",
+    .opts = OPTS_I2CPORT, .max = 2,
+    .offset = SOFF(di_i2cport), .size = SSIZE(di_i2cport) },
+  /* The defaults for the SPI pins are what the Waveshare E-Paper ESP32
+   * driver board uses. */
+  { .key = "di_spi_sck", .type = SETT_GPIO, .group = SG_DISPLAY,
+    .label = "SPI SCK/CLK GPIO<br><small>(for SPI displays)</small>",
+    .max = 64, .defval = 13 + 1,
+    .offset = SOFF(di_spi_sck), .size = SSIZE(di_spi_sck) },
+  { .key = "di_spi_mosi", .type = SETT_GPIO, .group = SG_DISPLAY,
+    .label = "SPI MOSI/DIN GPIO", .max = 64, .defval = 14 + 1,
+    .offset = SOFF(di_spi_mosi), .size = SSIZE(di_spi_mosi) },
+  { .key = "di_spi_cs", .type = SETT_GPIO, .group = SG_DISPLAY,
+    .label = "SPI CS GPIO", .max = 64, .defval = 15 + 1,
+    .offset = SOFF(di_spi_cs), .size = SSIZE(di_spi_cs) },
+  { .key = "di_spi_dc", .type = SETT_GPIO, .group = SG_DISPLAY,
+    .label = "Display DC GPIO", .max = 64, .defval = 27 + 1,
+    .offset = SOFF(di_spi_dc), .size = SSIZE(di_spi_dc) },
+  { .key = "di_spi_rst", .type = SETT_GPIO, .group = SG_DISPLAY,
+    .label = "Display RST GPIO<br><small>(optional for TFTs)</small>", .max = 64, .defval = 26 + 1,
+    .offset = SOFF(di_spi_rst), .size = SSIZE(di_spi_rst) },
+  { .key = "di_spi_busy", .type = SETT_GPIO, .group = SG_DISPLAY,
+    .label = "Display BUSY GPIO<br><small>(e-paper only)</small>", .max = 64, .defval = 25 + 1,
+    .offset = SOFF(di_spi_busy), .size = SSIZE(di_spi_busy) },
+  /* Miscellaneous */
+  { .key = "adminpw", .type = SETT_ADMINPW, .group = SG_MISC,
+    .label = "Change Admin Password", .max = 24, .defstr = "admin",
+    .offset = SOFF(adminpw), .size = SSIZE(adminpw) },
+  /* Submit to wetter.poempelfox.de */
+  { .key = "wpd_enabled", .type = SETT_U8, .group = SG_SUBWPD,
+    .label = "Submit values to<br>wetter.poempelfox.de",
+    .opts = "Disabled|Enabled", .max = 1,
+    .offset = SOFF(wpd_enabled), .size = SSIZE(wpd_enabled) },
+  { .key = "wpd_token", .type = SETT_STR, .group = SG_SUBWPD,
+    .label = "Token for authentication", .max = 64,
+    .offset = SOFF(wpd_token), .size = SSIZE(wpd_token) },
+  { .key = "wpd_sensid_t%03d", .type = SETT_STR, .group = SG_SUBWPD,
+    .label = "SensorID for %s", .max = 11,
+    .arraysize = NR_SENSORTYPES, .flags = SETF_PERSENSORTYPE,
+    .offset = SOFF(wpd_sensid), .size = SSIZE(wpd_sensid[0]) },
+};
+
+const int nr_settingsschema = sizeof(settingsschema) / sizeof(settingsschema[0]);
+
+void settings_getkey(const struct settingdef * sd, int idx, uint8_t * out)
+{
+  if (sd->arraysize > 0) {
+    sprintf(out, sd->key, idx);
+  } else {
+    strcpy(out, sd->key);
+  }
+}
+
+void * settings_getptr(const struct settingdef * sd, int idx)
+{
+  return ((uint8_t *)&settings) + sd->offset + (idx * sd->size);
+}
+
 void settings_load(void)
 {
-  uint8_t tmp1[50];
+  uint8_t key[16];
   /* nvs_flash_init() is already done in main before we run. */
   /* bare minimum fallback settings so we have a way to configure this thing */
   uint8_t mainmac[6];
@@ -42,50 +191,34 @@ void settings_load(void)
   sprintf(settings.wifi_ap_ssid, "foxtemp%02x%02x%02x%02x%02x%02x",
           mainmac[0], mainmac[1], mainmac[2],
           mainmac[3], mainmac[4], mainmac[5]);
-  strcpy(settings.adminpw, "admin");
-#ifdef DEFAULT_WIFI_AP_PW
-  strcpy(settings.wifi_ap_pw, DEFAULT_WIFI_AP_PW);
-#endif /* DEFAULT_WIFI_AP_PW */
+  for (int i = 0; i < nr_settingsschema; i++) {
+    const struct settingdef * sd = &settingsschema[i];
+    for (int idx = 0; idx < ((sd->arraysize < 1) ? 1 : sd->arraysize); idx++) {
+      if ((sd->type == SETT_U8) || (sd->type == SETT_GPIO)) {
+        *(uint8_t *)settings_getptr(sd, idx) = sd->defval;
+      } else if ((sd->type == SETT_STR) || (sd->type == SETT_ADMINPW)) {
+        if (sd->defstr != NULL) {
+          strlcpy(settings_getptr(sd, idx), sd->defstr, sd->size);
+        }
+      }
+    }
+  }
   nvs_handle_t nvshandle;
   if (nvs_open("settings", NVS_READONLY, &nvshandle) != ESP_OK) {
     ESP_LOGE("settings.c", "Failed to read setting from flash. Using defaults.");
     return;
   }
-  loadstr(nvshandle, "adminpw", settings.adminpw, sizeof(settings.adminpw));
-  loadu8(nvshandle, "wifi_mode", &(settings.wifi_mode));
-  loadstr(nvshandle, "wifi_cl_ssid", settings.wifi_cl_ssid, sizeof(settings.wifi_cl_ssid));
-  loadstr(nvshandle, "wifi_cl_pw", settings.wifi_cl_pw, sizeof(settings.wifi_cl_pw));
-  loadstr(nvshandle, "wifi_ap_ssid", settings.wifi_ap_ssid, sizeof(settings.wifi_ap_ssid));
-  loadstr(nvshandle, "wifi_ap_pw", settings.wifi_ap_pw, sizeof(settings.wifi_ap_pw));
-  for (int i2cp = 0; i2cp <= 1; i2cp++) {
-    sprintf(tmp1, "i2c_%d_pullups", i2cp);
-    loadu8(nvshandle, tmp1, &(settings.i2c_n_pullups[i2cp]));
-    sprintf(tmp1, "i2c_%d_scl", i2cp);
-    loadu8(nvshandle, tmp1, &(settings.i2c_n_scl[i2cp]));
-    sprintf(tmp1, "i2c_%d_sda", i2cp);
-    loadu8(nvshandle, tmp1, &(settings.i2c_n_sda[i2cp]));
-    sprintf(tmp1, "i2c_%d_speed", i2cp);
-    loadu8(nvshandle, tmp1, &(settings.i2c_n_speed[i2cp]));
-  }
-  loadu8(nvshandle, "ser_1_rx", &(settings.ser_1_rx));
-  loadu8(nvshandle, "ser_1_tx", &(settings.ser_1_tx));
-  loadu8(nvshandle, "lps35hw_i2cport", &(settings.lps35hw_i2cport));
-  loadu8(nvshandle, "lps35hw_addr", &(settings.lps35hw_addr));
-  loadu8(nvshandle, "scd41_i2cport", &(settings.scd41_i2cport));
-  loadu8(nvshandle, "scd41_selfcal", &(settings.scd41_selfcal));
-  loadu8(nvshandle, "sen50_i2cport", &(settings.sen50_i2cport));
-  loadu8(nvshandle, "sgp40_i2cport", &(settings.sgp40_i2cport));
-  loadu8(nvshandle, "sht4x_addr", &(settings.sht4x_addr));
-  loadu8(nvshandle, "sht4x_i2cport", &(settings.sht4x_i2cport));
-  loadu8(nvshandle, "rg15_serport", &(settings.rg15_serport));
-  loadu8(nvshandle, "di_type", &(settings.di_type));
-  loadu8(nvshandle, "di_i2cport", &(settings.di_i2cport));
-  loadu8(nvshandle, "wpd_enabled", &(settings.wpd_enabled));
-  for (int i = 0; i < NR_SENSORTYPES; i++) {
-    sprintf(tmp1, "wpd_sensid_t%03d", i);
-    loadstr(nvshandle, tmp1, settings.wpd_sensid[i], sizeof(settings.wpd_sensid[i]));
+  for (int i = 0; i < nr_settingsschema; i++) {
+    const struct settingdef * sd = &settingsschema[i];
+    for (int idx = 0; idx < ((sd->arraysize < 1) ? 1 : sd->arraysize); idx++) {
+      settings_getkey(sd, idx, key);
+      if ((sd->type == SETT_U8) || (sd->type == SETT_GPIO)) {
+        loadu8(nvshandle, key, settings_getptr(sd, idx));
+      } else if ((sd->type == SETT_STR) || (sd->type == SETT_ADMINPW)) {
+        loadstr(nvshandle, key, settings_getptr(sd, idx), sd->size);
+      }
+    }
   }
-  loadstr(nvshandle, "wpd_token", settings.wpd_token, sizeof(settings.wpd_token));
   nvs_close(nvshandle);
 }
 
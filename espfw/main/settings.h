@@ -22,6 +22,12 @@ enum di_displaytypes {
   DI_DT_SSD1306_1 = 1,
   // Zhongjingyuan SSD1309 based 2.42 inch 128x64 display
   DI_DT_SSD1309_1 = 2,
+  // Waveshare 2.9 inch e-paper module V2, SSD1680 based, 128x296, SPI
+  DI_DT_EPD29_V2 = 3,
+  // ILI9341 based 240x320 color TFT, SPI
+  DI_DT_ILI9341 = 4,
+  // ST7789 based 240x320 color TFT, SPI
+  DI_DT_ST7789 = 5,
 };
 
 struct globalsettings {
@@ -47,6 +53,7 @@ struct globalsettings {
 	uint8_t lps35hw_addr; // offset to 0x5c! see lps35hw.c
 	uint8_t scd41_i2cport;
 	uint8_t scd41_selfcal;
+	uint8_t scd41_mode; // see SCD41_MODE_* in scd41.h
 	uint8_t sen50_i2cport;
 	uint8_t sgp40_i2cport;
 	uint8_t sht4x_addr; // offset to 0x44! see sht4x.c
@@ -56,6 +63,13 @@ struct globalsettings {
 	/* Display settings */
 	uint8_t di_type; // see enum di_displaytypes
 	uint8_t di_i2cport; // for I2C displays
+	/* the pins used for SPI displays, 0 for disable, GPIOnumber+1 otherwise. */
+	uint8_t di_spi_sck;
+	uint8_t di_spi_mosi;
+	uint8_t di_spi_cs;
+	uint8_t di_spi_dc;
+	uint8_t di_spi_rst;
+	uint8_t di_spi_busy;
 	/* Settings for submitting values to wetter.poempelfox.de */
         uint8_t wpd_enabled;
 	uint8_t wpd_token[65]; /* Token for authentication. */
@@ -64,6 +78,65 @@ struct globalsettings {
 
 extern struct globalsettings settings;
 
+/* The settings schema: One entry for every setting (or array of settings)
+ * in struct globalsettings. Loading the settings from flash, rendering them
+ * into the forms of the admin interface, and validating submitted values
+ * are all done from this table, so a new setting only needs a member in
+ * struct globalsettings and an entry in settingsschema[]. */
+enum settingtypes {
+  SETT_HEADING = 0, /* not a setting, just a heading in the admin interface */
+  SETT_U8 = 1,      /* uint8_t, selected from a list of options */
+  SETT_GPIO = 2,    /* uint8_t, 0 for disabled or GPIOnumber+1 */
+  SETT_STR = 3,     /* string */
+  SETT_ADMINPW = 4, /* string, the admin password. Never shown, and changing
+                     * it requires the current password. */
+};
+
+/* Which page of the admin interface a setting shows up on */
+enum settinggroups {
+  SG_WIFI = 0,
+  SG_WIRING = 1,
+  SG_SENSORS = 2,
+  SG_DISPLAY = 3,
+  SG_MISC = 4,
+  SG_SUBWPD = 5,
+  NR_SETTINGGROUPS = 6
+};
+
+/* If the setting is not in flash, the admin interface shows the currently
+ * active value instead of the default from the schema. */
+#define SETF_SHOWRUNNING   0x01
+/* Array index is a sensortype, the label contains a %s for its name. */
+#define SETF_PERSENSORTYPE 0x02
+
+struct settingdef {
+  const uint8_t * key;    /* NVS key. For arrays, it contains one %d for the index. */
+  const uint8_t * label;  /* Label in the admin interface, may contain HTML.
+                           * For arrays, it contains one %d for the index. */
+  const uint8_t * opts;   /* SETT_U8: '|'-separated labels for values 0...max */
+  const uint8_t * defstr; /* SETT_STR/SETT_ADMINPW: default value, or NULL */
+  uint16_t offset;        /* offset in struct globalsettings */
+  uint8_t size;           /* size of one (array element) value in there */
+  uint8_t type;           /* enum settingtypes */
+  uint8_t group;          /* enum settinggroups */
+  uint8_t flags;          /* SETF_* */
+  uint8_t arraysize;      /* 0 if this is not an array */
+  uint8_t min;            /* SETT_U8/SETT_GPIO: minimum value, otherwise minimum length */
+  uint8_t max;            /* SETT_U8/SETT_GPIO: maximum value, otherwise maximum length */
+  uint8_t defval;         /* SETT_U8/SETT_GPIO: default value */
+};
+
+extern const struct settingdef settingsschema[];
+extern const int nr_settingsschema;
+
+/* Fills in the NVS key for array element idx of a setting (idx is
+ * ignored for non-arrays). out needs to hold at least 16 bytes. */
+void settings_getkey(const struct settingdef * sd, int idx, uint8_t * out);
+
+/* Returns a pointer to the value for array element idx of a setting
+ * in the global settings variable. */
+void * settings_getptr(const struct settingdef * sd, int idx);
+
 /* Load main settings */
 void settings_load(void);
 
@@ -2,111 +2,132 @@
 
 #include <driver/i2c_master.h>
 #include <esp_log.h>
-#include "i2c.h"
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "sensirion.h"
 #include "sgp40.h"
 #include "sdkconfig.h"
 #include "settings.h"
+#include "vocindex.h"
 
 #define SGP40ADDR 0x59
 
-#define I2C_MASTER_TIMEOUT_MS 1000  /* Timeout for I2C communication */
+/* Commands */
+#define SGP40_CMD_MEASRAW 0x260f /* measure raw signal, with compensation */
 
-static i2c_master_dev_handle_t sgp40i2cdev;
+/* A measurement takes up to 30 ms according to the datasheet */
+#define SGP40_MEASMS 30
+
+/* After how long without a successful read the values are invalid */
+#define SGP40_MAXAGEUS (5 * 1000000)
+
+static struct sensirion_dev sgp40dev;
+static struct vocindex sgp40vi;
+
+/* Shared between the task and everyone else, protected by sgp40mux. */
+static portMUX_TYPE sgp40mux = portMUX_INITIALIZER_UNLOCKED;
+static float comptemp = 25.0;
+static float comphum = 50.0;
+static uint16_t lastraw = 0xffff;
+static uint16_t lastindex = 0;
+static int64_t lastreadts = -SGP40_MAXAGEUS;
+static uint32_t lastcpuus = 0;
+static uint32_t maxcpuus = 0;
 
 void sgp40_init(void)
 {
-    if (settings.sgp40_i2cport > 0) {
-      /* An I2C-port is configured, but is that port disabled? */
-      if ((settings.i2c_n_scl[settings.sgp40_i2cport - 1] == 0)
-       || (settings.i2c_n_sda[settings.sgp40_i2cport - 1] == 0)) {
-        /* It is. Force disabled-setting for us too. */
-        settings.sgp40_i2cport = 0;
-        ESP_LOGW("sgp40.c", "WARNING: SGP40 automatically disabled because it is connected to a disabled I2C port.");
-      }
-    }
-    if (settings.sgp40_i2cport == 0) return;
-    i2c_device_config_t dc = {
-      .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-      .device_address = SGP40ADDR,
-      .scl_speed_hz = i2c_settingtoi2cclock(settings.i2c_n_speed[settings.sgp40_i2cport - 1])
-    };
-    if (i2c_master_bus_add_device(i2c_bushandles[settings.sgp40_i2cport - 1], &dc, &sgp40i2cdev) != ESP_OK) {
-      ESP_LOGW("sgp40.c", "WARNING: i2c_master_bus_add_device failed for SGP40.");
+    sensirion_init(&sgp40dev, "SGP40", 2, &settings.sgp40_i2cport, SGP40ADDR);
+}
+
+static void sgp40_startmeasraw(float temp, float hum)
+{
+    /* Limit to the range the encoding can represent */
+    if (hum < 0.0) { hum = 0.0; }
+    if (hum > 100.0) { hum = 100.0; }
+    if (temp < -45.0) { temp = -45.0; }
+    if (temp > 130.0) { temp = 130.0; }
+    uint16_t humenc = hum * 65535.0 / 100.0;
+    uint16_t tempenc = (temp + 45.0) * 65535.0 / 175.0;
+    uint16_t args[2] = { humenc, tempenc };
+    esp_err_t res = sensirion_sendcmd(&sgp40dev, SGP40_CMD_MEASRAW, args, 2);
+    if (res != ESP_OK) {
+      ESP_LOGE("sgp40.c", "ERROR: sending start-measurement-command to SGP40 failed with error '%s'.",
+                          esp_err_to_name(res));
+      return;
     }
 }
 
-/* This function is based on Sensirons example code and datasheet
- * for the SHT3x and was written for that. CRC-calculation is
- * exactly the same for the SGP40, so we reuse it. */
-static uint8_t sgp40_crc(uint8_t b1, uint8_t b2)
+static void sgp40_task(void * pvParameters)
 {
-    uint8_t crc = 0xff; /* Start value */
-    uint8_t b;
-    crc ^= b1;
-    for (b = 0; b < 8; b++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x131;
-      } else {
-        crc = crc << 1;
+    TickType_t lastwake = xTaskGetTickCount();
+    while (1) {
+      float t, h;
+      portENTER_CRITICAL(&sgp40mux);
+      t = comptemp;
+      h = comphum;
+      portEXIT_CRITICAL(&sgp40mux);
+      sgp40_startmeasraw(t, h);
+      vTaskDelay(pdMS_TO_TICKS(SGP40_MEASMS));
+      uint16_t w;
+      if (sensirion_readwords(&sgp40dev, &w, 1) != ESP_OK) {
+        w = 0; /* The algorithm will reuse the last good value. */
       }
-    }
-    crc ^= b2;
-    for (b = 0; b < 8; b++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x131;
-      } else {
-        crc = crc << 1;
+      /* The algorithm gets fed even if the read failed, so it keeps its
+       * one-second cadence. */
+      int64_t st = esp_timer_get_time();
+      uint16_t idx = vi_process(&sgp40vi, w);
+      int64_t et = esp_timer_get_time();
+      portENTER_CRITICAL(&sgp40mux);
+      if (w != 0) {
+        lastraw = w;
+        lastindex = idx;
+        lastreadts = et;
+      }
+      lastcpuus = et - st;
+      if (lastcpuus > maxcpuus) {
+        maxcpuus = lastcpuus;
       }
+      portEXIT_CRITICAL(&sgp40mux);
+      vTaskDelayUntil(&lastwake, pdMS_TO_TICKS(1000));
     }
-    return crc;
 }
 
-void sgp40_startmeasraw(float temp, float hum)
+void sgp40_starttask(void)
 {
     if (settings.sgp40_i2cport == 0) return;
-    uint16_t humenc = hum * 65535.0 / 100.0;
-    uint16_t tempenc = (temp + 45.0) * 65535.0 / 175.0;
-    uint8_t cmd[8] = { 0x26, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-    /* Fill in temp, RH, and CRC */
-    cmd[2] = humenc >> 8; cmd[3] = humenc & 0xff;
-    cmd[4] = sgp40_crc(cmd[2], cmd[3]);
-    cmd[5] = tempenc >> 8; cmd[6] = tempenc & 0xff;
-    cmd[7] = sgp40_crc(cmd[5], cmd[6]);
-    ESP_LOGI("sgp40.c", "Will send: (%02x %02x = cmd) (%02x %02x = hum) %02x (%02x %02x = temp) %02x",
-                        cmd[0], cmd[1], cmd[2], cmd[3],
-                        cmd[4], cmd[5], cmd[6], cmd[7]);
-    esp_err_t res = i2c_master_transmit(sgp40i2cdev,
-                                        cmd, sizeof(cmd),
-                                        I2C_MASTER_TIMEOUT_MS);
-    if (res != ESP_OK) {
-      ESP_LOGE("sgp40.c", "ERROR: sending start-measurement-command to SGP40 failed with error '%s'.",
-                          esp_err_to_name(res));
-      return;
+    vi_init(&sgp40vi);
+    if (xTaskCreate(sgp40_task, "sgp40", 3072, NULL, 3, NULL) != pdPASS) {
+      ESP_LOGE("sgp40.c", "Failed to start SGP40 task.");
     }
 }
 
+void sgp40_setcompensation(float temp, float hum)
+{
+    portENTER_CRITICAL(&sgp40mux);
+    comptemp = temp;
+    comphum = hum;
+    portEXIT_CRITICAL(&sgp40mux);
+}
+
 void sgp40_read(struct sgp40data * d)
 {
-    uint8_t readbuf[3];
-    d->valid = 0; d->vocraw = 0xffff;
+    d->valid = 0; d->vocraw = 0xffff; d->vocindex = 0;
     if (settings.sgp40_i2cport == 0) return;
-    int res = i2c_master_receive(sgp40i2cdev,
-                                 readbuf, sizeof(readbuf),
-                                 I2C_MASTER_TIMEOUT_MS);
-    if (res != ESP_OK) {
-      ESP_LOGE("sgp40.c", "ERROR: I2C-read from SGP40 failed with error '%s'.",
-                          esp_err_to_name(res));
-      return;
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&sgp40mux);
+    if ((now - lastreadts) < SGP40_MAXAGEUS) {
+      d->vocraw = lastraw;
+      d->vocindex = lastindex;
+      d->valid = 1;
     }
-    /* Check CRC */
-    if (sgp40_crc(readbuf[0], readbuf[1]) != readbuf[2]) {
-      ESP_LOGE("sgp40.c", "ERROR: CRC-check for read failed.");
-      return;
-    }
-    //ESP_LOGI("sgp40.c", "Read VOC: %x %x", readbuf[0], readbuf[1]);
-    /* OK, CRC matches, this is looking good. */
-    d->vocraw = (readbuf[0] << 8) | readbuf[1];
-    /* Mark the result as valid. */
-    d->valid = 1;
+    portEXIT_CRITICAL(&sgp40mux);
 }
 
+void sgp40_getcpustats(uint32_t * lastus, uint32_t * maxus)
+{
+    portENTER_CRITICAL(&sgp40mux);
+    *lastus = lastcpuus;
+    *maxus = maxcpuus;
+    portEXIT_CRITICAL(&sgp40mux);
+}
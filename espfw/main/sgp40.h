@@ -7,19 +7,30 @@
 struct sgp40data {
   uint8_t valid;
   uint16_t vocraw;
+  uint16_t vocindex; /* see vocindex.h, 0 while it is still starting up */
 };
 
 /* Initialize the SGP40 */
 void sgp40_init(void);
 
-/* Request measurements from the SGP40 */
-void sgp40_startmeasraw(float temp, float hum);
+/* Start the task that measures once per second. It needs to be that
+ * often, because the VOC index algorithm only works with exactly that
+ * sampling interval. */
+void sgp40_starttask(void);
 
-/* Read the raw VOC data from the sensor.
- * You need to request a measurements at least 30 ms
- * before reading, and you can only read every
- * measurement at most once! */
+/* Set temperature (degC) and humidity (%) the sensor uses for
+ * compensating its readings. They should come from a real temperature /
+ * humidity sensor if we have one, until they are set, the task uses
+ * 25 degC and 50 %. */
+void sgp40_setcompensation(float temp, float hum);
+
+/* Get the latest values measured by the task. Not valid if the task
+ * hasn't had a successful read for a few seconds. */
 void sgp40_read(struct sgp40data * d);
 
+/* How long calculating the VOC index took for the last sample, and the
+ * maximum since boot, in microseconds. */
+void sgp40_getcpustats(uint32_t * lastus, uint32_t * maxus);
+
 #endif /* _SGP40_H_ */
 
@@ -2,7 +2,7 @@
 
 #include <driver/i2c_master.h>
 #include <esp_log.h>
-#include "i2c.h"
+#include "sensirion.h"
 #include "sht4x.h"
 #include "sdkconfig.h"
 #include "settings.h"
@@ -14,30 +14,14 @@
 /* Turn on heater with medium power (110 mW) for 1 second */
 #define SHT4X_CMD_HEAT_MID_LONG 0x2F
 
-#define I2C_MASTER_TIMEOUT_MS 1000  /* Timeout for I2C communication */
-
-static i2c_master_dev_handle_t sht4xi2cdev;
+static struct sensirion_dev sht4xdev;
 
 void sht4x_init(void)
 {
-    if (settings.sht4x_i2cport > 0) {
-      /* An I2C-port is configured, but is that port disabled? */
-      if ((settings.i2c_n_scl[settings.sht4x_i2cport - 1] == 0)
-       || (settings.i2c_n_sda[settings.sht4x_i2cport - 1] == 0)) {
-        /* It is. Force disabled-setting for us too. */
-        settings.sht4x_i2cport = 0;
-        ESP_LOGW("sht4x.c", "WARNING: SHT4x automatically disabled because it is connected to a disabled I2C port.");
-      }
-    }
-    if (settings.sht4x_i2cport == 0) return;
-    uint8_t sht4xaddr = SHT4XBASEADDR + settings.sht4x_addr;
-    i2c_device_config_t dc = {
-      .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-      .device_address = sht4xaddr,
-      .scl_speed_hz = i2c_settingtoi2cclock(settings.i2c_n_speed[settings.sht4x_i2cport - 1])
-    };
-    if (i2c_master_bus_add_device(i2c_bushandles[settings.sht4x_i2cport - 1], &dc, &sht4xi2cdev) != ESP_OK) {
-      ESP_LOGW("sht4x.c", "WARNING: i2c_master_bus_add_device failed for SHT4x.");
+    /* The SHT4x only has 8 bit commands. */
+    if (sensirion_init(&sht4xdev, "SHT4x", 1, &settings.sht4x_i2cport,
+                       SHT4XBASEADDR + settings.sht4x_addr) != 0) {
+      return;
     }
 
     /* The default power-on-config of the sensor should
@@ -48,65 +32,23 @@ void sht4x_init(void)
 void sht4x_startmeas(void)
 {
     if (settings.sht4x_i2cport == 0) return;
-    uint8_t cmd[1] = { SHT4X_CMD_MEASURE_HIGH };
-    i2c_master_transmit(sht4xi2cdev,
-                        cmd, sizeof(cmd),
-                        I2C_MASTER_TIMEOUT_MS);
+    sensirion_sendcmd(&sht4xdev, SHT4X_CMD_MEASURE_HIGH, NULL, 0);
     /* We ignore the return value. If that failed, we'll notice
      * soon enough, namely when we try to read the result... */
 }
 
-/* This function is based on Sensirons example code and datasheet
- * for the SHT3x and was written for that. CRC-calculation is
- * exactly the same for the SHT4x, so we reuse it. */
-static uint8_t sht4x_crc(uint8_t b1, uint8_t b2)
-{
-    uint8_t crc = 0xff; /* Start value */
-    uint8_t b;
-    crc ^= b1;
-    for (b = 0; b < 8; b++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x131;
-      } else {
-        crc = crc << 1;
-      }
-    }
-    crc ^= b2;
-    for (b = 0; b < 8; b++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x131;
-      } else {
-        crc = crc << 1;
-      }
-    }
-    return crc;
-}
-
 void sht4x_read(struct sht4xdata * d)
 {
-    uint8_t readbuf[6];
+    uint16_t w[2];
     d->valid = 0; d->tempraw = 0xffff;  d->humraw = 0xffff;
     d->temp = -999.99; d->hum = 200.0;
     if (settings.sht4x_i2cport == 0) return;
-    int res = i2c_master_receive(sht4xi2cdev,
-                                 readbuf, sizeof(readbuf),
-                                 I2C_MASTER_TIMEOUT_MS);
-    if (res != ESP_OK) {
-      ESP_LOGE("sht4x.c", "ERROR: I2C-read from SHT4x failed.");
-      return;
-    }
-    /* Check CRC */
-    if (sht4x_crc(readbuf[0], readbuf[1]) != readbuf[2]) {
-      ESP_LOGE("sht4x.c", "ERROR: CRC-check for read part 1 failed.");
-      return;
-    }
-    if (sht4x_crc(readbuf[3], readbuf[4]) != readbuf[5]) {
-      ESP_LOGE("sht4x.c", "ERROR: CRC-check for read part 2 failed.");
+    if (sensirion_readwords(&sht4xdev, w, 2) != ESP_OK) {
       return;
     }
     /* OK, CRC matches, this is looking good. */
-    d->tempraw = (readbuf[0] << 8) | readbuf[1];
-    d->humraw = (readbuf[3] << 8) | readbuf[4];
+    d->tempraw = w[0];
+    d->humraw = w[1];
     d->temp = -45.0 + 175.0 * ((float)d->tempraw / 65535.0);
     d->hum = -6.0 + 125.0 * ((float)d->humraw / 65535.0);
     /* Cap values to 0-100 range - the sensor may return values
@@ -120,10 +62,7 @@ void sht4x_read(struct sht4xdata * d)
 void sht4x_heatercycle(void)
 {
     if (settings.sht4x_i2cport == 0) return;
-    uint8_t cmd[1] = { SHT4X_CMD_HEAT_MID_LONG };
     ESP_LOGI("sht4x.c", "turning SHT4x heater on for 1.0 seconds at medium power (110 mW).");
-    i2c_master_transmit(sht4xi2cdev,
-                        cmd, sizeof(cmd),
-                        I2C_MASTER_TIMEOUT_MS);
+    sensirion_sendcmd(&sht4xdev, SHT4X_CMD_HEAT_MID_LONG, NULL, 0);
 }
 
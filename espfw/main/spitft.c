@@ -0,0 +1,265 @@
+/* Talking to SPI TFT color displays with ILI9341 or ST7789 controller */
+
+#include <driver/gpio.h>
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <string.h>
+#include "spitft.h"
+#include "settings.h"
+
+#define TAG "spitft.c"
+
+/* Both controllers are used in 240x320 modules, in portrait orientation. */
+#define TFT_SIZEX 240
+#define TFT_SIZEY 320
+/* We draw in bands of this many rows: 2 buffers of 15 KB each instead of
+ * 150 KB for the whole display. */
+#define TFT_BANDH 32
+
+#define TFT_SPICLOCK (26 * 1000 * 1000)
+
+static spi_device_handle_t tftspi;
+static gpio_num_t dcpin;
+/* While a band is sent with DMA, the next one is drawn into the other
+ * buffer. spare is the one not currently in the dispbuf. */
+static uint8_t * spare = NULL;
+static spi_transaction_t bandtrans;
+static int bandinflight = 0;
+/* A hash of every row on the display, to only send rows that changed.
+ * Pages have the same layout, so while the same page is shown, usually
+ * only the value and the sparkline below it change. */
+static uint32_t rowhash[TFT_SIZEY];
+static int rowhashvalid = 0;
+static int sendfailed = 0; /* in the current frame */
+static uint32_t bytessaved = 0;
+
+/* Initialization sequences. Every entry is a command, its parameters,
+ * and how long to wait afterwards. */
+struct tftinitcmd {
+    uint8_t cmd;
+    uint8_t len;
+    uint8_t delayms;
+    uint8_t data[4];
+};
+
+static const struct tftinitcmd initili9341[] = {
+    { 0x01, 0, 150, { 0 } },                 /* Software reset */
+    { 0xC0, 1,   0, { 0x23 } },              /* Power control 1 */
+    { 0xC1, 1,   0, { 0x10 } },              /* Power control 2 */
+    { 0xC5, 2,   0, { 0x3E, 0x28 } },        /* VCOM control 1 */
+    { 0xC7, 1,   0, { 0x86 } },              /* VCOM control 2 */
+    { 0x36, 1,   0, { 0x48 } },              /* Memory access: mirror X, BGR */
+    { 0x3A, 1,   0, { 0x55 } },              /* Pixel format: 16 bit */
+    { 0xB1, 2,   0, { 0x00, 0x18 } },        /* Frame rate 79 Hz */
+    { 0x11, 0, 120, { 0 } },                 /* Sleep out */
+    { 0x29, 0,  20, { 0 } },                 /* Display on */
+};
+
+static const struct tftinitcmd initst7789[] = {
+    { 0x01, 0, 150, { 0 } },                 /* Software reset */
+    { 0x11, 0, 120, { 0 } },                 /* Sleep out */
+    { 0x3A, 1,  10, { 0x55 } },              /* Pixel format: 16 bit */
+    { 0x36, 1,   0, { 0x00 } },              /* Memory access: default, RGB */
+    { 0x21, 0,  10, { 0 } },                 /* Inversion on - ST7789 panels need it */
+    { 0x13, 0,  10, { 0 } },                 /* Normal display mode */
+    { 0x29, 0,  20, { 0 } },                 /* Display on */
+};
+
+/* Send a command and its parameters. Must not be called while a band
+ * transfer is still running. */
+static esp_err_t spitft_sendcmd(uint8_t cmd, const uint8_t * data, size_t len)
+{
+    spi_transaction_t t;
+    memset(&t, 0, sizeof(t));
+    t.flags = SPI_TRANS_USE_TXDATA;
+    t.length = 8;
+    t.tx_data[0] = cmd;
+    gpio_set_level(dcpin, 0);
+    esp_err_t res = spi_device_polling_transmit(tftspi, &t);
+    if ((res != ESP_OK) || (len == 0)) {
+      return res;
+    }
+    memset(&t, 0, sizeof(t));
+    t.length = len * 8;
+    if (len <= 4) {
+      t.flags = SPI_TRANS_USE_TXDATA;
+      memcpy(t.tx_data, data, len);
+    } else {
+      t.tx_buffer = data;
+    }
+    gpio_set_level(dcpin, 1);
+    return spi_device_polling_transmit(tftspi, &t);
+}
+
+/* FNV-1a over one row of pixels, a word at a time. */
+static uint32_t spitft_hashrow(const uint8_t * row)
+{
+    const uint32_t * p = (const uint32_t *)row;
+    uint32_t h = 2166136261U;
+    for (int i = 0; i < ((TFT_SIZEX * 2) / 4); i++) {
+      h = (h ^ p[i]) * 16777619U;
+    }
+    return h;
+}
+
+/* Wait for the band transfer that is still running (if any). */
+static void spitft_waitband(void)
+{
+    if (bandinflight) {
+      spi_transaction_t * rt;
+      spi_device_get_trans_result(tftspi, &rt, portMAX_DELAY);
+      bandinflight = 0;
+    }
+}
+
+int spitft_init(void)
+{
+    if ((settings.di_spi_sck == 0) || (settings.di_spi_mosi == 0)
+     || (settings.di_spi_cs == 0) || (settings.di_spi_dc == 0)) {
+      ESP_LOGW(TAG, "WARNING: TFT display disabled because not all of its pins are configured.");
+      return 1;
+    }
+    dcpin = settings.di_spi_dc - 1;
+    gpio_reset_pin(dcpin);
+    gpio_set_direction(dcpin, GPIO_MODE_OUTPUT);
+    spi_bus_config_t bc = {
+      .mosi_io_num = settings.di_spi_mosi - 1,
+      .miso_io_num = -1,
+      .sclk_io_num = settings.di_spi_sck - 1,
+      .quadwp_io_num = -1,
+      .quadhd_io_num = -1,
+      .max_transfer_sz = TFT_SIZEX * TFT_BANDH * 2
+    };
+    if (spi_bus_initialize(SPI2_HOST, &bc, SPI_DMA_CH_AUTO) != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to initialize SPI bus for TFT display.");
+      return 1;
+    }
+    spi_device_interface_config_t dc = {
+      .mode = 0,
+      .clock_speed_hz = TFT_SPICLOCK,
+      .spics_io_num = settings.di_spi_cs - 1,
+      .queue_size = 1
+    };
+    if (spi_bus_add_device(SPI2_HOST, &dc, &tftspi) != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to add TFT display to SPI bus.");
+      return 1;
+    }
+    /* The reset pin is optional, many modules tie it to VCC. */
+    if (settings.di_spi_rst != 0) {
+      gpio_num_t rstpin = settings.di_spi_rst - 1;
+      gpio_reset_pin(rstpin);
+      gpio_set_direction(rstpin, GPIO_MODE_OUTPUT);
+      gpio_set_level(rstpin, 0);
+      vTaskDelay(pdMS_TO_TICKS(10));
+      gpio_set_level(rstpin, 1);
+      vTaskDelay(pdMS_TO_TICKS(120));
+    }
+    const struct tftinitcmd * ic = initst7789;
+    int nric = sizeof(initst7789) / sizeof(initst7789[0]);
+    if (settings.di_type == DI_DT_ILI9341) {
+      ic = initili9341;
+      nric = sizeof(initili9341) / sizeof(initili9341[0]);
+    }
+    for (int i = 0; i < nric; i++) {
+      if (spitft_sendcmd(ic[i].cmd, ic[i].data, ic[i].len) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to send initialization to TFT display.");
+        return 1;
+      }
+      if (ic[i].delayms > 0) {
+        vTaskDelay(pdMS_TO_TICKS(ic[i].delayms));
+      }
+    }
+    bandinflight = 0;
+    rowhashvalid = 0;
+    return 0;
+}
+
+void spitft_display(struct di_dispbuf * db)
+{
+    if ((db->bpp != 16) || (db->sizex != TFT_SIZEX) || (db->sizey != TFT_SIZEY)) {
+      ESP_LOGE(TAG, "Display buffer format does not match the display.");
+      return;
+    }
+    if (spare == NULL) {
+      spare = heap_caps_malloc(db->contsize, MALLOC_CAP_DMA);
+      if (spare == NULL) {
+        ESP_LOGW(TAG, "No memory for a second band buffer, bands will be sent one at a time.");
+      }
+    }
+    /* Find the rows in this band that changed. This can run while the
+     * previous band is still being sent. */
+    if (db->bandy == 0) {
+      sendfailed = 0;
+    }
+    int r1 = db->bandh; int r2 = -1;
+    for (int r = 0; r < db->bandh; r++) {
+      uint32_t h = spitft_hashrow(&db->cont[r * TFT_SIZEX * 2]);
+      if ((!rowhashvalid) || (h != rowhash[db->bandy + r])) {
+        rowhash[db->bandy + r] = h;
+        if (r < r1) r1 = r;
+        r2 = r;
+      }
+    }
+    if ((db->bandy + db->bandh) >= TFT_SIZEY) {
+      /* All rows have a hash now. Unless something could not be sent:
+       * then we no longer know what the display shows. */
+      rowhashvalid = !sendfailed;
+    }
+    if (r2 < r1) { /* nothing changed */
+      bytessaved += db->bandh * TFT_SIZEX * 2;
+      di_cleardirty(db);
+      return;
+    }
+    bytessaved += (db->bandh - (r2 - r1 + 1)) * TFT_SIZEX * 2;
+    /* Commands cannot be sent while the previous band is still on its way. */
+    spitft_waitband();
+    int y1 = db->bandy + r1;
+    int y2 = db->bandy + r2;
+    uint8_t caset[4] = { 0, 0, (TFT_SIZEX - 1) >> 8, (TFT_SIZEX - 1) & 0xff };
+    uint8_t raset[4] = { y1 >> 8, y1 & 0xff, y2 >> 8, y2 & 0xff };
+    spitft_sendcmd(0x2A, caset, 4);           /* Column address set */
+    spitft_sendcmd(0x2B, raset, 4);           /* Row address set */
+    spitft_sendcmd(0x2C, NULL, 0);            /* Memory write */
+    memset(&bandtrans, 0, sizeof(bandtrans));
+    bandtrans.length = db->sizex * (r2 - r1 + 1) * 16;
+    bandtrans.tx_buffer = &db->cont[r1 * TFT_SIZEX * 2];
+    gpio_set_level(dcpin, 1);                 /* stays data until we wait for the result */
+    if (spare == NULL) {
+      if (spi_device_transmit(tftspi, &bandtrans) != ESP_OK) {
+        sendfailed = 1;
+        rowhashvalid = 0;
+      }
+    } else if (spi_device_queue_trans(tftspi, &bandtrans, portMAX_DELAY) != ESP_OK) {
+      sendfailed = 1;
+      rowhashvalid = 0;
+    } else {
+      bandinflight = 1;
+      /* Draw the next band into the other buffer. */
+      uint8_t * tmp = db->cont;
+      db->cont = spare;
+      spare = tmp;
+    }
+    di_cleardirty(db);
+}
+
+uint32_t spitft_getbytessaved(void)
+{
+    return bytessaved;
+}
+
+const struct di_driver spitft_driver_ili9341 = {
+    .type = DI_DT_ILI9341, .sizex = TFT_SIZEX, .sizey = TFT_SIZEY,
+    .bpp = 16, .bandh = TFT_BANDH,
+    .init = spitft_init, .display = spitft_display,
+    .getbytessaved = spitft_getbytessaved
+};
+
+const struct di_driver spitft_driver_st7789 = {
+    .type = DI_DT_ST7789, .sizex = TFT_SIZEX, .sizey = TFT_SIZEY,
+    .bpp = 16, .bandh = TFT_BANDH,
+    .init = spitft_init, .display = spitft_display,
+    .getbytessaved = spitft_getbytessaved
+};
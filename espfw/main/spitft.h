@@ -0,0 +1,24 @@
+/* Talking to SPI TFT color displays with ILI9341 or ST7789 controller */
+
+#ifndef _SPITFT_H_
+#define _SPITFT_H_
+
+#include "displays.h"
+
+/* The drivers for displays.c. */
+extern const struct di_driver spitft_driver_ili9341;
+extern const struct di_driver spitft_driver_st7789;
+
+/* Initialize the TFT display. Returns 0 on success. */
+int spitft_init(void);
+
+/* Send one band of a (16 bpp) dispbuf to the display. Only rows that
+ * changed since the last frame are sent. This only starts the transfer,
+ * which then runs in the background with DMA, while the next band is
+ * drawn into a second buffer. */
+void spitft_display(struct di_dispbuf * db);
+
+/* Number of bytes not sent because the rows had not changed. */
+uint32_t spitft_getbytessaved(void);
+
+#endif /* _SPITFT_H_ */
@@ -2,6 +2,7 @@
 
 #include <driver/i2c_master.h>
 #include <esp_log.h>
+#include <string.h>
 #include "i2c.h"
 #include "ssd130x.h"
 #include "sdkconfig.h"
@@ -9,10 +10,18 @@
 
 #define SSD130XBASEADDR 0x3c /* address is 0x3c or 0x3d, depending on how pin SA0 is wired. */
 
-#define I2C_MASTER_TIMEOUT_MS 1000  /* Timeout for I2C communication */
+/* Timeout for I2C communication. Even a full page (129 bytes) takes less
+ * than 15 ms at 100 kHz. This is kept short because the display may share
+ * its bus with sensors, which cannot use the bus while we wait. */
+#define I2C_MASTER_TIMEOUT_MS 100
 
 static i2c_master_dev_handle_t ssd130xi2cdev;
 
+/* What we last sent to the display, for partial updates. */
+static uint8_t shadow[128 * 8];
+static int shadowvalid = 0;
+static uint32_t bytessaved = 0;
+
 /* A very short summary of the protocol the display uses:
  * After addressing the display, there is always a 'control' byte, which
  * mainly determines whether the following byte(s) are a 'command' or 'data',
@@ -64,10 +73,10 @@ static int ssd130x_isoneofours(uint8_t dt)
     return 0;
 }
 
-void ssd130x_init(void)
+int ssd130x_init(void)
 {
     if (ssd130x_isoneofours(settings.di_type) != 1) {
-      return;
+      return 1;
     }
     if (settings.di_i2cport > 0) {
       /* An I2C-port is configured, but is that port disabled? */
@@ -78,7 +87,8 @@ void ssd130x_init(void)
         ESP_LOGW("ssd130x.c", "WARNING: SSD130X display automatically disabled because it is connected to a disabled I2C port.");
       }
     }
-    if (settings.di_i2cport == 0) return;
+    if (settings.di_i2cport == 0) return 1;
+    shadowvalid = 0;
 #if 0 /* FIXME setting not implemented yet */
     uint8_t ssd130xaddr = SSD130XBASEADDR + settings.ssd130x_addr;
 #else
@@ -92,6 +102,7 @@ void ssd130x_init(void)
     };
     if (i2c_master_bus_add_device(i2c_bushandles[settings.di_i2cport - 1], &dc, &ssd130xi2cdev) != ESP_OK) {
       ESP_LOGW("ssd130x.c", "WARNING: i2c_master_bus_add_device failed for SCD130x.");
+      return 1;
     }
 
     /* The initialization sequence is essentially copy+paste from the datasheet
@@ -130,6 +141,7 @@ void ssd130x_init(void)
     ssd130x_sendcommand1(0xA4);        /* Display ON, output follows RAM contents */
     ssd130x_sendcommand1(0xA6);        /* Normal non-inverted display (A7 to invert) */
     ssd130x_sendcommand1(0xAF);        /* Display ON in normal mode */
+    return 0;
 }
 
 void ssd130x_display(struct di_dispbuf * db)
@@ -141,40 +153,76 @@ void ssd130x_display(struct di_dispbuf * db)
     /* The display has a somewhat weird memory layout: Each byte in memory
      * addresses one column for 8 rows, with the LSB being (relative) row 0 and
      * the MSB being (relative) row 7. There are 8 "pages". Each page contains
-     * 128 bytes of memory, for 128 columns times 8 rows. */
+     * 128 bytes of memory, for 128 columns times 8 rows.
+     * Our display buffer uses exactly the same layout, so with horizontal
+     * addressing mode we can send (parts of) it as is. */
+    if ((db->bpp != 1) || (db->sizex != 128) || (db->sizey != 64)) {
+      ESP_LOGE("ssd130x.c", "Display buffer format does not match the display.");
+      return;
+    }
+    /* Send only the changed part of every page. This costs two address
+     * commands (4 bytes each) and a control byte per page, so for every page
+     * that is sent we send 9 bytes more than the data. */
+    static const uint8_t ctrl = (CONTROL_DATA | CONTROL_NOCO);
+    int fullsize = 4 + 8 + 1 + (8 * 128); /* commands + all data in one go */
+    int sent = 4; /* addressing mode command */
+    int x1 = db->dirtyx1; int y1 = db->dirtyy1;
+    int x2 = db->dirtyx2; int y2 = db->dirtyy2;
+    int allok = 1;
+    if (!shadowvalid) { /* we don't know what the display shows: send all */
+      x1 = 0; y1 = 0; x2 = 127; y2 = 63;
+    }
     ssd130x_sendcommand2(0x20, 0x00);     /* Set horizontal addressing mode */
-    ssd130x_sendcommand3(0x21,   0, 127); /* Set column start and end address */
-    ssd130x_sendcommand3(0x22,   0,   7); /* Set page start and end address */
-    uint8_t sndbuf[129];
-    for (int page = 0; page < 8; page++) {
-      sndbuf[0] = (CONTROL_DATA | CONTROL_NOCO);
-      for (int col = 0; col < 128; col++) {
-        int rs = page * 8;
-        uint8_t b = 0;
-        for (int row = 0; row < 8; row++) {
-          uint8_t p = di_getpixelbw(db, col, (rs + row));
-          if (p > 0x80) {
-            b |= (1U << row);
-          }
+    if (x2 >= x1) {
+      for (int page = (y1 >> 3); page <= (y2 >> 3); page++) {
+        const uint8_t * np = &db->cont[page * 128];
+        uint8_t * op = &shadow[page * 128];
+        int c1 = x1;
+        int c2 = x2;
+        if (shadowvalid) {
+          /* Shrink the column range to what actually changed. */
+          while ((c1 <= c2) && (np[c1] == op[c1])) c1++;
+          while ((c2 >= c1) && (np[c2] == op[c2])) c2--;
+          if (c1 > c2) continue; /* nothing changed in this page */
         }
-        sndbuf[col + 1] = b;
-      }
-#if 0
-      for (int row = 0; row < 8; row++) {
-        uint8_t opb[200];
-        for (int col = 0; col < 128; col++) {
-          if ((sndbuf[col + 1] & (1U << row)) > 0) {
-            opb[col] = 'X';
-          } else {
-            opb[col] = ' ';
-          }
+        ssd130x_sendcommand3(0x21,  c1,   c2); /* Set column start and end address */
+        ssd130x_sendcommand3(0x22, page, page); /* Set page start and end address */
+        i2c_master_transmit_multi_buffer_info_t bufs[2] = {
+          { .write_buffer = &ctrl, .buffer_size = 1 },
+          { .write_buffer = &np[c1], .buffer_size = c2 - c1 + 1 }
+        };
+        if (i2c_master_multi_buffer_transmit(ssd130xi2cdev, bufs, 2,
+                                             I2C_MASTER_TIMEOUT_MS) == ESP_OK) {
+          memcpy(&op[c1], &np[c1], c2 - c1 + 1);
+        } else {
+          allok = 0;
         }
-        opb[128] = 0;
-        ESP_LOGI("debug-display", "%s", opb);
+        sent += 9 + (c2 - c1 + 1);
       }
-#endif
-      i2c_master_transmit(ssd130xi2cdev, sndbuf, 129,
-                          I2C_MASTER_TIMEOUT_MS);
+    }
+    /* If anything failed, we do not know what the display shows now. */
+    shadowvalid = allok;
+    di_cleardirty(db);
+    if (sent < fullsize) {
+      bytessaved += fullsize - sent;
     }
 }
 
+uint32_t ssd130x_getbytessaved(void)
+{
+    return bytessaved;
+}
+
+const struct di_driver ssd130x_driver_ssd1306 = {
+    .type = DI_DT_SSD1306_1, .sizex = 128, .sizey = 64, .bpp = 1,
+    .wearlevel = 1,
+    .init = ssd130x_init, .display = ssd130x_display,
+    .getbytessaved = ssd130x_getbytessaved
+};
+
+const struct di_driver ssd130x_driver_ssd1309 = {
+    .type = DI_DT_SSD1309_1, .sizex = 128, .sizey = 64, .bpp = 1,
+    .wearlevel = 1,
+    .init = ssd130x_init, .display = ssd130x_display,
+    .getbytessaved = ssd130x_getbytessaved
+};
@@ -6,11 +6,19 @@
 
 #include "displays.h"
 
-/* Initialize the SSD130x based display module */
-void ssd130x_init(void);
+/* The drivers for displays.c. */
+extern const struct di_driver ssd130x_driver_ssd1306;
+extern const struct di_driver ssd130x_driver_ssd1309;
 
-/* Display a dispbuf on that display */
+/* Initialize the SSD130x based display module. Returns 0 on success. */
+int ssd130x_init(void);
+
+/* Display a dispbuf on that display. Only the parts that changed since
+ * the last call are actually sent. */
 void ssd130x_display(struct di_dispbuf * db);
 
+/* Number of bytes not sent because they had not changed. */
+uint32_t ssd130x_getbytessaved(void);
+
 #endif /* _SSD130X_H_ */
 
@@ -43,6 +43,8 @@ const uint8_t * st_to_name(enum sensortypes st)
   case ST_PM025:       return "PM2.5";
   case ST_PM040:       return "PM4.0";
   case ST_PM100:       return "PM10";
+  case ST_VOCINDEX:    return "VOCindex";
+  case ST_NOXINDEX:    return "NOxindex";
   default:             return "UNKNOWN";
   };
 }
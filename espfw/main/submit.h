@@ -15,7 +15,9 @@ enum sensortypes {
   ST_PM025 = 6,
   ST_PM040 = 7,
   ST_PM100 = 8,
-  NR_SENSORTYPES = 9
+  ST_VOCINDEX = 9,
+  ST_NOXINDEX = 10,
+  NR_SENSORTYPES = 11
 };
 
 /* Converts the sensortype to a human readable string */
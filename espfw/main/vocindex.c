@@ -0,0 +1,193 @@
+/* Calculating the VOC index from the raw SGP40 signal. See vocindex.h. */
+
+#include <math.h>
+#include <string.h>
+#include "vocindex.h"
+
+/* The default tuning parameters */
+#define VI_INDEXOFFSET      100.0 /* index for "average" air */
+#define VI_LEARNTIMEOFFSET   12.0 /* hours */
+#define VI_LEARNTIMEGAIN     12.0 /* hours */
+#define VI_GATINGMAXMINUTES 180.0
+#define VI_STDINITIAL        50.0
+#define VI_GAINFACTOR       230.0
+
+/* Constants of the algorithm */
+#define VI_BLACKOUT          45.0 /* seconds without an index after start */
+#define VI_SRAWMIN        20000
+#define VI_SRAWSTDBONUS     220.0
+#define VI_TAUINITMEAN       20.0
+#define VI_INITDURMEAN     (3600.0 * 0.75)
+#define VI_INITTRANSMEAN      0.01
+#define VI_TAUINITVARIANCE 2500.0
+#define VI_INITDURVARIANCE (3600.0 * 1.45)
+#define VI_INITTRANSVARIANCE  0.01
+#define VI_GATINGTHR        340.0
+#define VI_GATINGTHRINITIAL 510.0
+#define VI_GATINGTHRTRANS     0.09
+#define VI_GATINGMAXRATIO     0.3
+#define VI_SIGMOIDL         500.0
+#define VI_SIGMOIDK          -0.0065
+#define VI_SIGMOIDX0        213.0
+#define VI_LPTAUFAST         20.0
+#define VI_LPTAUSLOW        500.0
+#define VI_LPALPHA           -0.2
+#define VI_GAMMASCALING      64.0
+#define VI_ADDGAMMAMEANSCALING 8.0
+#define VI_UPTIMELIMIT    (32767.0 - VI_SAMPLEINTERVAL)
+
+/* The per-sample learning rates for mean and variance, after and during
+ * the initial learning phase. */
+#define VI_GAMMAMEAN ((VI_ADDGAMMAMEANSCALING * VI_GAMMASCALING * (VI_SAMPLEINTERVAL / 3600.0)) \
+                      / (VI_LEARNTIMEOFFSET + (VI_SAMPLEINTERVAL / 3600.0)))
+#define VI_GAMMAVARIANCE ((VI_GAMMASCALING * (VI_SAMPLEINTERVAL / 3600.0)) \
+                          / (VI_LEARNTIMEGAIN + (VI_SAMPLEINTERVAL / 3600.0)))
+#define VI_GAMMAINITMEAN ((VI_ADDGAMMAMEANSCALING * VI_GAMMASCALING * VI_SAMPLEINTERVAL) \
+                          / (VI_TAUINITMEAN + VI_SAMPLEINTERVAL))
+#define VI_GAMMAINITVARIANCE ((VI_GAMMASCALING * VI_SAMPLEINTERVAL) \
+                              / (VI_TAUINITVARIANCE + VI_SAMPLEINTERVAL))
+
+void vi_init(struct vocindex * vi)
+{
+    memset(vi, 0, sizeof(struct vocindex));
+    vi->mvstd = VI_STDINITIAL;
+    vi->mmstd = VI_STDINITIAL;
+}
+
+/* A falling sigmoid from 1 to 0, centered at x0. */
+static float vi_sigmoid(float x, float x0, float k)
+{
+    float e = k * (x - x0);
+    if (e < -50.0f) return 1.0f;
+    if (e > 50.0f) return 0.0f;
+    return 1.0f / (1.0f + expf(e));
+}
+
+/* Calculates the learning rates for this sample. They start high, so the
+ * algorithm quickly learns its environment, and decrease to the long term
+ * values. Learning is suspended ("gated") while the index is high, so a
+ * long VOC event does not become the new normal - but only for at most
+ * VI_GATINGMAXMINUTES. */
+static void vi_calcgamma(struct vocindex * vi)
+{
+    if (vi->uptimegamma < VI_UPTIMELIMIT) {
+      vi->uptimegamma += VI_SAMPLEINTERVAL;
+    }
+    if (vi->uptimegating < VI_UPTIMELIMIT) {
+      vi->uptimegating += VI_SAMPLEINTERVAL;
+    }
+    float sgammamean = vi_sigmoid(vi->uptimegamma, VI_INITDURMEAN, VI_INITTRANSMEAN);
+    float gammamean = VI_GAMMAMEAN + ((VI_GAMMAINITMEAN - VI_GAMMAMEAN) * sgammamean);
+    float gatingthrmean = VI_GATINGTHR + ((VI_GATINGTHRINITIAL - VI_GATINGTHR)
+                        * vi_sigmoid(vi->uptimegating, VI_INITDURMEAN, VI_INITTRANSMEAN));
+    float sgatingmean = vi_sigmoid(vi->index, gatingthrmean, VI_GATINGTHRTRANS);
+    vi->gammamean = sgatingmean * gammamean;
+    float sgammavariance = vi_sigmoid(vi->uptimegamma, VI_INITDURVARIANCE, VI_INITTRANSVARIANCE);
+    float gammavariance = VI_GAMMAVARIANCE + ((VI_GAMMAINITVARIANCE - VI_GAMMAVARIANCE)
+                        * (sgammavariance - sgammamean));
+    float gatingthrvariance = VI_GATINGTHR + ((VI_GATINGTHRINITIAL - VI_GATINGTHR)
+                        * vi_sigmoid(vi->uptimegating, VI_INITDURVARIANCE, VI_INITTRANSVARIANCE));
+    float sgatingvariance = vi_sigmoid(vi->index, gatingthrvariance, VI_GATINGTHRTRANS);
+    vi->gammavariance = sgatingvariance * gammavariance;
+    vi->gatingminutes += (VI_SAMPLEINTERVAL / 60.0f)
+                       * (((1.0f - sgatingmean) * (1.0f + VI_GATINGMAXRATIO)) - VI_GATINGMAXRATIO);
+    if (vi->gatingminutes < 0.0f) {
+      vi->gatingminutes = 0.0f;
+    }
+    if (vi->gatingminutes > VI_GATINGMAXMINUTES) {
+      vi->uptimegating = 0.0f;
+    }
+}
+
+/* Updates the estimation of mean and standard deviation with sraw. */
+static void vi_meanvariance(struct vocindex * vi, float sraw)
+{
+    if (!vi->mvinit) {
+      vi->mvinit = 1;
+      vi->mvoffset = sraw;
+      vi->mvmean = 0.0f;
+      return;
+    }
+    /* Keep mvmean small, for precision */
+    if ((vi->mvmean >= 100.0f) || (vi->mvmean <= -100.0f)) {
+      vi->mvoffset += vi->mvmean;
+      vi->mvmean = 0.0f;
+    }
+    sraw -= vi->mvoffset;
+    vi_calcgamma(vi);
+    float delta = (sraw - vi->mvmean) / VI_GAMMASCALING;
+    float c = vi->mvstd + fabsf(delta);
+    float addscaling = 1.0f;
+    if (c > 1440.0f) {
+      addscaling = (c / 1440.0f) * (c / 1440.0f);
+    }
+    vi->mvstd = sqrtf(addscaling * (VI_GAMMASCALING - vi->gammavariance))
+              * sqrtf((vi->mvstd * (vi->mvstd / (VI_GAMMASCALING * addscaling)))
+                      + (((vi->gammavariance * delta) / addscaling) * delta));
+    vi->mvmean += (vi->gammamean * delta) / VI_ADDGAMMAMEANSCALING;
+}
+
+/* The lowpass at the output: fast for large changes, slow for noise. */
+static float vi_lowpass(struct vocindex * vi, float v)
+{
+    const float a1 = VI_SAMPLEINTERVAL / (VI_LPTAUFAST + VI_SAMPLEINTERVAL);
+    const float a2 = VI_SAMPLEINTERVAL / (VI_LPTAUSLOW + VI_SAMPLEINTERVAL);
+    if (!vi->lpinit) {
+      vi->lpinit = 1;
+      vi->lpx1 = v;
+      vi->lpx2 = v;
+      vi->lpx3 = v;
+    }
+    vi->lpx1 = ((1.0f - a1) * vi->lpx1) + (a1 * v);
+    vi->lpx2 = ((1.0f - a2) * vi->lpx2) + (a2 * v);
+    float f1 = expf(VI_LPALPHA * fabsf(vi->lpx1 - vi->lpx2));
+    float taua = ((VI_LPTAUSLOW - VI_LPTAUFAST) * f1) + VI_LPTAUFAST;
+    float a3 = VI_SAMPLEINTERVAL / (VI_SAMPLEINTERVAL + taua);
+    vi->lpx3 = ((1.0f - a3) * vi->lpx3) + (a3 * v);
+    return vi->lpx3;
+}
+
+int vi_process(struct vocindex * vi, uint16_t sraw)
+{
+    if (vi->uptime <= VI_BLACKOUT) {
+      /* The sensor needs a moment to settle after power on. */
+      vi->uptime += VI_SAMPLEINTERVAL;
+      return (int)(vi->index + 0.5f);
+    }
+    if ((sraw > 0) && (sraw < 65000)) {
+      int s = sraw;
+      if (s < (VI_SRAWMIN + 1)) {
+        s = VI_SRAWMIN + 1;
+      } else if (s > (VI_SRAWMIN + 32767)) {
+        s = VI_SRAWMIN + 32767;
+      }
+      vi->sraw = s - VI_SRAWMIN;
+    } /* otherwise reuse the last valid value */
+    /* How far from its usual value is the signal, in standard deviations?
+     * Note that more VOCs mean a lower raw value. */
+    float v = ((vi->sraw - vi->mmmean) / (-(vi->mmstd + VI_SRAWSTDBONUS))) * VI_GAINFACTOR;
+    /* Map that to the index. With the default offset of 100, the shift
+     * the sigmoid needs to hit that is 0. */
+    float e = VI_SIGMOIDK * (v - VI_SIGMOIDX0);
+    float shift = (VI_SIGMOIDL - (5.0f * VI_INDEXOFFSET)) / 4.0f;
+    if (e < -50.0f) {
+      v = VI_SIGMOIDL;
+    } else if (e > 50.0f) {
+      v = 0.0f;
+    } else if (v >= 0.0f) {
+      v = ((VI_SIGMOIDL + shift) / (1.0f + expf(e))) - shift;
+    } else {
+      v = VI_SIGMOIDL / (1.0f + expf(e));
+    }
+    v = vi_lowpass(vi, v);
+    if (v < 0.5f) {
+      v = 0.5f;
+    }
+    vi->index = v;
+    if (vi->sraw > 0.0f) {
+      vi_meanvariance(vi, vi->sraw);
+      vi->mmstd = vi->mvstd;
+      vi->mmmean = vi->mvmean + vi->mvoffset;
+    }
+    return (int)(vi->index + 0.5f);
+}
@@ -0,0 +1,52 @@
+/* Calculating the VOC index from the raw SGP40 signal.
+ * The SGP40 only delivers a raw resistance value, which drifts and
+ * differs from sensor to sensor. Sensirion's gas index algorithm turns
+ * it into an index: it learns the average raw value of the environment
+ * and its variance over the last hours, and maps the difference to that
+ * through a sigmoid. 100 means "as usual", up to 500 means (a lot) more
+ * VOCs than usual, below 100 means less. This follows the algorithm as
+ * described and published by Sensirion, with the default tuning. It
+ * needs to be fed exactly one sample per second.
+ * This does not use anything ESP specific, so it can be run on a PC. */
+
+#ifndef _VOCINDEX_H_
+#define _VOCINDEX_H_
+
+#include <inttypes.h>
+
+/* The algorithm only works with this sampling interval. */
+#define VI_SAMPLEINTERVAL 1.0 /* seconds */
+
+struct vocindex {
+  float uptime;       /* seconds since start, until the blackout is over */
+  float sraw;         /* the last valid raw value, minus VI_SRAWMIN */
+  float index;        /* the last index, as float */
+  /* Adaptive estimation of mean and standard deviation of sraw */
+  uint8_t mvinit;     /* set once we had the first sample */
+  float mvmean;       /* mean, relative to mvoffset */
+  float mvoffset;
+  float mvstd;
+  float gammamean;    /* learning rates, for the current sample */
+  float gammavariance;
+  float uptimegamma;
+  float uptimegating;
+  float gatingminutes;
+  /* The mean and std the index is calculated with */
+  float mmmean;
+  float mmstd;
+  /* The adaptive lowpass at the output */
+  uint8_t lpinit;
+  float lpx1;
+  float lpx2;
+  float lpx3;
+};
+
+/* (Re)starts the algorithm, forgetting everything learned. */
+void vi_init(struct vocindex * vi);
+
+/* Processes one raw value from the SGP40, and returns the VOC index
+ * (1 to 500). During the first 45 seconds this returns 0, meaning "no
+ * index yet". */
+int vi_process(struct vocindex * vi, uint16_t sraw);
+
+#endif /* _VOCINDEX_H_ */
@@ -0,0 +1,144 @@
+/* Evening out the wear of OLED displays. See wearlevel.h. */
+
+#include <stdlib.h>
+#include <string.h>
+#include "wearlevel.h"
+
+int wl_init(struct wearlevel * wl, int sizex, int sizey)
+{
+    memset(wl, 0, sizeof(struct wearlevel));
+    wl->ontime = calloc(sizex * sizey, sizeof(uint16_t));
+    if (wl->ontime == NULL) {
+      return 1;
+    }
+    wl->sizex = sizex;
+    wl->sizey = sizey;
+    wl->lastframems = -1;
+    wl->lastshiftms = -1;
+    return 0;
+}
+
+/* Adds secs to the ontime of every pixel lit in db. */
+static void wl_account(struct wearlevel * wl, struct di_dispbuf * db, uint16_t secs)
+{
+    if ((wl->maxontime + secs) > 0xffff) {
+      for (int i = 0; i < (wl->sizex * wl->sizey); i++) {
+        wl->ontime[i] >>= 1;
+      }
+      wl->maxontime >>= 1;
+    }
+    wl->maxontime += secs;
+    for (int page = 0; page < ((wl->sizey + 7) / 8); page++) {
+      const uint8_t * p = &db->cont[page * wl->sizex];
+      for (int x = 0; x < wl->sizex; x++) {
+        uint8_t b = p[x];
+        while (b != 0) {
+          int y = (page * 8) + __builtin_ctz(b);
+          wl->ontime[(y * wl->sizex) + x] += secs;
+          b &= b - 1;
+        }
+      }
+    }
+}
+
+/* How much wear showing db would add to already worn pixels. Also
+ * returns how many pixels are lit in *nrlit. */
+static uint64_t wl_cost(const struct wearlevel * wl, const struct di_dispbuf * db,
+                        uint32_t * nrlit)
+{
+    uint64_t res = 0;
+    uint32_t n = 0;
+    for (int page = 0; page < ((wl->sizey + 7) / 8); page++) {
+      const uint8_t * p = &db->cont[page * wl->sizex];
+      for (int x = 0; x < wl->sizex; x++) {
+        uint8_t b = p[x];
+        while (b != 0) {
+          int y = (page * 8) + __builtin_ctz(b);
+          res += wl->ontime[(y * wl->sizex) + x];
+          n++;
+          b &= b - 1;
+        }
+      }
+    }
+    *nrlit = n;
+    return res;
+}
+
+/* Try all possible shifts, and take the one that lights the least worn
+ * pixels. Shifts that move lit pixels off the display don't count:
+ * they would look cheaper only because part of the picture is missing.
+ * nrlit is the number of pixels lit without a shift. On a tie we stay
+ * where we are. */
+static void wl_pickshift(struct wearlevel * wl, struct di_dispbuf * db,
+                         di_drawfn_t drawfn, const void * snap, uint32_t nrlit)
+{
+    int8_t bestx = 0;
+    int8_t besty = 0;
+    uint64_t bestcost = UINT64_MAX;
+    for (int sy = -WL_MAXSHIFTY; sy <= WL_MAXSHIFTY; sy++) {
+      for (int sx = -WL_MAXSHIFTX; sx <= WL_MAXSHIFTX; sx++) {
+        db->originx = sx;
+        db->originy = sy;
+        drawfn(db, snap);
+        uint32_t n;
+        uint64_t c = wl_cost(wl, db, &n);
+        if (n < nrlit) continue;
+        int iscur = ((sx == wl->shiftx) && (sy == wl->shifty));
+        if ((c < bestcost) || ((c == bestcost) && iscur)) {
+          bestcost = c;
+          bestx = sx;
+          besty = sy;
+        }
+      }
+    }
+    wl->shiftx = bestx;
+    wl->shifty = besty;
+}
+
+void wl_drawframe(struct wearlevel * wl, struct di_dispbuf * db,
+                  di_drawfn_t drawfn, const void * snap, int64_t nowms)
+{
+    if ((db->bpp != 1) || (db->sizex != wl->sizex) || (db->sizey != wl->sizey)) {
+      db->originx = 0;
+      db->originy = 0;
+      drawfn(db, snap);
+      return;
+    }
+    /* The frame still in db has been shown until now. */
+    if (wl->lastframems < 0) {
+      wl->lastframems = nowms;
+    }
+    int64_t secs = (nowms - wl->lastframems) / 1000;
+    if (secs > 0) {
+      wl_account(wl, db, (secs > 3600) ? 3600 : secs);
+      wl->lastframems += secs * 1000;
+    }
+    /* Without a shift, nothing is lost, so that is what every shift
+     * needs to match. */
+    uint32_t nrlit;
+    db->originx = 0;
+    db->originy = 0;
+    drawfn(db, snap);
+    wl_cost(wl, db, &nrlit);
+    if ((wl->lastshiftms < 0) || ((nowms - wl->lastshiftms) >= WL_SHIFTINTERVALMS)) {
+      wl_pickshift(wl, db, drawfn, snap, nrlit);
+      wl->lastshiftms = nowms;
+    } else if ((wl->shiftx != 0) || (wl->shifty != 0)) {
+      /* The page might have changed to one that does not fit at the
+       * current shift. Then we can't wait for the next interval. */
+      uint32_t n;
+      db->originx = wl->shiftx;
+      db->originy = wl->shifty;
+      drawfn(db, snap);
+      wl_cost(wl, db, &n);
+      if (n >= nrlit) {
+        return;
+      }
+      wl_pickshift(wl, db, drawfn, snap, nrlit);
+    } else {
+      return;
+    }
+    db->originx = wl->shiftx;
+    db->originy = wl->shifty;
+    drawfn(db, snap);
+}
@@ -0,0 +1,48 @@
+/* Evening out the wear of OLED displays.
+ * OLED pixels get dimmer the longer they are lit, so a picture that is
+ * always shown at the same place burns in. Instead of showing everything
+ * inverted half of the time (which lights every pixel for at least half
+ * of the time), we keep track of how long every pixel has been lit, and
+ * every now and then move the whole picture by a few pixels, to where it
+ * lights the pixels that have been lit the least, as long as no part of
+ * the picture is moved off the display there. As the picture is only
+ * moved every few minutes, the frames in between still only differ in
+ * what actually changed, so drivers can keep sending only that.
+ * This does not use anything ESP specific, so it can be run on a PC. */
+
+#ifndef _WEARLEVEL_H_
+#define _WEARLEVEL_H_
+
+#include <inttypes.h>
+#include "displays.h"
+
+/* How far the picture may be moved from where it was drawn. */
+#define WL_MAXSHIFTX 2
+#define WL_MAXSHIFTY 1
+/* How often we think about moving it. */
+#define WL_SHIFTINTERVALMS (120 * 1000)
+
+struct wearlevel {
+  uint16_t sizex;
+  uint16_t sizey;
+  /* For how many seconds each pixel has been lit. When one would
+   * overflow, all of them get halved - only the differences matter. */
+  uint16_t * ontime;
+  uint32_t maxontime;   /* upper bound for all values in ontime */
+  int64_t lastframems;  /* up to when ontime is up to date, -1 at start */
+  int64_t lastshiftms;  /* when we last picked a shift, -1 at start */
+  int8_t shiftx;        /* the current shift */
+  int8_t shifty;
+};
+
+/* Initialize for a 1 bpp display of the given size. Returns 0 on
+ * success, or 1 if there is not enough memory. */
+int wl_init(struct wearlevel * wl, int sizex, int sizey);
+
+/* Draws a frame with drawfn, moved to the best place. db needs to still
+ * contain the previous frame, which is accounted as having been shown
+ * until nowms (milliseconds, from any monotonic clock). */
+void wl_drawframe(struct wearlevel * wl, struct di_dispbuf * db,
+                  di_drawfn_t drawfn, const void * snap, int64_t nowms);
+
+#endif /* _WEARLEVEL_H_ */
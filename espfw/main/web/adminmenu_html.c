@@ -0,0 +1,228 @@
+/* Compiled from adminmenu.html by tools/compile-webtemplate.py.
+ * Do not edit, edit the template and run make instead. */
+
+#include "adminmenu_html.h"
+
+static const uint8_t text[7994] =
+  "<!DOCTYPE html>\n"
+  "\n"
+  "<html><head><title>FoxESPTemp - Admin menu</title>\n"
+  "<link rel=\"stylesheet\" href=\"css.css\">\n"
+  "</head><body>\n"
+  "<h1>FoxESPTemp - Admin menu</h1>\n"
+  "\n"
+  "<h3>Admin-Actions:</h3>\n"
+  "\n"
+  "<form action=\"adminaction\" method=\"POST\" onsubmit=\"startflash(event);\">\n"
+  "<input type=\"hidden\" name=\"action\" value=\"flashupdate\">\n"
+  "URL for firmware Update:<br>\n"
+  "<input type=\"text\" name=\"updateurl\" value=\"https://www.poempelfox.de/espfw/foxesptemp2023.bin\"><br>\n"
+  "The update runs in the background, progress will be shown below.\n"
+  "The device reboots automatically once the update was successful.<br>\n"
+  "<input type=\"submit\" name=\"su\" value=\"Flash Firmware Update\"><br>\n"
+  "</form>\n"
+  "<form action=\"adminaction/upload\" method=\"POST\" onsubmit=\"startupload(event);\">\n"
+  "Or upload a firmware image file (or a .fxdelta delta update):<br>\n"
+  "<input type=\"file\" id=\"fwfile\" accept=\".bin,.fxdelta\"><br>\n"
+  "<input type=\"submit\" name=\"su\" value=\"Upload and Flash Firmware\"><br>\n"
+  "</form>\n"
+  "<div id=\"otaprogress\"></div><br>\n"
+  "<form action=\"adminaction\" method=\"POST\">\n"
+  "<input type=\"hidden\" name=\"action\" value=\"reboot\">\n"
+  "<input type=\"submit\" name=\"su\" value=\"Reboot Microcontroller\"><br>\n"
+  "</form><br>\n"
+  "<form action=\"adminaction\" method=\"POST\">\n"
+  "<input type=\"hidden\" name=\"action\" value=\"forcesht4xheater\">\n"
+  "<input type=\"submit\" name=\"su\" value=\"Force SHT4x Heater On\"><br>\n"
+  "</form><br>\n"
+  "\n"
+  "<script type=\"text/javascript\">\n"
+  "var hideto = null;\n"
+  "function hidesetresagain() {\n"
+  "  document.getElementById(\"settingsresult\").style.display = \"none\";\n"
+  "  hideto = null;\n"
+  "}\n"
+  "function submitsettings(e) {\n"
+  "  e.preventDefault();\n"
+  "  const XHR = new XMLHttpRequest();\n"
+  "  const FD = new FormData(e.srcElement);\n"
+  "  // Define what happens on successful data submission\n"
+  "  XHR.addEventListener(\"load\", (event) => {\n"
+  "    var sr = document.getElementById(\"settingsresult\");\n"
+  "    if (event.target.responseText.startsWith(\"OK\")) {\n"
+  "      sr.style.color = \"#111111\";\n"
+  "      sr.style.backgroundColor = \"#00aa00\";\n"
+  "    } else {\n"
+  "      sr.style.color = \"#aaaa00\";\n"
+  "      sr.style.backgroundColor = \"#660000\";\n"
+  "    }\n"
+  "    var newstatus = \"Server replied:<br>\";\n"
+  "    newstatus += event.target.responseText;\n"
+  "    newstatus += \"<br>Please note that changed settings will only take effect after a reboot.\";\n"
+  "    sr.innerHTML = newstatus;\n"
+  "    sr.style.display = \"block\";\n"
+  "    if (hideto !== null) { clearTimeout(hideto); }\n"
+  "    hideto = setTimeout(hidesetresagain, 10000);\n"
+  "  });\n"
+  "  // Define what happens in case of error\n"
+  "  XHR.addEventListener(\"error\", (event) => {\n"
+  "    var sr = document.getElementById(\"settingsresult\");\n"
+  "    sr.style.color = \"#aaaa00\";\n"
+  "    sr.style.backgroundColor = \"#660000\";\n"
+  "    sr.innerHTML = \"There was an error saving those settings.\";\n"
+  "    sr.style.display = \"block\";\n"
+  "    if (hideto !== null) { clearTimeout(hideto); }\n"
+  "    hideto = setTimeout(hidesetresagain, 10000);\n"
+  "  });\n"
+  "  XHR.open(\"POST\", \"savesettings\");\n"
+  "  XHR.setRequestHeader(\"Content-Type\", \"application/x-www-form-urlencoded\");\n"
+  "  XHR.send(new URLSearchParams(FD));\n"
+  "}\n"
+  "var otapollto = null;\n"
+  "function fmtbytes(b) {\n"
+  "  if (b < 0) { return \"?\"; }\n"
+  "  if (b >= 10240) { return Math.round(b / 1024) + \" KiB\"; }\n"
+  "  return b + \" B\";\n"
+  "}\n"
+  "function pollota() {\n"
+  "  const XHR = new XMLHttpRequest();\n"
+  "  otapollto = null;\n"
+  "  XHR.addEventListener(\"load\", (event) => {\n"
+  "    var op = document.getElementById(\"otaprogress\");\n"
+  "    var st;\n"
+  "    try {\n"
+  "      st = JSON.parse(event.target.responseText);\n"
+  "    } catch (ex) {\n"
+  "      op.innerHTML = \"Invalid reply from server: \" + event.target.responseText;\n"
+  "      return;\n"
+  "    }\n"
+  "    var txt = st.msg + \"<br>\";\n"
+  "    if (st.state !== \"idle\") {\n"
+  "      txt += fmtbytes(st.bytesdone) + \" of \" + fmtbytes(st.imagesize);\n"
+  "      if (st.imagesize > 0) {\n"
+  "        txt += \" (\" + Math.floor((st.bytesdone * 100) / st.imagesize) + \"%)\";\n"
+  "      }\n"
+  "      txt += \", \" + fmtbytes(st.bytespersec) + \"/s\";\n"
+  "      if (st.eta >= 0) { txt += \", about \" + st.eta + \" s remaining\"; }\n"
+  "    }\n"
+  "    if (st.state === \"success\") {\n"
+  "      txt += \"<br><a href=\\\"./\\\">Reconnect after waiting for a few seconds.</a>\";\n"
+  "    }\n"
+  "    op.innerHTML = txt;\n"
+  "    if (st.state === \"running\") {\n"
+  "      otapollto = setTimeout(pollota, 1000);\n"
+  "    }\n"
+  "  });\n"
+  "  // While rebooting the device will not answer, so try again a bit later.\n"
+  "  XHR.addEventListener(\"error\", (event) => {\n"
+  "    otapollto = setTimeout(pollota, 3000);\n"
+  "  });\n"
+  "  XHR.open(\"GET\", \"otastatus\");\n"
+  "  XHR.send();\n"
+  "}\n"
+  "function startflash(e) {\n"
+  "  e.preventDefault();\n"
+  "  const XHR = new XMLHttpRequest();\n"
+  "  const FD = new FormData(e.srcElement);\n"
+  "  XHR.addEventListener(\"load\", (event) => {\n"
+  "    var op = document.getElementById(\"otaprogress\");\n"
+  "    op.innerHTML = \"Server replied: \" + event.target.responseText;\n"
+  "    if ((event.target.status == 200) && (otapollto === null)) {\n"
+  "      otapollto = setTimeout(pollota, 1000);\n"
+  "    }\n"
+  "  });\n"
+  "  XHR.addEventListener(\"error\", (event) => {\n"
+  "    var op = document.getElementById(\"otaprogress\");\n"
+  "    op.innerHTML = \"There was an error starting the firmware update.\";\n"
+  "  });\n"
+  "  XHR.open(\"POST\", \"adminaction\");\n"
+  "  XHR.setRequestHeader(\"Content-Type\", \"application/x-www-form-urlencoded\");\n"
+  "  XHR.send(new URLSearchParams(FD));\n"
+  "}\n"
+  "function startupload(e) {\n"
+  "  e.preventDefault();\n"
+  "  var fi = document.getElementById(\"fwfile\");\n"
+  "  var op = document.getElementById(\"otaprogress\");\n"
+  "  if (fi.files.length < 1) {\n"
+  "    op.innerHTML = \"Please select a firmware image file first.\";\n"
+  "    return;\n"
+  "  }\n"
+  "  const XHR = new XMLHttpRequest();\n"
+  "  XHR.upload.addEventListener(\"progress\", (event) => {\n"
+  "    if (event.lengthComputable) {\n"
+  "      op.innerHTML = \"Uploading and flashing: \" + fmtbytes(event.loaded)\n"
+  "                   + \" of \" + fmtbytes(event.total)\n"
+  "                   + \" (\" + Math.floor((event.loaded * 100) / event.total) + \"%)\";\n"
+  "    }\n"
+  "  });\n"
+  "  XHR.addEventListener(\"load\", (event) => {\n"
+  "    op.innerHTML = \"Server replied: \" + event.target.responseText;\n"
+  "  });\n"
+  "  XHR.addEventListener(\"error\", (event) => {\n"
+  "    op.innerHTML = \"There was an error uploading the firmware image.\";\n"
+  "  });\n"
+  "  if (fi.files[0].name.endsWith(\".fxdelta\")) {\n"
+  "    XHR.open(\"POST\", \"adminaction/uploaddelta\");\n"
+  "  } else {\n"
+  "    XHR.open(\"POST\", \"adminaction/upload\");\n"
+  "  }\n"
+  "  XHR.setRequestHeader(\"Content-Type\", \"application/octet-stream\");\n"
+  "  XHR.send(fi.files[0]);\n"
+  "}\n"
+  "function togset(e, s) {\n"
+  "  const XHR = new XMLHttpRequest();\n"
+  "  var dge = document.getElementById(s);\n"
+  "  var oldtxt = e.srcElement.innerHTML;\n"
+  "  if (dge.style.display === \"block\") {\n"
+  "    dge.style.display = \"none\";\n"
+  "    dge.innerHTML = \"Loading...\";\n"
+  "    e.srcElement.innerHTML = \"&#9656;\" + oldtxt.substring(1);\n"
+  "    return;\n"
+  "  }\n"
+  "  dge.style.display = \"block\";\n"
+  "  e.srcElement.innerHTML = \"&#9660;\" + oldtxt.substring(1);\n"
+  "  XHR.addEventListener(\"load\", (event) => {\n"
+  "    var sr = document.getElementById(s);\n"
+  "    sr.innerHTML = event.target.responseText;\n"
+  "  });\n"
+  "  // Define what happens in case of error\n"
+  "  XHR.addEventListener(\"error\", (event) => {\n"
+  "    var sr = document.getElementById(s);\n"
+  "    sr.innerHTML = \"There was an error loading those settings from the server.\";\n"
+  "  });\n"
+  "  XHR.open(\"GET\", \"adminmenu.html?sp=\" + s);\n"
+  "  XHR.send();\n"
+  "}\n"
+  "</script>\n"
+  "<h3>Settings</h3>\n"
+  "<div id=\"settingsresult\"></div>\n"
+  "<h4 onclick=\"togset(event, 'setwifi');\">&#9656; WiFi</h4>\n"
+  "<div id=\"setwifi\" style=\"display:none;\">Loading... (note: this requires Javascript!)</div>\n"
+  "<h4 onclick=\"togset(event, 'setwiring');\">&#9656; External wiring</h4>\n"
+  "<div id=\"setwiring\" style=\"display:none;\">Loading... (note: this requires Javascript!)</div>\n"
+  "<h4 onclick=\"togset(event, 'setsensors');\">&#9656; Sensors</h4>\n"
+  "<div id=\"setsensors\" style=\"display:none;\">Loading... (note: this requires Javascript!)</div>\n"
+  "<h4 onclick=\"togset(event, 'setdisplay');\">&#9656; Display</h4>\n"
+  "<div id=\"setdisplay\" style=\"display:none;\">Loading... (note: this requires Javascript!)</div>\n"
+  "<h4 onclick=\"togset(event, 'setmisc');\">&#9656; Miscellaneous</h4>\n"
+  "<div id=\"setmisc\" style=\"display:none;\">Loading... (note: this requires Javascript!)</div>\n"
+  "<h4 onclick=\"togset(event, 'setsubwpd');\">&#9656; Submit to wetter.poempelfox.de</h4>\n"
+  "<div id=\"setsubwpd\" style=\"display:none;\">Loading... (note: this requires Javascript!)</div>\n"
+  "<!-- more settings to come -->\n"
+  "</body></html>\n"
+  "\n";
+
+static const struct webtmplop ops[5] = {
+  { .slot = -1, .off = 0, .len = 154 },
+  { .slot = TS_ADMINMENU_FWVERSION },
+  { .slot = -1, .off = 154, .len = 25 },
+  { .slot = TS_ADMINMENU_FWWARNING },
+  { .slot = -1, .off = 179, .len = 7814 },
+};
+
+const struct webtmpl adminmenu_html = {
+  .text = text,
+  .ops = ops,
+  .nrops = 5
+};
+
@@ -0,0 +1,17 @@
+/* Compiled from adminmenu.html by tools/compile-webtemplate.py.
+ * Do not edit, edit the template and run make instead. */
+
+#ifndef _ADMINMENU_HTML_H_
+#define _ADMINMENU_HTML_H_
+
+#include "webtmpl.h"
+
+enum adminmenu_html_slots {
+  TS_ADMINMENU_FWVERSION = 0,
+  TS_ADMINMENU_FWWARNING = 1,
+};
+
+extern const struct webtmpl adminmenu_html;
+
+#endif /* _ADMINMENU_HTML_H_ */
+
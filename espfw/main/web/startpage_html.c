@@ -0,0 +1,44 @@
+/* Compiled from startpage.html by tools/compile-webtemplate.py.
+ * Do not edit, edit the template and run make instead. */
+
+#include "startpage_html.h"
+
+static const uint8_t text[977] =
+  "<!DOCTYPE html>\n"
+  "\n"
+  "<html><head><title>FoxESPTemp - ESP32 based FoxTemp</title>\n"
+  "<link rel=\"stylesheet\" href=\"css.css\">\n"
+  "</head><body>\n"
+  "<div id=\"adminloginbut\"><a href=\"#adminloginform\">Admin Login</a></div>\n"
+  "<h1>FoxESPTemp - ESP32 based FoxTemp</h1>\n"
+  "<div id=\"adminloginform\">\n"
+  "<form action=\"adminlogin\" method=\"POST\">\n"
+  "Please enter the admin password to access the admin menu:<br><br>\n"
+  "<input type=\"password\" name=\"adminpw\"><br><br>\n"
+  "<input type=\"submit\" name=\"submit\" value=\"Log In\">&nbsp;&nbsp;&nbsp;\n"
+  "<a href=\"#\">[Cancel]</a><br><br>\n"
+  "Note: this will only work if you accept cookies.\n"
+  "</form>\n"
+  "</div>\n"
+  "<noscript>Because JavaScript is disabled in your browser, the values shown will\n"
+  " not update automatically - you will need to reload the page to see the current\n"
+  " values.<br></noscript>\n"
+  "\n"
+  "<script type=\"text/javascript\" src=\"startpage.js\"></script>\n"
+  "<br>The recommended way for using this data in scripts is to query\n"
+  " <a href=\"/json\">the JSON-output under /json</a>.<br><br>\n"
+  "</body></html>\n"
+  "\n";
+
+static const struct webtmplop ops[3] = {
+  { .slot = -1, .off = 0, .len = 774 },
+  { .slot = TS_STARTPAGE_VALUES },
+  { .slot = -1, .off = 774, .len = 202 },
+};
+
+const struct webtmpl startpage_html = {
+  .text = text,
+  .ops = ops,
+  .nrops = 3
+};
+
@@ -0,0 +1,16 @@
+/* Compiled from startpage.html by tools/compile-webtemplate.py.
+ * Do not edit, edit the template and run make instead. */
+
+#ifndef _STARTPAGE_HTML_H_
+#define _STARTPAGE_HTML_H_
+
+#include "webtmpl.h"
+
+enum startpage_html_slots {
+  TS_STARTPAGE_VALUES = 0,
+};
+
+extern const struct webtmpl startpage_html;
+
+#endif /* _STARTPAGE_HTML_H_ */
+
@@ -0,0 +1,26 @@
+
+/* Compiled page templates. They are generated from the .html files
+ * in this directory by tools/compile-webtemplate.py, and streamed by
+ * the webserver directly from flash. */
+
+#ifndef _WEBTMPL_H_
+#define _WEBTMPL_H_
+
+#include <stdint.h>
+
+/* One operation of a compiled template: either a span of the literal
+ * text (slot is -1), or a slot that is filled with dynamic content. */
+struct webtmplop {
+  int8_t slot;
+  uint16_t off;
+  uint16_t len;
+};
+
+struct webtmpl {
+  const uint8_t * text;
+  const struct webtmplop * ops;
+  uint8_t nrops;
+};
+
+#endif /* _WEBTMPL_H_ */
+
@@ -1,18 +1,27 @@
 
 #include <driver/gpio.h>
-#include <esp_crt_bundle.h>
-#include <esp_http_client.h>
 #include <esp_http_server.h>
-#include <esp_https_ota.h>
 #include <esp_log.h>
 #include <esp_netif.h>
 #include <esp_ota_ops.h>
 #include <esp_random.h>
 #include <esp_timer.h>
+#include <lwip/sockets.h>
+#include <math.h>
 #include <nvs_flash.h>
+#include <stdarg.h>
 #include <time.h>
+#include "displays.h"
+#include "ota.h"
+#include "scd41.h"
+#include "sen50.h"
+#include "sensirion.h"
 #include "settings.h"
+#include "sgp40.h"
 #include "webserver.h"
+#include "webutil.h"
+#include "web/adminmenu_html.h"
+#include "web/startpage_html.h"
 
 /* These are in foxesptemp_main.c */
 extern struct ev evs[2];
@@ -36,27 +45,15 @@ static struct authtoken liadmins[MAXADMINLOGINS];
 
 /********************************************************
  * Embedded webpages definition. These are mostly       *
- * in external text files, to make editing them more    *
- * convenient.                                          *
+ * in external files, to make editing them more         *
+ * convenient. The .html pages are compiled templates,  *
+ * see web/webtmpl.h.                                   *
  ********************************************************/
 
-extern const uint8_t startp_p1[] asm("_binary_startpage_html_p00_start");
-/* The following seems to exist in the autogenerated file, but it's
- * not documented - so lets avoid using it. */
-/* extern uint16_t startp_p1_len asm("startpage_html_p00_length"); */
-
-extern const uint8_t startp_p2[] asm("_binary_startpage_html_p01_start");
-
 extern const uint8_t startpagejs[] asm("_binary_startpage_js_min_start");
 
 extern const uint8_t csscss[] asm("_binary_css_css_min_start");
 
-extern const uint8_t adminmenu_p1[] asm("_binary_adminmenu_html_p00_start");
-
-extern const uint8_t adminmenu_p2[] asm("_binary_adminmenu_html_p01_start");
-
-extern const uint8_t adminmenu_p3[] asm("_binary_adminmenu_html_p02_start");
-
 static const uint8_t adminmenu_fww[] = R"EOAMFWW(
 <br><b>A new firmware has been flashed,</b> and booted up (it's currently
 running) - <b>but it has not been marked as &quot;good&quot; yet</b>.
@@ -79,78 +76,6 @@ access admin functions.
 
 /* Helper functions */
 
-/* Unescapes a x-www-form-urlencoded string.
- * Modifies the string inplace!
- * This is a mess that was quickly cobbled together. It
- * purposely excludes certain characters like " and ',
- * because we know all too well that we will print these
- * into html tags unescaped, and that would break with
- * these chars. We should at some time fix this by
- * using proper unescape AND escape functions, but for
- * now it's good enough for a tiny microcontroller. */
-void unescapeuestring(uint8_t * s) {
-  uint8_t * rp = s;
-  uint8_t * wp = s;
-  while (*rp != 0) {
-    if (strncmp(rp, "+", 1) == 0) {
-      *wp = ' '; wp++; rp++;
-    } else if (strncmp(rp, "&amp;", 5) == 0) {
-      *wp = '&'; rp += 5; wp += 1;
-    } else if (strncmp(rp, "%20", 3) == 0) {
-      *wp = ' '; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%21", 3) == 0) {
-      *wp = '!'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%23", 3) == 0) {
-      *wp = '#'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%24", 3) == 0) {
-      *wp = '$'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%25", 3) == 0) {
-      *wp = '%'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%26", 3) == 0) {
-      *wp = '&'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%28", 3) == 0) {
-      *wp = '('; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%29", 3) == 0) {
-      *wp = ')'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%2A", 3) == 0) {
-      *wp = '*'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%2B", 3) == 0) {
-      *wp = '+'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%2C", 3) == 0) {
-      *wp = ','; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%2D", 3) == 0) {
-      *wp = '-'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%2E", 3) == 0) {
-      *wp = '.'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%2F", 3) == 0) {
-      *wp = '/'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%3A", 3) == 0) {
-      *wp = ':'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%3B", 3) == 0) {
-      *wp = ';'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%3D", 3) == 0) {
-      *wp = '='; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%3F", 3) == 0) {
-      *wp = '?'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%40", 3) == 0) {
-      *wp = '@'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%5B", 3) == 0) {
-      *wp = '['; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%5D", 3) == 0) {
-      *wp = ']'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%5E", 3) == 0) {
-      *wp = '^'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%5F", 3) == 0) {
-      *wp = '_'; rp += 3; wp += 1;
-    } else if (strncmp(rp, "%7E", 3) == 0) {
-      *wp = '~'; rp += 3; wp += 1;
-    } else {
-      *wp = *rp; wp++; rp++;
-    }
-  }
-  *wp = 0;
-}
-
 /* Expires auth tokens. Those that have exceeded MAXTOKENLIFETIME will be
  * removed from the list. */
 void expireauthtokens() {
@@ -216,48 +141,348 @@ int checkauthtoken(httpd_req_t * req) {
   return 0;
 }
 
+/* Buffered chunk writer: Pages are streamed to the client through
+ * httpd_resp_send_chunk() in pieces of at most RESPBUFSIZE bytes, so we
+ * neither need to know the final size of a page in advance nor have to
+ * assemble it in one large buffer on the stack or the heap. */
+#define RESPBUFSIZE 400
+struct respbuf {
+  httpd_req_t * req;
+  esp_err_t err; /* first error returned by httpd_resp_send_chunk, if any */
+  size_t len;
+  uint8_t buf[RESPBUFSIZE];
+};
+
+static void rb_init(struct respbuf * rb, httpd_req_t * req) {
+  rb->req = req;
+  rb->err = ESP_OK;
+  rb->len = 0;
+}
+
+/* Sends out whatever is currently in the buffer. */
+static void rb_flush(struct respbuf * rb) {
+  if ((rb->len > 0) && (rb->err == ESP_OK)) {
+    rb->err = httpd_resp_send_chunk(rb->req, rb->buf, rb->len);
+  }
+  rb->len = 0;
+}
+
+/* Appends len bytes to the response. */
+static void rb_write(struct respbuf * rb, const uint8_t * d, size_t len) {
+  while (len > 0) {
+    if (rb->len >= RESPBUFSIZE) {
+      rb_flush(rb);
+    }
+    size_t n = RESPBUFSIZE - rb->len;
+    if (n > len) { n = len; }
+    memcpy(&rb->buf[rb->len], d, n);
+    rb->len += n;
+    d += n;
+    len -= n;
+  }
+}
+
+/* Appends a \0-terminated string to the response. */
+static void rb_puts(struct respbuf * rb, const uint8_t * s) {
+  rb_write(rb, s, strlen(s));
+}
+
+/* Appends len bytes of constant data, that will not change before the
+ * response is complete (e.g. something in flash). Larger blocks are not
+ * copied into the buffer, but sent directly. */
+static void rb_writeconst(struct respbuf * rb, const uint8_t * d, size_t len) {
+  if (len <= (RESPBUFSIZE - rb->len)) {
+    rb_write(rb, d, len);
+    return;
+  }
+  rb_flush(rb);
+  if (len < (RESPBUFSIZE / 2)) {
+    rb_write(rb, d, len);
+  } else if (rb->err == ESP_OK) {
+    rb->err = httpd_resp_send_chunk(rb->req, d, len);
+  }
+}
+
+/* Streams a compiled page template (see web/webtmpl.h). The literal
+ * text comes directly from flash, for each slot fillslot is called to
+ * append the dynamic content. */
+static void rb_puttmpl(struct respbuf * rb, const struct webtmpl * t,
+                       void (* fillslot)(struct respbuf * rb, int slot)) {
+  for (int i = 0; i < t->nrops; i++) {
+    const struct webtmplop * op = &t->ops[i];
+    if (op->slot < 0) {
+      rb_writeconst(rb, &t->text[op->off], op->len);
+    } else {
+      fillslot(rb, op->slot);
+    }
+  }
+}
+
+static void rb_writecb(void * ctx, const uint8_t * d, size_t len) {
+  rb_write((struct respbuf *)ctx, d, len);
+}
+
+/* Appends a \0-terminated string to the response, escaped so that it
+ * can be used as HTML text or inside a (quoted) HTML attribute value. */
+static void rb_puthtml(struct respbuf * rb, const uint8_t * s) {
+  htmlescape(s, rb_writecb, rb);
+}
+
+/* printf into the response. Output that does not fit into the space left
+ * in the buffer causes a flush, and if it does not even fit into an empty
+ * buffer, it is formatted into a temporary heap buffer instead. */
+static void rb_printf(struct respbuf * rb, const char * fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(&rb->buf[rb->len], RESPBUFSIZE - rb->len, fmt, ap);
+  va_end(ap);
+  if (n < 0) {
+    return;
+  }
+  if (n < (RESPBUFSIZE - rb->len)) { /* fitted into the buffer */
+    rb->len += n;
+    return;
+  }
+  rb_flush(rb);
+  uint8_t * tmp = rb->buf;
+  if (n >= RESPBUFSIZE) {
+    tmp = malloc(n + 1);
+    if (tmp == NULL) {
+      rb->err = ESP_ERR_NO_MEM;
+      return;
+    }
+  }
+  va_start(ap, fmt);
+  vsnprintf(tmp, n + 1, fmt, ap);
+  va_end(ap);
+  if (tmp == rb->buf) {
+    rb->len = n;
+  } else {
+    rb_write(rb, tmp, n);
+    free(tmp);
+  }
+}
+
+/* Flushes the buffer and terminates the chunked response.
+ * Returns ESP_OK, or ESP_FAIL if sending failed at some point, which
+ * makes the webserver close the connection. */
+static esp_err_t rb_finish(struct respbuf * rb) {
+  rb_flush(rb);
+  if (rb->err == ESP_OK) {
+    rb->err = httpd_resp_send_chunk(rb->req, NULL, 0);
+  }
+  if (rb->err != ESP_OK) {
+    ESP_LOGW("webserver.c", "sending response failed: %s", esp_err_to_name(rb->err));
+    return ESP_FAIL;
+  }
+  return ESP_OK;
+}
+
+/* Instrumentation of the webserver.
+ * All handlers are registered through registeruri(), which routes them
+ * through instrumentedhandler() to count requests and measure how long
+ * they take. Latencies go into a histogram with logarithmic buckets:
+ * bucket 0 is everything below 1 ms, bucket i (i > 0) is
+ * [2^(i-1), 2^i) ms, and the last bucket also takes everything above.
+ * The httpd server runs all handlers and socket callbacks from one task,
+ * so none of this needs locking. */
+#define NRLATBUCKETS 14
+#define MAXURISTATS 16
+
+struct uristats {
+  const char * uri;
+  httpd_method_t method;
+  esp_err_t (*handler)(httpd_req_t * req);
+  void * user_ctx;
+  uint32_t count;
+  uint32_t errors;         /* handler returned something other than ESP_OK */
+  uint64_t totalus;
+  uint32_t maxus;
+  uint64_t bytessent;
+  uint32_t hist[NRLATBUCKETS];
+};
+
+static struct uristats uristats[MAXURISTATS];
+static int nuristats = 0;
+static struct {
+  uint64_t bytessent;      /* total over all sockets */
+  uint32_t sendfails;
+  uint32_t socketsopened;
+  uint16_t socketsactive;
+  uint16_t socketspeak;
+  uint16_t maxsockets;     /* as configured */
+  uint32_t closesatlimit;  /* closes while all sockets were in use */
+} httpdstats;
+
+static esp_err_t instrumentedhandler(httpd_req_t * req) {
+  struct uristats * us = req->user_ctx;
+  uint64_t bytesbefore = httpdstats.bytessent;
+  int64_t st = esp_timer_get_time();
+  req->user_ctx = us->user_ctx; /* the real handler expects its own ctx */
+  esp_err_t res = us->handler(req);
+  uint32_t dur = esp_timer_get_time() - st;
+  us->count++;
+  if (res != ESP_OK) us->errors++;
+  us->totalus += dur;
+  if (dur > us->maxus) us->maxus = dur;
+  us->bytessent += httpdstats.bytessent - bytesbefore;
+  uint32_t ms = dur / 1000;
+  int b = (ms == 0) ? 0 : (32 - __builtin_clz(ms));
+  if (b >= NRLATBUCKETS) b = NRLATBUCKETS - 1;
+  us->hist[b]++;
+  return res;
+}
+
+/* Replaces the default send function of the httpd for every socket, so
+ * that we can count what is sent. Does the same as the default. */
+static int countingsend(httpd_handle_t hd, int sockfd, const char * buf, size_t buf_len, int flags) {
+  int ret = send(sockfd, buf, buf_len, flags);
+  if (ret < 0) {
+    httpdstats.sendfails++;
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+      return HTTPD_SOCK_ERR_TIMEOUT;
+    }
+    return HTTPD_SOCK_ERR_FAIL;
+  }
+  httpdstats.bytessent += ret;
+  return ret;
+}
+
+static esp_err_t httpdopenfn(httpd_handle_t hd, int sockfd) {
+  httpdstats.socketsopened++;
+  httpdstats.socketsactive++;
+  if (httpdstats.socketsactive > httpdstats.socketspeak) {
+    httpdstats.socketspeak = httpdstats.socketsactive;
+  }
+  httpd_sess_set_send_override(hd, sockfd, countingsend);
+  return ESP_OK;
+}
+
+static void httpdclosefn(httpd_handle_t hd, int sockfd) {
+  /* There is no callback for LRU purges. But the httpd only purges when all
+   * sockets are in use, so closes in that situation are a good estimate. */
+  if (httpdstats.socketsactive >= httpdstats.maxsockets) {
+    httpdstats.closesatlimit++;
+  }
+  if (httpdstats.socketsactive > 0) httpdstats.socketsactive--;
+  /* With a close_fn set, closing the socket is our job. */
+  close(sockfd);
+}
+
+/* Registers the handler u at the server, with instrumentation. */
+static void registeruri(httpd_handle_t server, httpd_uri_t * u) {
+  if (nuristats < MAXURISTATS) {
+    struct uristats * us = &uristats[nuristats++];
+    us->uri = u->uri;
+    us->method = u->method;
+    us->handler = u->handler;
+    us->user_ctx = u->user_ctx;
+    u->handler = instrumentedhandler;
+    u->user_ctx = us;
+  }
+  if (httpd_register_uri_handler(server, u) != ESP_OK) {
+    ESP_LOGE("webserver.c", "Failed to register handler for %s", u->uri);
+  }
+}
+
+static void printhttpdstats(struct respbuf * rb) {
+  rb_puts(rb, "<h3>Webserver statistics</h3>");
+  rb_printf(rb, "Bytes sent: %llu, send failures: %lu<br>",
+            httpdstats.bytessent, httpdstats.sendfails);
+  rb_printf(rb, "Sockets: %u active, %u peak, %u max, %lu opened in total, %lu closed at the limit (LRU purges)<br>",
+            httpdstats.socketsactive, httpdstats.socketspeak, httpdstats.maxsockets,
+            httpdstats.socketsopened, httpdstats.closesatlimit);
+  rb_puts(rb, "<table border=\"1\"><tr><th>URI</th><th>requests</th><th>errors</th>"
+              "<th>avg ms</th><th>max ms</th><th>bytes sent</th><th>&lt;1ms</th>");
+  for (int b = 1; b < NRLATBUCKETS; b++) {
+    rb_printf(rb, "<th>%s%lu</th>", (b == NRLATBUCKETS - 1) ? "&ge;" : "&lt;",
+              (b == NRLATBUCKETS - 1) ? (1UL << (b - 1)) : (1UL << b));
+  }
+  rb_puts(rb, "</tr>");
+  for (int i = 0; i < nuristats; i++) {
+    struct uristats * us = &uristats[i];
+    rb_printf(rb, "<tr><td>%s %s</td><td>%lu</td><td>%lu</td><td>%.1f</td><td>%.1f</td><td>%llu</td>",
+              (us->method == HTTP_POST) ? "POST" : "GET", us->uri, us->count, us->errors,
+              (us->count > 0) ? (float)us->totalus / (1000.0 * us->count) : 0.0,
+              (float)us->maxus / 1000.0, us->bytessent);
+    for (int b = 0; b < NRLATBUCKETS; b++) {
+      rb_printf(rb, "<td>%lu</td>", us->hist[b]);
+    }
+    rb_puts(rb, "</tr>");
+  }
+  rb_puts(rb, "</table>");
+}
+
 /* Page handlers */
 
-esp_err_t get_startpage_handler(httpd_req_t * req) {
-  uint8_t myresponse[3000]; /* approx 1000 for the startpage and 2000 for the content we insert below. */
-  uint8_t * pfp;
+/* Which values we have. Besides the dedicated sensors, a SEN54 or SEN55
+ * also measures temperature, humidity and VOCs, and a SEN55 NOx. */
+static int havetemphum(void) {
+  return (settings.sht4x_i2cport > 0)
+      || ((settings.sen50_i2cport > 0) && (sen50_getvariant() >= 54));
+}
+
+static int havevoc(void) {
+  return (settings.sgp40_i2cport > 0)
+      || ((settings.sen50_i2cport > 0) && (sen50_getvariant() >= 54));
+}
+
+static int havenox(void) {
+  return (settings.sen50_i2cport > 0) && (sen50_getvariant() == 55);
+}
+
+/* Fills the slots in the startpage template. */
+static void startpage_fillslot(struct respbuf * rb, int slot) {
   int e = activeevs;
-  strcpy(myresponse, startp_p1);
-  pfp = myresponse + strlen(startp_p1);
-  pfp += sprintf(pfp, "<table><tr><th>UpdateTS</th><td id=\"ts\">%lld</td></tr>", evs[e].lastupd);
+  if (slot != TS_STARTPAGE_VALUES) {
+    return;
+  }
+  rb_printf(rb, "<table><tr><th>UpdateTS</th><td id=\"ts\">%lld</td></tr>", evs[e].lastupd);
   if (settings.sht4x_i2cport > 0) { // SHT4X is enabled
-    pfp += sprintf(pfp, "<tr><th>LastSHT4xHeaterTS</th><td id=\"lastsht4xheat\">%lld</td></tr>", evs[e].lastsht4xheat);
-    pfp += sprintf(pfp, "<tr><th>Temperature (C)</th><td id=\"temp\">%.2f</td></tr>", evs[e].temp);
-    pfp += sprintf(pfp, "<tr><th>Humidity (%%)</th><td id=\"hum\">%.1f</td></tr>", evs[e].hum);
+    rb_printf(rb, "<tr><th>LastSHT4xHeaterTS</th><td id=\"lastsht4xheat\">%lld</td></tr>", evs[e].lastsht4xheat);
   }
-  if (settings.sen50_i2cport > 0) { // SEN50 is enabled
-    pfp += sprintf(pfp, "<tr><th>PM 1.0 (&micro;g/m&sup3;)</th><td id=\"pm010\">%.1f</td></tr>", evs[e].pm010);
-    pfp += sprintf(pfp, "<tr><th>PM 2.5 (&micro;g/m&sup3;)</th><td id=\"pm025\">%.1f</td></tr>", evs[e].pm025);
-    pfp += sprintf(pfp, "<tr><th>PM 4.0 (&micro;g/m&sup3;)</th><td id=\"pm040\">%.1f</td></tr>", evs[e].pm040);
-    pfp += sprintf(pfp, "<tr><th>PM 10.0 (&micro;g/m&sup3;)</th><td id=\"pm100\">%.1f</td></tr>", evs[e].pm100);
+  if (havetemphum()) {
+    rb_printf(rb, "<tr><th>Temperature (C)</th><td id=\"temp\">%.2f</td></tr>", evs[e].temp);
+    rb_printf(rb, "<tr><th>Humidity (%%)</th><td id=\"hum\">%.1f</td></tr>", evs[e].hum);
+  }
+  if (settings.sen50_i2cport > 0) { // SEN5x is enabled
+    rb_printf(rb, "<tr><th>PM 1.0 (&micro;g/m&sup3;)</th><td id=\"pm010\">%.1f</td></tr>", evs[e].pm010);
+    rb_printf(rb, "<tr><th>PM 2.5 (&micro;g/m&sup3;)</th><td id=\"pm025\">%.1f</td></tr>", evs[e].pm025);
+    rb_printf(rb, "<tr><th>PM 4.0 (&micro;g/m&sup3;)</th><td id=\"pm040\">%.1f</td></tr>", evs[e].pm040);
+    rb_printf(rb, "<tr><th>PM 10.0 (&micro;g/m&sup3;)</th><td id=\"pm100\">%.1f</td></tr>", evs[e].pm100);
   }
   if (settings.lps35hw_i2cport > 0) { // LPS35HW is enabled
-    pfp += sprintf(pfp, "<tr><th>Pressure (hPa)</th><td id=\"press\">%.3f</td></tr>", evs[e].press);
+    rb_printf(rb, "<tr><th>Pressure (hPa)</th><td id=\"press\">%.3f</td></tr>", evs[e].press);
   }
   if (settings.rg15_serport > 0) {
-    pfp += sprintf(pfp, "<tr><th>Rain (mm/min)</th><td id=\"raing\">%.2f</td></tr>", evs[e].raing);
+    rb_printf(rb, "<tr><th>Rain (mm/min)</th><td id=\"raing\">%.2f</td></tr>", evs[e].raing);
   }
   if (settings.scd41_i2cport > 0) { // SCD41 is enabled
     if (evs[e].co2 == 0xffff) { // Invalid - note that we cannot simply rely on
       // NAN being printed as NaN as with the other values because it's not a float.
-      pfp += sprintf(pfp, "%s", "<tr><th>CO2 (ppm)</th><td id=\"co2\">nan</td></tr>");
+      rb_puts(rb, "<tr><th>CO2 (ppm)</th><td id=\"co2\">nan</td></tr>");
     } else {
-      pfp += sprintf(pfp, "<tr><th>CO2 (ppm)</th><td id=\"co2\">%u</td></tr>", evs[e].co2);
+      rb_printf(rb, "<tr><th>CO2 (ppm)</th><td id=\"co2\">%u</td></tr>", evs[e].co2);
     }
   }
-  pfp += sprintf(pfp, "</table>");
-  strcat(myresponse, startp_p2);
-  /* The following two lines are the default und thus redundant. */
+  if (havevoc()) {
+    rb_printf(rb, "<tr><th>VOC index</th><td id=\"vocidx\">%.0f</td></tr>", evs[e].vocidx);
+  }
+  if (havenox()) {
+    rb_printf(rb, "<tr><th>NOx index</th><td id=\"noxidx\">%.0f</td></tr>", evs[e].noxidx);
+  }
+  rb_puts(rb, "</table>");
+}
+
+esp_err_t get_startpage_handler(httpd_req_t * req) {
+  struct respbuf rb;
+  /* The following line is the default und thus redundant. */
   httpd_resp_set_status(req, "200 OK");
   httpd_resp_set_type(req, "text/html; charset=utf-8");
   httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=29");
-  httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
-  return ESP_OK;
+  rb_init(&rb, req);
+  rb_puttmpl(&rb, &startpage_html, startpage_fillslot);
+  return rb_finish(&rb);
 }
 
 static httpd_uri_t uri_startpage = {
@@ -267,44 +492,101 @@ static httpd_uri_t uri_startpage = {
   .user_ctx = NULL
 };
 
+/* CBOR output of the current values, for machine consumers. See
+ * cbor_putsnapshot() in webutil.h for the format. */
+esp_err_t get_cbor_handler(httpd_req_t * req) {
+  uint8_t out[CBORS_MAXSIZE];
+  uint32_t have = 0;
+  if (settings.sht4x_i2cport > 0) { have |= CBORS_SHT4XHEAT; }
+  if (havetemphum()) { have |= CBORS_TEMPHUM; }
+  if (settings.sen50_i2cport > 0) { have |= CBORS_PM; }
+  if (settings.lps35hw_i2cport > 0) { have |= CBORS_PRESS; }
+  if (settings.rg15_serport > 0) { have |= CBORS_RAIN; }
+  if (settings.scd41_i2cport > 0) { have |= CBORS_CO2; }
+  if (havevoc()) { have |= CBORS_VOC; }
+  if (havenox()) { have |= CBORS_NOX; }
+  size_t len = cbor_putsnapshot(out, &evs[activeevs], have);
+  httpd_resp_set_type(req, "application/cbor");
+  httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=29");
+  httpd_resp_send(req, out, len);
+  return ESP_OK;
+}
+
+static httpd_uri_t uri_cbor = {
+  .uri      = "/cbor",
+  .method   = HTTP_GET,
+  .handler  = get_cbor_handler,
+  .user_ctx = NULL
+};
+
 esp_err_t get_json_handler(httpd_req_t * req) {
-  uint8_t myresponse[1100];
-  uint8_t * pfp;
+  struct respbuf rb;
   int e = activeevs;
-  strcpy(myresponse, "");
-  pfp = myresponse;
-  pfp += sprintf(pfp, "{");
+  /* The query string can be of any length (e.g. cache busters), and
+   * format=cbor must not get lost by truncating it. */
+  size_t qlen = httpd_req_get_url_query_len(req);
+  if (qlen > 0) {
+    uint8_t * query = malloc(qlen + 1);
+    if (query == NULL) {
+      httpd_resp_set_status(req, "500 Internal Server Error");
+      httpd_resp_send(req, "Out of memory.", HTTPD_RESP_USE_STRLEN);
+      return ESP_OK;
+    }
+    uint8_t fmt[10];
+    esp_err_t res = ESP_ERR_NOT_FOUND;
+    if (httpd_req_get_url_query_str(req, query, qlen + 1) == ESP_OK) {
+      res = httpd_query_key_value(query, "format", fmt, sizeof(fmt));
+    }
+    free(query);
+    if ((res == ESP_OK) && (strcmp(fmt, "cbor") == 0)) {
+      return get_cbor_handler(req);
+    }
+    if ((res != ESP_ERR_NOT_FOUND) && ((res != ESP_OK) || (strcmp(fmt, "json") != 0))) {
+      httpd_resp_set_status(req, "400 Bad Request");
+      httpd_resp_send(req, "Unsupported format, use json or cbor.", HTTPD_RESP_USE_STRLEN);
+      return ESP_OK;
+    }
+  }
+  /* The following line is the default und thus redundant. */
+  httpd_resp_set_status(req, "200 OK");
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=29");
+  rb_init(&rb, req);
+  rb_puts(&rb, "{");
   if (settings.sht4x_i2cport > 0) { // SHT4X is enabled
-    pfp += sprintf(pfp, "\"lastsht4xheat\":\"%lld\",", evs[e].lastsht4xheat);
-    pfp += sprintf(pfp, "\"temp\":\"%.2f\",", evs[e].temp);
-    pfp += sprintf(pfp, "\"hum\":\"%.1f\",", evs[e].hum);
+    rb_printf(&rb, "\"lastsht4xheat\":\"%lld\",", evs[e].lastsht4xheat);
+  }
+  if (havetemphum()) {
+    rb_printf(&rb, "\"temp\":\"%.2f\",", evs[e].temp);
+    rb_printf(&rb, "\"hum\":\"%.1f\",", evs[e].hum);
   }
-  if (settings.sen50_i2cport > 0) { // SEN50 is enabled
-    pfp += sprintf(pfp, "\"pm010\":\"%.1f\",", evs[e].pm010);
-    pfp += sprintf(pfp, "\"pm025\":\"%.1f\",", evs[e].pm025);
-    pfp += sprintf(pfp, "\"pm040\":\"%.1f\",", evs[e].pm040);
-    pfp += sprintf(pfp, "\"pm100\":\"%.1f\",", evs[e].pm100);
+  if (settings.sen50_i2cport > 0) { // SEN5x is enabled
+    rb_printf(&rb, "\"pm010\":\"%.1f\",", evs[e].pm010);
+    rb_printf(&rb, "\"pm025\":\"%.1f\",", evs[e].pm025);
+    rb_printf(&rb, "\"pm040\":\"%.1f\",", evs[e].pm040);
+    rb_printf(&rb, "\"pm100\":\"%.1f\",", evs[e].pm100);
   }
   if (settings.lps35hw_i2cport > 0) { // LPS35HW is enabled
-    pfp += sprintf(pfp, "\"press\":\"%.3f\",", evs[e].press);
+    rb_printf(&rb, "\"press\":\"%.3f\",", evs[e].press);
   }
   if (settings.rg15_serport > 0) {
-    pfp += sprintf(pfp, "\"raing\":\"%.2f\",", evs[e].raing);
+    rb_printf(&rb, "\"raing\":\"%.2f\",", evs[e].raing);
   }
   if (settings.scd41_i2cport > 0) { // SCD41 is enabled
     if (evs[e].co2 == 0xffff) {
-      pfp += sprintf(pfp, "%s", "\"co2\":\"nan\",");
+      rb_puts(&rb, "\"co2\":\"nan\",");
     } else {
-      pfp += sprintf(pfp, "\"co2\":\"%u\",", evs[e].co2);
+      rb_printf(&rb, "\"co2\":\"%u\",", evs[e].co2);
     }
   }
-  pfp += sprintf(pfp, "\"ts\":\"%lld\"}", evs[e].lastupd);
-  /* The following line is the default und thus redundant. */
-  httpd_resp_set_status(req, "200 OK");
-  httpd_resp_set_type(req, "application/json");
-  httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=29");
-  httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
-  return ESP_OK;
+  if (havevoc()) {
+    rb_printf(&rb, "\"vocidx\":\"%.0f\",", evs[e].vocidx);
+  }
+  if (havenox()) {
+    rb_printf(&rb, "\"noxidx\":\"%.0f\",", evs[e].noxidx);
+  }
+  rb_printf(&rb, "\"ts\":\"%lld\"}", evs[e].lastupd);
+  return rb_finish(&rb);
 }
 
 static httpd_uri_t uri_json = {
@@ -315,45 +597,75 @@ static httpd_uri_t uri_json = {
 };
 
 esp_err_t get_publicdebug_handler(httpd_req_t * req) {
-  uint8_t myresponse[2000];
-  uint8_t * pfp;
-  strcpy(myresponse, "");
-  pfp = myresponse;
-  pfp += sprintf(pfp, "<html><head><title>Debug info (public part)</title></head><body>");
-  pfp += sprintf(pfp, "too_wet_ctr: %ld<br>", too_wet_ctr);
+  struct respbuf rb;
+  /* The following line is the default und thus redundant. */
+  httpd_resp_set_status(req, "200 OK");
+  httpd_resp_set_type(req, "text/html; charset=utf-8");
+  httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=29");
+  rb_init(&rb, req);
+  rb_puts(&rb, "<html><head><title>Debug info (public part)</title></head><body>");
+  rb_printf(&rb, "too_wet_ctr: %ld<br>", too_wet_ctr);
   esp_netif_ip_info_t ip_info;
-  pfp += sprintf(pfp, "My IP addresses:<br><ul>");
+  rb_puts(&rb, "My IP addresses:<br><ul>");
   if (esp_netif_get_ip_info(mainnetif, &ip_info) == ESP_OK) {
-    pfp += sprintf(pfp, "<li>IPv4: " IPSTR "/" IPSTR " GW " IPSTR "</li>",
-                   IP2STR(&ip_info.ip), IP2STR(&ip_info.netmask),
-                   IP2STR(&ip_info.gw));
+    rb_printf(&rb, "<li>IPv4: " IPSTR "/" IPSTR " GW " IPSTR "</li>",
+              IP2STR(&ip_info.ip), IP2STR(&ip_info.netmask),
+              IP2STR(&ip_info.gw));
   } else {
-    pfp += sprintf(pfp, "<li>Failed to get IPv4 address information :(</li>");
+    rb_puts(&rb, "<li>Failed to get IPv4 address information :(</li>");
   }
   esp_ip6_addr_t v6addrs[CONFIG_LWIP_IPV6_NUM_ADDRESSES + 2];
   int nv6ips = esp_netif_get_all_ip6(mainnetif, v6addrs);
   if (nv6ips > 0) {
     for (int i = 0; i < nv6ips; i++) {
-      pfp += sprintf(pfp, "<li>IPv6: " IPV6STR "</li>",
-             IPV62STR(v6addrs[i]));
+      rb_printf(&rb, "<li>IPv6: " IPV6STR "</li>",
+                IPV62STR(v6addrs[i]));
     }
   } else {
-    pfp += sprintf(pfp, "<li>No IPv6 addresses, not even link-local :(</li>");
+    rb_puts(&rb, "<li>No IPv6 addresses, not even link-local :(</li>");
   }
-  pfp += sprintf(pfp, "</ul>");
-  pfp += sprintf(pfp, "Last reset reason: %d<br>", esp_reset_reason());
+  rb_puts(&rb, "</ul>");
+  rb_printf(&rb, "Last reset reason: %d<br>", esp_reset_reason());
   int64_t ts = esp_timer_get_time() / 1000000;;
-  pfp += sprintf(pfp, "Uptime: %lld days, ", (ts / 86400));
+  rb_printf(&rb, "Uptime: %lld days, ", (ts / 86400));
   ts = ts % 86400;
-  pfp += sprintf(pfp, "%02lld:", (ts / 3600));
+  rb_printf(&rb, "%02lld:", (ts / 3600));
   ts = ts % 3600;
-  pfp += sprintf(pfp, "%02lld:%02lld<br>", (ts / 60), (ts % 60));
-  /* The following line is the default und thus redundant. */
-  httpd_resp_set_status(req, "200 OK");
-  httpd_resp_set_type(req, "text/html; charset=utf-8");
-  httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=29");
-  httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
-  return ESP_OK;
+  rb_printf(&rb, "%02lld:%02lld<br>", (ts / 60), (ts % 60));
+  struct di_stats dist;
+  di_getstats(&dist);
+  rb_printf(&rb, "Display: %lu frames shown, %lu skipped because a newer one"
+                 " was queued, last one took %lu us. %lu bytes not sent"
+                 " because they did not change<br>",
+            dist.framesshown, dist.framesdropped, dist.lastframeus,
+            dist.bytessaved);
+  for (int i = 0; i < sensirion_getnrdevs(); i++) {
+    const struct sensirion_dev * sd = sensirion_getdev(i);
+    rb_printf(&rb, "%s: %lu successful reads, %lu I2C errors, %lu CRC errors<br>",
+              sd->name, sd->nrreads, sd->i2cerrors, sd->crcerrors);
+  }
+  if (settings.scd41_i2cport > 0) {
+    rb_puts(&rb, "SCD41 measurement modes (estimates):<ul>");
+    for (int m = SCD41_MODE_PERIODIC; m <= SCD41_MODE_SINGLESHOT; m++) {
+      struct scd41modeinfo mi;
+      scd41_getmodeinfo(m, &mi);
+      rb_printf(&rb, "<li>%s%s: %.2f mA average, %.0f mJ per measurement,"
+                     " values up to %u s old%s</li>",
+                mi.name, ((m == scd41_getmode()) ? " (active)" : ""),
+                mi.avgcurrent, mi.energy, mi.maxage,
+                (mi.usable ? "" : ", not usable at our interval"));
+    }
+    rb_puts(&rb, "</ul>");
+  }
+  if (settings.sgp40_i2cport > 0) {
+    uint32_t lastus, maxus;
+    sgp40_getcpustats(&lastus, &maxus);
+    rb_printf(&rb, "VOC index calculation: %lu us for the last sample, %lu us max<br>",
+              lastus, maxus);
+  }
+  printhttpdstats(&rb);
+  rb_puts(&rb, "</body></html>");
+  return rb_finish(&rb);
 }
 
 static httpd_uri_t uri_debug = {
@@ -395,8 +707,8 @@ static httpd_uri_t uri_css_css = {
   .user_ctx = NULL
 };
 
-static uint8_t getu8setting(nvs_handle_t nvshandle, const uint8_t * key) {
-  uint8_t res = 0;
+static uint8_t getu8setting(nvs_handle_t nvshandle, const uint8_t * key, uint8_t def) {
+  uint8_t res = def;
   esp_err_t e = nvs_get_u8(nvshandle, key, &res);
   if ((e != ESP_OK) && (e != ESP_ERR_NVS_NOT_FOUND)) {
     ESP_LOGW("webserver.c", "failed to load u8 setting %s: %s", key, esp_err_to_name(e));
@@ -404,7 +716,7 @@ static uint8_t getu8setting(nvs_handle_t nvshandle, const uint8_t * key) {
   return res;
 }
 
-static void getstrsetting(nvs_handle_t nvshandle, const char * key, char * out, size_t len)
+static esp_err_t getstrsetting(nvs_handle_t nvshandle, const char * key, char * out, size_t len)
 {
   size_t l = len;
   memset(out, 0, len);
@@ -412,31 +724,134 @@ static void getstrsetting(nvs_handle_t nvshandle, const char * key, char * out,
   if ((e != ESP_OK) && (e != ESP_ERR_NVS_NOT_FOUND)) {
     ESP_LOGW("webserver.c", "failed to load str setting %s: %s", key, esp_err_to_name(e));
   }
+  return e;
 }
 
 /* Helper to print the options for all valid GPIO pins inside a HTML select,
  * with one selected.
- * par1: pointer to where to put it (string)
+ * par1: the response to print it to
  * par2: which GPIO is selected - 0 for 'disabled', 1 for GPIO0, 2 for GPIO1,
- *       3 for GPIO2, (n+1) for GPIO(n).
- * returns pointer to the end of the string after printing. */
-uint8_t * printhtmlgpiosel(uint8_t * staptr, uint8_t selg)
+ *       3 for GPIO2, (n+1) for GPIO(n). */
+static void printhtmlgpiosel(struct respbuf * rb, uint8_t selg)
 {
-  staptr += sprintf(staptr, "<option value=\"0\"%s>disabled</option>", ((selg == 0) ? " selected" : ""));
+  rb_printf(rb, "<option value=\"0\"%s>disabled</option>", ((selg == 0) ? " selected" : ""));
   for (int i = 0; i < 63; i++) {
     if (GPIO_IS_VALID_GPIO(i)) {
-      staptr += sprintf(staptr, "<option value=\"%d\"%s>%d</option>", (i + 1), ((selg == (i + 1)) ? " selected" : ""), i);
+      rb_printf(rb, "<option value=\"%d\"%s>%d</option>", (i + 1), ((selg == (i + 1)) ? " selected" : ""), i);
+    }
+  }
+}
+
+/* Helper to print the options inside a HTML select from the '|'-separated
+ * list of option labels in the settings schema, with one selected. */
+static void printhtmloptions(struct respbuf * rb, const uint8_t * opts, uint8_t sel)
+{
+  int v = 0;
+  while (*opts != 0) {
+    const uint8_t * eo = strchr(opts, '|');
+    size_t l = (eo != NULL) ? (eo - opts) : strlen(opts);
+    rb_printf(rb, "<option value=\"%d\"%s>", v, ((sel == v) ? " selected" : ""));
+    rb_write(rb, opts, l);
+    rb_puts(rb, "</option>");
+    opts += l;
+    if (*opts == '|') { opts++; }
+    v++;
+  }
+}
+
+/* The subpages of the admin menu (adminmenu.html?sp=...) for each group
+ * of settings in the settings schema. */
+static const uint8_t * settinggroupnames[NR_SETTINGGROUPS] = {
+  [SG_WIFI] = "setwifi",
+  [SG_WIRING] = "setwiring",
+  [SG_SENSORS] = "setsensors",
+  [SG_DISPLAY] = "setdisplay",
+  [SG_MISC] = "setmisc",
+  [SG_SUBWPD] = "setsubwpd",
+};
+
+/* Renders the form for one group of settings, in one pass over the
+ * settings schema. Values are shown as they are in flash, which is not
+ * necessarily what is active right now (that changes on reboot). */
+static void printsettingsform(struct respbuf * rb, nvs_handle_t nvshandle, uint8_t group)
+{
+  uint8_t key[16];
+  uint8_t val[100];
+  rb_puts(rb, "<form action=\"savesettings\" method=\"POST\" onsubmit=\"submitsettings(event)\">");
+  rb_puts(rb, "<table>");
+  for (int i = 0; i < nr_settingsschema; i++) {
+    const struct settingdef * sd = &settingsschema[i];
+    if (sd->group != group) continue;
+    if (sd->type == SETT_HEADING) {
+      rb_printf(rb, "<tr><th colspan=\"2\">%s</th></tr>", sd->label);
+      continue;
+    }
+    if (sd->type == SETT_ADMINPW) { /* never show this, but ask for it twice */
+      rb_printf(rb, "<tr><th>%s</th><td>", sd->label);
+      rb_puts(rb, "<label for=\"curadminpw\">Current Password:</label>");
+      rb_puts(rb, "<input type=\"text\" name=\"curadminpw\" id=\"curadminpw\" value=\"\"><br>");
+      rb_printf(rb, "<label for=\"%s\">New Password:</label>", sd->key);
+      rb_printf(rb, "<input type=\"text\" name=\"%s\" id=\"%s\" value=\"\"><br>", sd->key, sd->key);
+      rb_puts(rb, "<label for=\"repadminpw\">Repeat New Password:</label>");
+      rb_puts(rb, "<input type=\"text\" name=\"repadminpw\" id=\"repadminpw\" value=\"\"></td></tr>");
+      continue;
+    }
+    for (int idx = 0; idx < ((sd->arraysize < 1) ? 1 : sd->arraysize); idx++) {
+      settings_getkey(sd, idx, key);
+      rb_printf(rb, "<tr><th><label for=\"%s\">", key);
+      if ((sd->flags & SETF_PERSENSORTYPE) != 0) {
+        rb_printf(rb, sd->label, st_to_name(idx));
+      } else if (sd->arraysize > 0) {
+        rb_printf(rb, sd->label, idx);
+      } else {
+        rb_puts(rb, sd->label);
+      }
+      rb_puts(rb, "</label></th><td>");
+      if ((sd->type == SETT_U8) || (sd->type == SETT_GPIO)) {
+        uint8_t curs = getu8setting(nvshandle, key, sd->defval);
+        rb_printf(rb, "<select name=\"%s\" id=\"%s\">", key, key);
+        if (sd->type == SETT_GPIO) {
+          printhtmlgpiosel(rb, curs);
+        } else {
+          printhtmloptions(rb, sd->opts, curs);
+        }
+        rb_puts(rb, "</select>");
+      } else { /* SETT_STR */
+        if (getstrsetting(nvshandle, key, val, sizeof(val)) == ESP_ERR_NVS_NOT_FOUND) {
+          if ((sd->flags & SETF_SHOWRUNNING) != 0) {
+            strlcpy(val, settings_getptr(sd, idx), sizeof(val));
+          } else if (sd->defstr != NULL) {
+            strlcpy(val, sd->defstr, sizeof(val));
+          }
+        }
+        rb_printf(rb, "<input type=\"text\" name=\"%s\" id=\"%s\" value=\"", key, key);
+        rb_puthtml(rb, val);
+        rb_puts(rb, "\">");
+      }
+      rb_puts(rb, "</td></tr>");
+    }
+  }
+  rb_puts(rb, "<tr><th colspan=\"2\"><input type=\"submit\" name=\"su\" value=\"Set\"></th></tr>");
+  rb_puts(rb, "</table></form><br>");
+}
+
+/* Fills the slots in the adminmenu template. */
+static void adminmenu_fillslot(struct respbuf * rb, int slot) {
+  if (slot == TS_ADMINMENU_FWVERSION) {
+    const esp_app_desc_t * appd = esp_app_get_description();
+    rb_printf(rb, "%s version %s compiled %s %s",
+              appd->project_name, appd->version, appd->date, appd->time);
+  } else if (slot == TS_ADMINMENU_FWWARNING) {
+    if (pendingfwverify > 0) { /* notification that firmware has not been marked as good yet */
+      rb_puts(rb, adminmenu_fww);
     }
   }
-  return staptr;
 }
 
 esp_err_t get_adminmenu_handler(httpd_req_t * req) {
-  uint8_t * myresponse; /* This is going to be too large to just put it on the stack. */
-  uint8_t * pfp;
+  struct respbuf rb;
   uint8_t tmp1[600];
   uint8_t subpage[50];
-  uint8_t curs;
   if (checkauthtoken(req) != 1) {
     httpd_resp_set_status(req, "403 Forbidden");
     httpd_resp_send(req, pleaseloginfirstmsg, HTTPD_RESP_USE_STRLEN);
@@ -453,12 +868,11 @@ esp_err_t get_adminmenu_handler(httpd_req_t * req) {
   } else {
     strcpy(subpage, "main");
   }
-  myresponse = calloc(10000, 1); /* FIXME calculate a realistic size */
-  if (myresponse == NULL) {
-    httpd_resp_set_status(req, "500 Internal Server Error");
-    httpd_resp_send(req, "Out of memory.", HTTPD_RESP_USE_STRLEN);
-    return ESP_OK;
-  }
+  /* The following two lines are the default und thus redundant. */
+  httpd_resp_set_status(req, "200 OK");
+  httpd_resp_set_type(req, "text/html; charset=utf-8");
+  httpd_resp_set_hdr(req, "Cache-Control", "private, max-age=29");
+  rb_init(&rb, req);
   nvs_handle_t nvshandle;
   memset(&nvshandle, 0, sizeof(nvshandle));
   if (nvs_open("settings", NVS_READONLY, &nvshandle) != ESP_OK) {
@@ -468,227 +882,22 @@ esp_err_t get_adminmenu_handler(httpd_req_t * req) {
   }
   /* Try to keep these sorted, in the order as they appear in the webinterface. */
   if (strcmp(subpage, "main") == 0) { /* Main page - this includes the others via JS */
-    strcpy(myresponse, adminmenu_p1);
-    pfp = myresponse + strlen(myresponse);
-    const esp_app_desc_t * appd = esp_app_get_description();
-    pfp += sprintf(pfp, "%s version %s compiled %s %s",
-                   appd->project_name, appd->version, appd->date, appd->time);
-    strcat(pfp, adminmenu_p2);
-    if (pendingfwverify > 0) { /* notification that firmware has not been marked as good yet */
-      strcat(pfp, adminmenu_fww);
-    }
-    strcat(pfp, adminmenu_p3);
-  } else if (strcmp(subpage, "setwifi") == 0) { /* WiFi settings */
-    strcpy(myresponse, "<form action=\"savesettings\" method=\"POST\" onsubmit=\"submitsettings(event)\">");
-    strcat(myresponse, "<table><tr><th><label for=\"wifi_mode\">WiFi mode:</label></th><td>");
-    strcat(myresponse, "<select name=\"wifi_mode\" id=\"wifi_mode\">");
-    curs = getu8setting(nvshandle, "wifi_mode");
-    pfp = myresponse + strlen(myresponse);
-    pfp += sprintf(pfp, "<option value=\"0\"%s>Access Point</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>Client</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr><tr><th colspan=\"2\">For AccessPoint-Mode:</th></tr>");
-    pfp += sprintf(pfp, "%s", "<tr><th><label for=\"wifi_ap_ssid\">WiFi SSID (also used as hostname in client mode):</label></th><td>");
-    getstrsetting(nvshandle, "wifi_ap_ssid", tmp1, sizeof(tmp1));
-    if (strlen(tmp1) == 0) { // for this setting, if there is no setting in flash,
-      // we will as an exception take the currently active value (which will be
-      // a sane default generated from the MAC) from the settings variable.
-      strcpy(tmp1, settings.wifi_ap_ssid);
-    }
-    pfp += sprintf(pfp, "<input type=\"text\" name=\"wifi_ap_ssid\" id=\"wifi_ap_ssid\" value=\"%s\"></td></tr>", tmp1);
-    pfp += sprintf(pfp, "%s", "<tr><th><label for=\"wifi_ap_pw\">WiFi password (leave empty for 'open' mode):</label></th><td>");
-    getstrsetting(nvshandle, "wifi_ap_pw", tmp1, sizeof(tmp1));
-    pfp += sprintf(pfp, "<input type=\"text\" name=\"wifi_ap_pw\" id=\"wifi_ap_pw\" value=\"%s\"></td></tr>", tmp1);
-    pfp += sprintf(pfp, "%s", "<tr><th colspan=\"2\">For Client-Mode:</th></tr>");
-    pfp += sprintf(pfp, "%s", "<tr><th><label for=\"wifi_cl_ssid\">WiFi SSID:</label></th>");
-    getstrsetting(nvshandle, "wifi_cl_ssid", tmp1, sizeof(tmp1));
-    pfp += sprintf(pfp, "<td><input type=\"text\" name=\"wifi_cl_ssid\" id=\"wifi_cl_ssid\" value=\"%s\"></td></tr>", tmp1);
-    pfp += sprintf(pfp, "%s", "<tr><th><label for=\"wifi_cl_pw\">WiFi password:</label></th>");
-    getstrsetting(nvshandle, "wifi_cl_pw", tmp1, sizeof(tmp1));
-    pfp += sprintf(pfp, "<td><input type=\"text\" name=\"wifi_cl_pw\" id=\"wifi_cl_pw\" value=\"%s\"></td></tr>", tmp1);
-    strcat(pfp, "<tr><th colspan=\"2\"><input type=\"submit\" name=\"su\" value=\"Set\"></th></tr>");
-    strcat(pfp, "</table></form><br>");
-  } else if (strcmp(subpage, "setwiring") == 0) { /* External Wiring settings */
-    strcpy(myresponse, "<form action=\"savesettings\" method=\"POST\" onsubmit=\"submitsettings(event)\">");
-    strcat(myresponse, "<table>");
-    for (int i2cport = 0; i2cport <= 1; i2cport++) {
-      pfp = myresponse + strlen(myresponse);
-      pfp += sprintf(pfp, "<tr><th>I2C %d GPIOs</th><td><label for=\"i2c_%d_scl\">SCL:</label>", i2cport, i2cport);
-      pfp += sprintf(pfp, "<select name=\"i2c_%d_scl\" id=\"i2c_%d_scl\">", i2cport, i2cport);
-      sprintf(tmp1, "i2c_%d_scl", i2cport);
-      curs = getu8setting(nvshandle, tmp1);
-      pfp = printhtmlgpiosel(pfp, curs);
-      pfp += sprintf(pfp, "</select> <label for=\"i2c_%d_scl\">SDA:</label>", i2cport);
-      pfp += sprintf(pfp, "<select name=\"i2c_%d_sda\" id=\"i2c_%d_sda\">", i2cport, i2cport);
-      sprintf(tmp1, "i2c_%d_sda", i2cport);
-      curs = getu8setting(nvshandle, tmp1);
-      pfp = printhtmlgpiosel(pfp, curs);
-      pfp += sprintf(pfp, "%s", "</select><br>");
-      sprintf(tmp1, "i2c_%d_pullups", i2cport);
-      curs = getu8setting(nvshandle, tmp1);
-      pfp += sprintf(pfp, "<select id=\"i2c_%d_pullups\" name=\"i2c_%d_pullups\">", i2cport, i2cport);
-      pfp += sprintf(pfp, "<option value=\"0\"%s>Disable pullups</option>", ((curs == 0) ? " selected" : ""));
-      pfp += sprintf(pfp, "<option value=\"1\"%s>Enable pullups</option>", ((curs == 1) ? " selected" : ""));
-      pfp += sprintf(pfp, "%s", "</select><br><label for=\"i2c_%d_speed\">Speed (Hz):</label>");
-      sprintf(tmp1, "i2c_%d_speed", i2cport);
-      curs = getu8setting(nvshandle, tmp1);
-      pfp += sprintf(pfp, "<select id=\"i2c_%d_speed\" name=\"i2c_%d_speed\">", i2cport, i2cport);
-      pfp += sprintf(pfp, "<option value=\"0\"%s>100k (default)</option>", ((curs == 0) ? " selected" : ""));
-      pfp += sprintf(pfp, "<option value=\"1\"%s>25k</option>", ((curs == 1) ? " selected" : ""));
-      pfp += sprintf(pfp, "<option value=\"2\"%s>200k</option>", ((curs == 2) ? " selected" : ""));
-      pfp += sprintf(pfp, "<option value=\"3\"%s>400k</option>", ((curs == 3) ? " selected" : ""));
-      pfp += sprintf(pfp, "<option value=\"4\"%s>1000k</option>", ((curs == 4) ? " selected" : ""));
-      pfp += sprintf(pfp, "%s", "</select></td></tr>");
+    rb_puttmpl(&rb, &adminmenu_html, adminmenu_fillslot);
+  } else {
+    int group;
+    for (group = 0; group < NR_SETTINGGROUPS; group++) {
+      if (strcmp(subpage, settinggroupnames[group]) == 0) {
+        break;
+      }
     }
-    pfp += sprintf(pfp, "%s", "<tr><th>Serial 1 GPIOs</th><td><label for=\"ser_1_rx\">RX:</label>");
-    pfp += sprintf(pfp, "%s", "<select name=\"ser_1_rx\" id=\"ser_1_rx\">");
-    curs = getu8setting(nvshandle, "ser_1_rx");
-    pfp = printhtmlgpiosel(pfp, curs);
-    pfp += sprintf(pfp, "%s", "</select> <label for=\"ser_1_tx\">TX:</label>");
-    pfp += sprintf(pfp, "%s", "<select name=\"ser_1_tx\" id=\"ser_1_tx\">");
-    curs = getu8setting(nvshandle, "ser_1_tx");
-    pfp = printhtmlgpiosel(pfp, curs);
-    strcat(pfp, "</select></td></tr>");
-    strcat(pfp, "<tr><th colspan=\"2\"><input type=\"submit\" name=\"su\" value=\"Set\"></th></tr>");
-    strcat(pfp, "</table></form><br>");
-  } else if (strcmp(subpage, "setsensors") == 0) { /* Sensor settings */
-    strcpy(myresponse, "<form action=\"savesettings\" method=\"POST\" onsubmit=\"submitsettings(event)\">");
-    strcat(myresponse, "<table>");
-    pfp = myresponse + strlen(myresponse);
-    /* I2C sensors */
-    curs = getu8setting(nvshandle, "scd41_i2cport");
-    pfp += sprintf(pfp, "%s", "<tr><th>SCD41</th><td>");
-    pfp += sprintf(pfp, "%s", "<label for=\"scd41_i2cport\">I2C Port</label>:");
-    pfp += sprintf(pfp, "%s", "<select name=\"scd41_i2cport\" id=\"scd41_i2cport\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>not connected</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>I2C 0</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"2\"%s>I2C 1</option>", ((curs == 2) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select><br><label for=\"scd41_selfcal\">");
-    curs = getu8setting(nvshandle, "scd41_selfcal");
-    pfp += sprintf(pfp, "%s", "<abbr title=\"Automatic Self Calibration\">ASC</abbr>:</label>:");
-    pfp += sprintf(pfp, "%s", "<select name=\"scd41_selfcal\" id=\"scd41_selfcal\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>use EEPROM setting</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>Enable</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"2\"%s>Disable</option>", ((curs == 2) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    curs = getu8setting(nvshandle, "sen50_i2cport");
-    pfp += sprintf(pfp, "%s", "<tr><th>SEN50</th><td>");
-    pfp += sprintf(pfp, "%s", "<label for=\"sen50_i2cport\">I2C Port</label>:");
-    pfp += sprintf(pfp, "%s", "<select name=\"sen50_i2cport\" id=\"sen50_i2cport\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>not connected</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>I2C 0</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"2\"%s>I2C 1</option>", ((curs == 2) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    curs = getu8setting(nvshandle, "sgp40_i2cport");
-    pfp += sprintf(pfp, "%s", "<tr><th>SGP40</th><td>");
-    pfp += sprintf(pfp, "%s", "<label for=\"sgp40_i2cport\">I2C Port</label>:");
-    pfp += sprintf(pfp, "%s", "<select name=\"sgp40_i2cport\" id=\"sgp40_i2cport\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>not connected</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>I2C 0</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"2\"%s>I2C 1</option>", ((curs == 2) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    curs = getu8setting(nvshandle, "sht4x_i2cport");
-    pfp += sprintf(pfp, "%s", "<tr><th>SHT4x (SHT40/SHT41/SHT45)</th><td>");
-    pfp += sprintf(pfp, "%s", "<label for=\"sht4x_i2cport\">I2C Port</label>:");
-    pfp += sprintf(pfp, "%s", "<select name=\"sht4x_i2cport\" id=\"sht4x_i2cport\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>not connected</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>I2C 0</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"2\"%s>I2C 1</option>", ((curs == 2) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select><br><label for=\"sht4x_addr\">address</label>:");
-    curs = getu8setting(nvshandle, "sht4x_addr");
-    pfp += sprintf(pfp, "%s", "<select name=\"sht4x_addr\" id=\"sht4x_addr\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>0x44 (most common)</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>0x45</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"2\"%s>0x46</option>", ((curs == 2) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    curs = getu8setting(nvshandle, "lps35hw_i2cport");
-    pfp += sprintf(pfp, "%s", "<tr><th>LPS35HW</th><td>");
-    pfp += sprintf(pfp, "%s", "<label for=\"lps35hw_i2cport\">I2C Port</label>:");
-    pfp += sprintf(pfp, "%s", "<select name=\"lps35hw_i2cport\" id=\"lps35hw_i2cport\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>not connected</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>I2C 0</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"2\"%s>I2C 1</option>", ((curs == 2) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select><br><label for=\"lps35hw_addr\">address</label>:");
-    curs = getu8setting(nvshandle, "lps35hw_addr");
-    pfp += sprintf(pfp, "%s", "<select name=\"lps35hw_addr\" id=\"lps35hw_addr\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>0x5c</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>0x5d</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    /* serial sensor */
-    curs = getu8setting(nvshandle, "rg15_serport");
-    pfp += sprintf(pfp, "%s", "<tr><th>RG15</th><td>");
-    pfp += sprintf(pfp, "%s", "<label for=\"rg15_serport\">Serial Port</label>:");
-    pfp += sprintf(pfp, "%s", "<select name=\"rg15_serport\" id=\"rg15_serport\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>not connected</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>Serial 1</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    strcat(pfp, "<tr><th colspan=\"2\"><input type=\"submit\" name=\"su\" value=\"Set\"></th></tr>");
-    strcat(pfp, "</table></form><br>");
-  } else if (strcmp(subpage, "setdisplay") == 0) { /* Display settings */
-    strcpy(myresponse, "<form action=\"savesettings\" method=\"POST\" onsubmit=\"submitsettings(event)\">");
-    strcat(myresponse, "<table>");
-    pfp = myresponse + strlen(myresponse);
-    curs = getu8setting(nvshandle, "di_type");
-    pfp += sprintf(pfp, "%s", "<tr><th>Display type</th><td>");
-    pfp += sprintf(pfp, "%s", "<select name=\"di_type\" id=\"di_type\">");
-    pfp += sprintf(pfp, "<option value=\"%d\"%s>none</option>", DI_DT_NONE, ((curs == DI_DT_NONE) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"%d\"%s>SSD1306 variant 1</option>", DI_DT_SSD1306_1, ((curs == DI_DT_SSD1306_1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"%d\"%s>SSD1309 variant 1</option>", DI_DT_SSD1309_1, ((curs == DI_DT_SSD1309_1) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    curs = getu8setting(nvshandle, "di_i2cport");
-    pfp += sprintf(pfp, "%s", "<tr><th>I2C-port<br><small>(for I2C displays)</small></th><td>");
-    pfp += sprintf(pfp, "%s", "<select name=\"di_i2cport\" id=\"di_i2cport\">");
-    pfp += sprintf(pfp, "<option value=\"0\"%s>not connected</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>I2C 0</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"2\"%s>I2C 1</option>", ((curs == 2) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    strcat(pfp, "<tr><th colspan=\"2\"><input type=\"submit\" name=\"su\" value=\"Set\"></th></tr>");
-    strcat(pfp, "</table></form><br>");
-  } else if (strcmp(subpage, "setmisc") == 0) { /* Misc settings */
-    strcpy(myresponse, "<form action=\"savesettings\" method=\"POST\" onsubmit=\"submitsettings(event)\">");
-    strcat(myresponse, "<table>");
-    strcat(myresponse, "<tr><th>Change Admin Password</th><td>");
-    strcat(myresponse, "<label for=\"curadminpw\">Current Password:</label>");
-    strcat(myresponse, "<input type=\"text\" name=\"curadminpw\" id=\"curadminpw\" value=\"\"><br>");
-    strcat(myresponse, "<label for=\"adminpw\">New Password:</label>");
-    strcat(myresponse, "<input type=\"text\" name=\"adminpw\" id=\"adminpw\" value=\"\"><br>");
-    strcat(myresponse, "<label for=\"repadminpw\">Repeat New Password:</label>");
-    strcat(myresponse, "<input type=\"text\" name=\"repadminpw\" id=\"repadminpw\" value=\"\"></td></tr>");
-    strcat(myresponse, "<tr><th colspan=\"2\"><input type=\"submit\" name=\"su\" value=\"Set\"></th></tr>");
-    strcat(myresponse, "</table></form><br>");
-  } else if (strcmp(subpage, "setsubwpd") == 0) { /* settings for submitting to wetter.poempelfox.de */
-    strcpy(myresponse, "<form action=\"savesettings\" method=\"POST\" onsubmit=\"submitsettings(event)\">");
-    strcat(myresponse, "<table>");
-    curs = getu8setting(nvshandle, "wpd_enabled");
-    strcat(myresponse, "<tr><th><label for=\"wpd_enabled\">Submit values to<br>wetter.poempelfox.de");
-    strcat(myresponse, "</label></th><td>");
-    strcat(myresponse, "<select name=\"wpd_enabled\" id=\"wpd_enabled\">");
-    pfp = myresponse + strlen(myresponse);
-    pfp += sprintf(pfp, "<option value=\"0\"%s>Disabled</option>", ((curs == 0) ? " selected" : ""));
-    pfp += sprintf(pfp, "<option value=\"1\"%s>Enabled</option>", ((curs == 1) ? " selected" : ""));
-    pfp += sprintf(pfp, "%s", "</select></td></tr>");
-    getstrsetting(nvshandle, "wpd_token", tmp1, sizeof(tmp1));
-    pfp += sprintf(pfp, "%s", "<tr><th><label for=\"wpd_token\">Token for authentication");
-    pfp += sprintf(pfp, "%s", "</label></th><td>");
-    pfp += sprintf(pfp, "<input type=\"text\" name=\"wpd_token\" id=\"wpd_token\" value=\"%s\"></td></tr>", tmp1);
-    for (int i = 0; i < NR_SENSORTYPES; i++) {
-      uint8_t tmp2[20];
-      sprintf(tmp2, "wpd_sensid_t%03d", i);
-      getstrsetting(nvshandle, tmp2, tmp1, sizeof(tmp1));
-      pfp += sprintf(pfp, "<tr><th><label for=\"%s\">SensorID for %s</label></th><td>", tmp2, st_to_name(i));
-      pfp += sprintf(pfp, "<input type=\"text\" name=\"%s\" id=\"%s\" value=\"%s\"></td></tr>", tmp2, tmp2, tmp1);
+    if (group < NR_SETTINGGROUPS) {
+      printsettingsform(&rb, nvshandle, group);
+    } else {
+      rb_puts(&rb, "??? Unknown subpage requested.");
     }
-    strcat(pfp, "<tr><th colspan=\"2\"><input type=\"submit\" name=\"su\" value=\"Set\"></th></tr>");
-    strcat(pfp, "</table></form><br>");
-  } else {
-    strcpy(myresponse, "??? Unknown subpage requested.");
   }
-  /* The following two lines are the default und thus redundant. */
-  httpd_resp_set_status(req, "200 OK");
-  httpd_resp_set_type(req, "text/html; charset=utf-8");
-  httpd_resp_set_hdr(req, "Cache-Control", "private, max-age=29");
-  httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
-  free(myresponse);
-  return ESP_OK;
+  nvs_close(nvshandle);
+  return rb_finish(&rb);
 }
 
 static httpd_uri_t uri_adminmenu = {
@@ -779,31 +988,20 @@ esp_err_t post_adminaction(httpd_req_t * req) {
     }
     unescapeuestring(tmp1);
     ESP_LOGI("webserver.c", "UE UpdateURL: '%s'", tmp1);
-    sprintf(myresponse, "OK, will try to update from: %s'<br>", tmp1);
-    esp_http_client_config_t httpccfg = {
-        .url = tmp1,
-        .timeout_ms = 60000,
-        .keep_alive_enable = true,
-        .crt_bundle_attach = esp_crt_bundle_attach
-    };
-    esp_https_ota_config_t otacfg = {
-        .http_config = &httpccfg
-    };
-    ret = esp_https_ota(&otacfg);
-    if (ret == ESP_OK) {
-      ESP_LOGI("webserver.c", "OTA Succeed, Rebooting...");
-      strcat(myresponse, "OTA Update reported success. Will reboot.");
-    strcat(myresponse, " <a href=\"./\">Reconnect after waiting for a few seconds.</a>");
-      httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
-      vTaskDelay(3 * (1000 / portTICK_PERIOD_MS)); 
-      esp_restart();
-    } else {
-      ESP_LOGE("webserver.c", "Firmware upgrade failed");
-      strcat(myresponse, "OTA Update reported failure.");
-      httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
+    /* The actual update runs in the background, progress can be
+     * queried through /otastatus. */
+    esp_err_t e = ota_startfromurl(tmp1);
+    if (e == ESP_ERR_INVALID_STATE) {
+      httpd_resp_set_status(req, "409 Conflict");
+      httpd_resp_send(req, "There already is a firmware update in progress.", HTTPD_RESP_USE_STRLEN);
+      return ESP_OK;
+    } else if (e != ESP_OK) {
+      httpd_resp_set_status(req, "500 Internal Server Error");
+      httpd_resp_send(req, "Failed to start the firmware update.", HTTPD_RESP_USE_STRLEN);
       return ESP_OK;
     }
-    /* This should not be reached. */
+    httpd_resp_send(req, "OK, firmware update started.", HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
   } else if (strcmp(tmp1, "reboot") == 0) {
     ESP_LOGI("webserver.c", "Reboot requested by admin, Rebooting...");
     strcpy(myresponse, "OK, will reboot in 3 seconds.");
@@ -852,53 +1050,209 @@ static httpd_uri_t uri_adminaction = {
   .user_ctx = NULL
 };
 
-struct strset_s {
-  const uint8_t * name;
-  int minlen;
-  int maxlen;
-  int arraysize; /* For array settings only. */
-};
+esp_err_t get_otastatus_handler(httpd_req_t * req) {
+  struct respbuf rb;
+  struct ota_status ost;
+  static const char * statenames[] = { "idle", "running", "success", "failed" };
+  if (checkauthtoken(req) != 1) {
+    httpd_resp_set_status(req, "403 Forbidden");
+    httpd_resp_send(req, pleaseloginfirstmsg, HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+  }
+  ota_getstatus(&ost);
+  /* Throughput and ETA are calculated from the average since the start.
+   * That is smooth enough for something that is polled once a second. */
+  int64_t elapsed = ost.lastupdtime - ost.starttime; /* in microseconds */
+  long bps = 0;
+  long eta = -1;
+  if ((elapsed > 0) && (ost.bytesdone > 0)) {
+    bps = (long)(((int64_t)ost.bytesdone * 1000000LL) / elapsed);
+    if ((ost.imagesize > 0) && (bps > 0) && (ost.state == OTA_ST_RUNNING)) {
+      eta = (ost.imagesize - ost.bytesdone) / bps;
+    }
+  }
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  rb_init(&rb, req);
+  rb_printf(&rb, "{\"state\":\"%s\",", statenames[ost.state & 3]);
+  rb_printf(&rb, "\"bytesdone\":%d,\"imagesize\":%d,", ost.bytesdone, ost.imagesize);
+  rb_printf(&rb, "\"elapsed\":%lld,", elapsed / 1000000LL);
+  rb_printf(&rb, "\"bytespersec\":%ld,\"eta\":%ld,", bps, eta);
+  rb_puts(&rb, "\"msg\":\"");
+  rb_puts(&rb, ost.msg); /* our own messages, never need escaping. */
+  rb_puts(&rb, "\"}");
+  return rb_finish(&rb);
+}
 
-struct u8set_s {
-  const uint8_t * name;
-  uint8_t minval;
-  uint8_t maxval;
+static httpd_uri_t uri_otastatus = {
+  .uri      = "/otastatus",
+  .method   = HTTP_GET,
+  .handler  = get_otastatus_handler,
+  .user_ctx = NULL
 };
 
-static const struct strset_s strsets[] = {
-  { .name = "adminpw", .minlen = 0, .maxlen = 24 },
-  { .name = "wifi_ap_ssid", .minlen = 2, .maxlen = 32 },
-  { .name = "wifi_ap_pw", .minlen = 0, .maxlen = 63 },
-  { .name = "wifi_cl_ssid", .minlen = 2, .maxlen = 32 },
-  { .name = "wifi_cl_pw", .minlen = 0, .maxlen = 63 },
-  { .name = "wpd_sensid_t%03d", .minlen = 0, .maxlen = 11, .arraysize = NR_SENSORTYPES },
-  { .name = "wpd_token", .minlen = 0, .maxlen = 64 },
+/* Receives a firmware image as the raw body of the POST request, and
+ * writes it directly to the inactive OTA partition while it is arriving.
+ * The image is never held in RAM as a whole. If the query string contains
+ * sha256=<64 hex digits>, the image must match that hash.
+ * If user_ctx is set, the body is a delta against the running firmware
+ * instead (see ota.c), which contains its own hashes.
+ * Note that this keeps the (only) httpd task busy until the upload is
+ * complete, including hashing the running firmware at the start of a
+ * delta. Nothing else, /otastatus included, is served in the meantime,
+ * so the admin page shows the upload progress the browser reports. */
+esp_err_t post_adminupload(httpd_req_t * req) {
+  uint8_t myresponse[300];
+  uint8_t tmp1[100];
+  uint8_t expsha[32];
+  uint8_t gotsha[32];
+  int haveexpsha = 0;
+  int isdelta = (req->user_ctx != NULL);
+  if (checkauthtoken(req) != 1) {
+    httpd_resp_set_status(req, "403 Forbidden");
+    httpd_resp_send(req, pleaseloginfirstmsg, HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+  }
+  esp_err_t qr = httpd_req_get_url_query_str(req, tmp1, sizeof(tmp1));
+  if (qr == ESP_ERR_HTTPD_RESULT_TRUNC) {
+    /* We might have lost the sha256, and must not flash without checking it. */
+    httpd_resp_set_status(req, "400 Bad Request");
+    httpd_resp_send(req, "Query string too long.", HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+  }
+  if (qr == ESP_OK) {
+    uint8_t shahex[65];
+    qr = httpd_query_key_value(tmp1, "sha256", shahex, sizeof(shahex));
+    if (qr != ESP_ERR_NOT_FOUND) { /* also if the value was too long */
+      haveexpsha = (qr == ESP_OK) && (strlen(shahex) == 64);
+      for (int i = 0; (i < 32) && (haveexpsha); i++) {
+        if ((hexdigitval[shahex[i*2]] == 0) || (hexdigitval[shahex[i*2+1]] == 0)) {
+          haveexpsha = 0;
+        } else {
+          expsha[i] = ((hexdigitval[shahex[i*2]] - 1) << 4) | (hexdigitval[shahex[i*2+1]] - 1);
+        }
+      }
+      if (haveexpsha == 0) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_send(req, "Invalid sha256 parameter, need 64 hex digits.", HTTPD_RESP_USE_STRLEN);
+        return ESP_OK;
+      }
+    }
+  }
+  esp_err_t e = (isdelta) ? ota_delta_begin() : ota_upload_begin(req->content_len);
+  if (e != ESP_OK) {
+    if (e == ESP_ERR_INVALID_STATE) {
+      httpd_resp_set_status(req, "409 Conflict");
+      httpd_resp_send(req, "There already is a firmware update in progress.", HTTPD_RESP_USE_STRLEN);
+    } else if (e == ESP_ERR_INVALID_SIZE) {
+      httpd_resp_set_status(req, "413 Content Too Large");
+      httpd_resp_send(req, "The image does not fit into the OTA partition.", HTTPD_RESP_USE_STRLEN);
+    } else {
+      httpd_resp_set_status(req, "500 Internal Server Error");
+      httpd_resp_send(req, "Failed to prepare the firmware update.", HTTPD_RESP_USE_STRLEN);
+    }
+    return ESP_OK;
+  }
+  /* Flash is written in 4 KB sectors, so use the same for receiving. */
+  uint8_t * rxbuf = malloc(4096);
+  if (rxbuf == NULL) {
+    if (isdelta) {
+      ota_delta_abort("Out of memory.");
+    } else {
+      ota_upload_abort("Out of memory.");
+    }
+    httpd_resp_set_status(req, "500 Internal Server Error");
+    httpd_resp_send(req, "Out of memory.", HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+  }
+  int64_t starttime = esp_timer_get_time();
+  int64_t flashtime = 0; /* time spent writing (and for deltas: patching) */
+  size_t remaining = req->content_len;
+  int timeouts = 0;
+  while (remaining > 0) {
+    int ret = httpd_req_recv(req, rxbuf, (remaining > 4096) ? 4096 : remaining);
+    if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+      /* Slow uplink - retry a few times before giving up. */
+      if (++timeouts < 5) continue;
+    }
+    if (ret <= 0) {
+      free(rxbuf);
+      if (isdelta) {
+        ota_delta_abort("Receiving the image failed.");
+      } else {
+        ota_upload_abort("Receiving the image failed.");
+      }
+      /* The connection is most likely dead, but try anyways. */
+      httpd_resp_set_status(req, "500 Internal Server Error");
+      httpd_resp_send(req, "Receiving the image failed.", HTTPD_RESP_USE_STRLEN);
+      return ESP_FAIL;
+    }
+    timeouts = 0;
+    int64_t wst = esp_timer_get_time();
+    e = (isdelta) ? ota_delta_write(rxbuf, ret) : ota_upload_write(rxbuf, ret);
+    flashtime += esp_timer_get_time() - wst;
+    if (e != ESP_OK) {
+      free(rxbuf);
+      httpd_resp_set_status(req, "500 Internal Server Error");
+      httpd_resp_send(req, "Writing the image to flash failed.", HTTPD_RESP_USE_STRLEN);
+      /* Tell the server to close the connection, there is unread data left. */
+      return ESP_FAIL;
+    }
+    remaining -= ret;
+  }
+  free(rxbuf);
+  if (isdelta) {
+    e = ota_delta_finish();
+  } else {
+    e = ota_upload_finish((haveexpsha ? expsha : NULL), gotsha);
+  }
+  int64_t totaltime = esp_timer_get_time() - starttime;
+  if (totaltime < 1) totaltime = 1;
+  if (flashtime < 1) flashtime = 1;
+  ESP_LOGI("webserver.c", "Firmware upload of %d bytes took %lld ms, %lld ms of that writing flash.",
+           req->content_len, totaltime / 1000, flashtime / 1000);
+  if (e != ESP_OK) {
+    httpd_resp_set_status(req, "400 Bad Request");
+    if ((e == ESP_ERR_INVALID_CRC) && (isdelta)) {
+      strcpy(myresponse, "Delta does not match the running or the resulting firmware, update cancelled.");
+    } else if (e == ESP_ERR_INVALID_CRC) {
+      strcpy(myresponse, "SHA-256 of the uploaded image does not match, update cancelled.");
+    } else {
+      strcpy(myresponse, "The uploaded image was rejected, update cancelled.");
+    }
+    httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+  }
+  int ml = sprintf(myresponse, "OK, received and flashed %d bytes in %.1f s (%lld KB/s overall, %lld KB/s flash writes).",
+                   req->content_len, (float)totaltime / 1000000.0,
+                   ((int64_t)req->content_len * 1000LL) / totaltime,
+                   ((int64_t)req->content_len * 1000LL) / flashtime);
+  if (!isdelta) {
+    ml += sprintf(&myresponse[ml], "<br>SHA-256: ");
+    for (int i = 0; i < 32; i++) {
+      ml += sprintf(&myresponse[ml], "%02x", gotsha[i]);
+    }
+  }
+  strcat(myresponse, "<br>Will reboot in 3 seconds. Remember to mark the new firmware as good afterwards.");
+  httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
+  vTaskDelay(3 * (1000 / portTICK_PERIOD_MS));
+  esp_restart();
+  /* This should not be reached */
+  return ESP_OK;
+}
+
+static httpd_uri_t uri_adminupload = {
+  .uri      = "/adminaction/upload",
+  .method   = HTTP_POST,
+  .handler  = post_adminupload,
+  .user_ctx = NULL
 };
 
-static const struct u8set_s u8sets[] = {
-  { .name = "lps35hw_addr", .minval = 0, .maxval = 1 },
-  { .name = "lps35hw_i2cport", .minval = 0, .maxval = 2 },
-  { .name = "rg15_serport", .minval = 0, .maxval = 1 },
-  { .name = "scd41_i2cport", .minval = 0, .maxval = 2 },
-  { .name = "scd41_selfcal", .minval = 0, .maxval = 2 },
-  { .name = "sen50_i2cport", .minval = 0, .maxval = 2 },
-  { .name = "ser_1_rx", .minval = 0, .maxval = 64 },
-  { .name = "ser_1_tx", .minval = 0, .maxval = 64 },
-  { .name = "sgp40_i2cport", .minval = 0, .maxval = 2 },
-  { .name = "sht4x_addr", .minval = 0, .maxval = 2 },
-  { .name = "sht4x_i2cport", .minval = 0, .maxval = 2 },
-  { .name = "i2c_0_pullups", .minval = 0, .maxval = 1 },
-  { .name = "i2c_0_scl", .minval = 0, .maxval = 64 },
-  { .name = "i2c_0_sda", .minval = 0, .maxval = 64 },
-  { .name = "i2c_0_speed", .minval = 0, .maxval = 4 },
-  { .name = "i2c_1_pullups", .minval = 0, .maxval = 1 },
-  { .name = "i2c_1_scl", .minval = 0, .maxval = 64 },
-  { .name = "i2c_1_sda", .minval = 0, .maxval = 64 },
-  { .name = "i2c_1_speed", .minval = 0, .maxval = 4 },
-  { .name = "wifi_mode", .minval = 0, .maxval = 1 },
-  { .name = "wpd_enabled", .minval = 0, .maxval = 1 },
-  { .name = "di_type", .minval = 0, .maxval = 2 },
-  { .name = "di_i2cport", .minval = 0, .maxval = 2 },
+static httpd_uri_t uri_adminuploaddelta = {
+  .uri      = "/adminaction/uploaddelta",
+  .method   = HTTP_POST,
+  .handler  = post_adminupload,
+  .user_ctx = "delta"
 };
 
 esp_err_t post_savesettings(httpd_req_t * req) {
@@ -935,116 +1289,99 @@ esp_err_t post_savesettings(httpd_req_t * req) {
     httpd_resp_send(req, "Error accessing non-volatile storage for settings.", HTTPD_RESP_USE_STRLEN);
     return ESP_OK;
   }
-  /* string values */
-  for (int i = 0; i < (sizeof(strsets) / sizeof(struct strset_s)); i++) {
-    for (int arpos = 0; arpos < ((strsets[i].arraysize < 1) ? 1 : strsets[i].arraysize); arpos++) {
-      uint8_t strsname[50];
-      if (strsets[i].arraysize > 0) { // this should contain one %d in the name
-        sprintf(strsname, strsets[i].name, arpos);
-      } else { // no array, so no %d in name, just copy over.
-        strcpy(strsname, strsets[i].name);
-      }
+  for (int i = 0; i < nr_settingsschema; i++) {
+    const struct settingdef * sd = &settingsschema[i];
+    if (sd->type == SETT_HEADING) continue;
+    for (int arpos = 0; arpos < ((sd->arraysize < 1) ? 1 : sd->arraysize); arpos++) {
+      uint8_t strsname[16];
+      settings_getkey(sd, arpos, strsname);
       if (httpd_query_key_value(postcontent, strsname, tmp1, sizeof(tmp1)) != ESP_OK) {
         continue; // No such setting in submitted values.
       }
-      unescapeuestring(tmp1);
-      if (strlen(tmp1) < strsets[i].minlen) {
-        sprintf(myresponse, "ERROR: '%s' needs to be at least %d characters long.",
-                            strsname, strsets[i].minlen);
-        httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
-        return ESP_OK;
-      }
-      if (strlen(tmp1) > strsets[i].maxlen) {
-        sprintf(myresponse, "ERROR: '%s' can be at most %d characters long.",
-                            strsname, strsets[i].maxlen);
-        httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
-        return ESP_OK;
-      }
-      /* Length seems OK. Those were the common sanity checks, now special cases: */
-      if (strcmp(strsname, "adminpw") == 0) {
-        if (strlen(tmp1) == 0) { /* Field empty, user does not want to change the password. */
-          continue;
-        }
-        /* Changing the adminpw requires entering the old password, and the new
-         * password twice. */
-        if (httpd_query_key_value(postcontent, "curadminpw", tmp2, sizeof(tmp2)) != ESP_OK) {
-          strcpy(myresponse, "ERROR: cannot change admin password - current password entered incorrectly.");
+      if ((sd->type == SETT_U8) || (sd->type == SETT_GPIO)) {
+        long newv = strtol(tmp1, NULL, 10);
+        if ((newv < sd->min) || (newv > sd->max)) {
+          sprintf(myresponse, "ERROR: value %ld for '%s' is outside permitted range [%u...%u]",
+                              newv, strsname, sd->min, sd->max);
           httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
           return ESP_OK;
         }
-        unescapeuestring(tmp2);
-        if (strcmp(tmp2, settings.adminpw) != 0) {
-          strcpy(myresponse, "ERROR: cannot change admin password - current password entered incorrectly.");
-          httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
+        /* Range is valid, has the value changed? */
+        uint8_t oldv = 0;
+        e = nvs_get_u8(nvshandle, strsname, &oldv);
+        if ((e != ESP_OK) && (e != ESP_ERR_NVS_NOT_FOUND)) {
+          ESP_LOGE("webserver.c", "Failed to query setting in flash: %s.",
+                                  esp_err_to_name(e));
+          httpd_resp_set_status(req, "500 Internal Server Error");
+          httpd_resp_send(req, "Error reading non-volatile storage for settings.", HTTPD_RESP_USE_STRLEN);
           return ESP_OK;
         }
-        /* OK, so current password is entered correctly, are both fields for the new PW identical? */
-        if (httpd_query_key_value(postcontent, "repadminpw", tmp2, sizeof(tmp2)) != ESP_OK) {
-          strcpy(myresponse, "ERROR: cannot change admin password - new password entered incorrectly.");
+        if ((e != ESP_ERR_NVS_NOT_FOUND) && (oldv == newv)) {
+          continue; // unchanged.
+        }
+        // OK, this setting has changed. Write the changed value.
+        e = nvs_set_u8(nvshandle, strsname, (uint8_t)newv);
+      } else { /* SETT_STR or SETT_ADMINPW */
+        unescapeuestring(tmp1);
+        if (strlen(tmp1) < sd->min) {
+          sprintf(myresponse, "ERROR: '%s' needs to be at least %d characters long.",
+                              strsname, sd->min);
           httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
           return ESP_OK;
         }
-        unescapeuestring(tmp2);
-        if (strcmp(tmp2, tmp1) != 0) {
-          strcpy(myresponse, "ERROR: cannot change admin password - fields for new password are not identical.");
+        if (strlen(tmp1) > sd->max) {
+          sprintf(myresponse, "ERROR: '%s' can be at most %d characters long.",
+                              strsname, sd->max);
           httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
           return ESP_OK;
         }
-      }
-      /* Has the value changed? */
-      size_t len = sizeof(tmp2);
-      e = nvs_get_str(nvshandle, strsname, tmp2, &len);
-      if ((e != ESP_OK) && (e != ESP_ERR_NVS_NOT_FOUND)) {
-        ESP_LOGE("webserver.c", "Failed to query setting in flash: %s.",
-                                esp_err_to_name(e));
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_send(req, "Error reading non-volatile storage for settings.", HTTPD_RESP_USE_STRLEN);
-        return ESP_OK;
-      }
-      if ((e == ESP_ERR_NVS_NOT_FOUND)
-       || (strcmp(tmp1, tmp2) != 0)) { // OK, this setting has changed.
-        // Write the changed value.
-        e = nvs_set_str(nvshandle, strsname, tmp1);
-        if (e != ESP_OK) {
-          ESP_LOGE("webserver.c", "Failed to write changed setting to flash: %s.",
+        /* Length seems OK. Those were the common sanity checks, now special cases: */
+        if (sd->type == SETT_ADMINPW) {
+          if (strlen(tmp1) == 0) { /* Field empty, user does not want to change the password. */
+            continue;
+          }
+          /* Changing the adminpw requires entering the old password, and the new
+           * password twice. */
+          if (httpd_query_key_value(postcontent, "curadminpw", tmp2, sizeof(tmp2)) != ESP_OK) {
+            strcpy(myresponse, "ERROR: cannot change admin password - current password entered incorrectly.");
+            httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
+            return ESP_OK;
+          }
+          unescapeuestring(tmp2);
+          if (strcmp(tmp2, settings.adminpw) != 0) {
+            strcpy(myresponse, "ERROR: cannot change admin password - current password entered incorrectly.");
+            httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
+            return ESP_OK;
+          }
+          /* OK, so current password is entered correctly, are both fields for the new PW identical? */
+          if (httpd_query_key_value(postcontent, "repadminpw", tmp2, sizeof(tmp2)) != ESP_OK) {
+            strcpy(myresponse, "ERROR: cannot change admin password - new password entered incorrectly.");
+            httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
+            return ESP_OK;
+          }
+          unescapeuestring(tmp2);
+          if (strcmp(tmp2, tmp1) != 0) {
+            strcpy(myresponse, "ERROR: cannot change admin password - fields for new password are not identical.");
+            httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
+            return ESP_OK;
+          }
+        }
+        /* Has the value changed? */
+        size_t len = sizeof(tmp2);
+        e = nvs_get_str(nvshandle, strsname, tmp2, &len);
+        if ((e != ESP_OK) && (e != ESP_ERR_NVS_NOT_FOUND)) {
+          ESP_LOGE("webserver.c", "Failed to query setting in flash: %s.",
                                   esp_err_to_name(e));
           httpd_resp_set_status(req, "500 Internal Server Error");
-          httpd_resp_send(req, "Error writing non-volatile storage for settings.", HTTPD_RESP_USE_STRLEN);
+          httpd_resp_send(req, "Error reading non-volatile storage for settings.", HTTPD_RESP_USE_STRLEN);
           return ESP_OK;
         }
-        settingshavechanged = 1;
-        strcat(myresponse, "'");
-        strcat(myresponse, strsname);
-        strcat(myresponse, "' changed.<br>");
+        if ((e != ESP_ERR_NVS_NOT_FOUND) && (strcmp(tmp1, tmp2) == 0)) {
+          continue; // unchanged.
+        }
+        // OK, this setting has changed. Write the changed value.
+        e = nvs_set_str(nvshandle, strsname, tmp1);
       }
-    }
-  }
-  /* u8 values */
-  for (int i = 0; i < (sizeof(u8sets) / sizeof(struct u8set_s)); i++) {
-    if (httpd_query_key_value(postcontent, u8sets[i].name, tmp1, sizeof(tmp1)) != ESP_OK) {
-      continue; // No such setting in submitted values.
-    }
-    long newv = strtol(tmp1, NULL, 10);
-    if ((newv < u8sets[i].minval) || (newv > u8sets[i].maxval)) {
-      sprintf(myresponse, "ERROR: value %ld for '%s' is outside permitted range [%u...%u]",
-                          newv, u8sets[i].name, u8sets[i].minval, u8sets[i].maxval);
-      httpd_resp_send(req, myresponse, HTTPD_RESP_USE_STRLEN);
-      return ESP_OK;
-    }
-    /* Range is valid, has the value changed? */
-    uint8_t oldv = 0;
-    e = nvs_get_u8(nvshandle, u8sets[i].name, &oldv);
-    if ((e != ESP_OK) && (e != ESP_ERR_NVS_NOT_FOUND)) {
-      ESP_LOGE("webserver.c", "Failed to query setting in flash: %s.",
-                              esp_err_to_name(e));
-      httpd_resp_set_status(req, "500 Internal Server Error");
-      httpd_resp_send(req, "Error reading non-volatile storage for settings.", HTTPD_RESP_USE_STRLEN);
-      return ESP_OK;
-    }
-    if ((e == ESP_ERR_NVS_NOT_FOUND)
-     || (oldv != newv)) { // OK, this setting has changed.
-      // Write the changed value.
-      e = nvs_set_u8(nvshandle, u8sets[i].name, (uint8_t)newv);
       if (e != ESP_OK) {
         ESP_LOGE("webserver.c", "Failed to write changed setting to flash: %s.",
                                 esp_err_to_name(e));
@@ -1054,7 +1391,7 @@ esp_err_t post_savesettings(httpd_req_t * req) {
       }
       settingshavechanged = 1;
       strcat(myresponse, "'");
-      strcat(myresponse, u8sets[i].name);
+      strcat(myresponse, strsname);
       strcat(myresponse, "' changed.<br>");
     }
   }
@@ -1089,19 +1426,27 @@ void webserver_start(void) {
   config.max_uri_handlers = 16;
   /* The default is undocumented, but seems to be only 4k. */
   config.stack_size = 8192;
+  /* for the statistics in /debug */
+  config.open_fn = httpdopenfn;
+  config.close_fn = httpdclosefn;
+  httpdstats.maxsockets = config.max_open_sockets;
   ESP_LOGI("webserver.c", "Starting webserver on port %d", config.server_port);
   if (httpd_start(&server, &config) != ESP_OK) {
     ESP_LOGE("webserver.c", "Failed to start HTTP server.");
     return;
   }
-  httpd_register_uri_handler(server, &uri_startpage);
-  httpd_register_uri_handler(server, &uri_json);
-  httpd_register_uri_handler(server, &uri_debug);
-  httpd_register_uri_handler(server, &uri_startpage_js);
-  httpd_register_uri_handler(server, &uri_css_css);
-  httpd_register_uri_handler(server, &uri_adminlogin);
-  httpd_register_uri_handler(server, &uri_adminmenu);
-  httpd_register_uri_handler(server, &uri_adminaction);
-  httpd_register_uri_handler(server, &uri_savesettings);
+  registeruri(server, &uri_startpage);
+  registeruri(server, &uri_json);
+  registeruri(server, &uri_cbor);
+  registeruri(server, &uri_debug);
+  registeruri(server, &uri_startpage_js);
+  registeruri(server, &uri_css_css);
+  registeruri(server, &uri_adminlogin);
+  registeruri(server, &uri_adminmenu);
+  registeruri(server, &uri_adminaction);
+  registeruri(server, &uri_otastatus);
+  registeruri(server, &uri_adminupload);
+  registeruri(server, &uri_adminuploaddelta);
+  registeruri(server, &uri_savesettings);
 }
 
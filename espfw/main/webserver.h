@@ -16,6 +16,8 @@ struct ev {
   float press;
   float raing;
   float temp;
+  float vocidx; /* VOC index, see vocindex.h */
+  float noxidx; /* NOx index */
   uint16_t co2;
 };
 
@@ -0,0 +1,150 @@
+/* Helper functions for the webserver. See webutil.h. */
+
+#include <inttypes.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include "submit.h"
+#include "webserver.h"
+#include "webutil.h"
+
+const uint8_t hexdigitval[256] = {
+  ['0'] =  1, ['1'] =  2, ['2'] =  3, ['3'] =  4, ['4'] =  5,
+  ['5'] =  6, ['6'] =  7, ['7'] =  8, ['8'] =  9, ['9'] = 10,
+  ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+  ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+};
+
+void unescapeuestring(uint8_t * s) {
+  uint8_t * rp = s;
+  uint8_t * wp = s;
+  while (*rp != 0) {
+    if (*rp == '+') {
+      *wp = ' ';
+      rp++;
+    } else if ((*rp == '%') && (hexdigitval[rp[1]] != 0) && (hexdigitval[rp[2]] != 0)) {
+      /* (rp[2] is not read if rp[1] is the terminating \0) */
+      *wp = ((hexdigitval[rp[1]] - 1) << 4) | (hexdigitval[rp[2]] - 1);
+      rp += 3;
+    } else {
+      *wp = *rp;
+      rp++;
+    }
+    wp++;
+  }
+  *wp = 0;
+}
+
+void htmlescape(const uint8_t * s, htmlescape_outfn_t out, void * ctx) {
+  const uint8_t * run = s; /* start of the not-yet-written unescaped part */
+  for (; *s != 0; s++) {
+    const uint8_t * esc;
+    switch (*s) {
+    case '&':  esc = "&amp;"; break;
+    case '<':  esc = "&lt;"; break;
+    case '>':  esc = "&gt;"; break;
+    case '"':  esc = "&quot;"; break;
+    case '\'': esc = "&#39;"; break;
+    default:   continue;
+    };
+    if (s > run) {
+      out(ctx, run, s - run);
+    }
+    out(ctx, esc, strlen(esc));
+    run = s + 1;
+  }
+  if (s > run) {
+    out(ctx, run, s - run);
+  }
+}
+
+int cbor_puthead(uint8_t * p, uint8_t major, uint64_t val) {
+  int n;
+  major <<= 5;
+  if (val < 24) {
+    p[0] = major | val;
+    return 1;
+  } else if (val <= 0xff) {
+    p[0] = major | 24; n = 1;
+  } else if (val <= 0xffff) {
+    p[0] = major | 25; n = 2;
+  } else if (val <= 0xffffffffULL) {
+    p[0] = major | 26; n = 4;
+  } else {
+    p[0] = major | 27; n = 8;
+  }
+  for (int i = n; i > 0; i--) {
+    p[i] = val & 0xff;
+    val >>= 8;
+  }
+  return n + 1;
+}
+
+int cbor_putint(uint8_t * p, int64_t val) {
+  if (val < 0) {
+    return cbor_puthead(p, 1, (uint64_t)(-1 - val));
+  }
+  return cbor_puthead(p, 0, val);
+}
+
+int cbor_putfloat(uint8_t * p, float val) {
+  uint32_t u;
+  if (isnan(val)) {
+    p[0] = 0xf6; /* null */
+    return 1;
+  }
+  memcpy(&u, &val, sizeof(u));
+  p[0] = 0xfa; /* major type 7, single precision float */
+  p[1] = u >> 24; p[2] = u >> 16; p[3] = u >> 8; p[4] = u;
+  return 5;
+}
+
+size_t cbor_putsnapshot(uint8_t * out, const struct ev * ev, uint32_t have) {
+  uint8_t * p = &out[1];
+  int nent = 0;
+  if (have & CBORS_SHT4XHEAT) {
+    p += cbor_putint(p, CBORK_LASTSHT4XHEAT); p += cbor_putint(p, ev->lastsht4xheat);
+    nent++;
+  }
+  if (have & CBORS_TEMPHUM) {
+    p += cbor_putint(p, ST_TEMPERATURE); p += cbor_putfloat(p, ev->temp);
+    p += cbor_putint(p, ST_HUMIDITY); p += cbor_putfloat(p, ev->hum);
+    nent += 2;
+  }
+  if (have & CBORS_PM) {
+    p += cbor_putint(p, ST_PM010); p += cbor_putfloat(p, ev->pm010);
+    p += cbor_putint(p, ST_PM025); p += cbor_putfloat(p, ev->pm025);
+    p += cbor_putint(p, ST_PM040); p += cbor_putfloat(p, ev->pm040);
+    p += cbor_putint(p, ST_PM100); p += cbor_putfloat(p, ev->pm100);
+    nent += 4;
+  }
+  if (have & CBORS_PRESS) {
+    p += cbor_putint(p, ST_PRESSURE); p += cbor_putfloat(p, ev->press);
+    nent++;
+  }
+  if (have & CBORS_RAIN) {
+    p += cbor_putint(p, ST_RAINGAUGE); p += cbor_putfloat(p, ev->raing);
+    nent++;
+  }
+  if (have & CBORS_CO2) {
+    p += cbor_putint(p, ST_CO2);
+    if (ev->co2 == 0xffff) {
+      *p++ = 0xf6; /* null */
+    } else {
+      p += cbor_putint(p, ev->co2);
+    }
+    nent++;
+  }
+  if (have & CBORS_VOC) {
+    p += cbor_putint(p, ST_VOCINDEX); p += cbor_putfloat(p, ev->vocidx);
+    nent++;
+  }
+  if (have & CBORS_NOX) {
+    p += cbor_putint(p, ST_NOXINDEX); p += cbor_putfloat(p, ev->noxidx);
+    nent++;
+  }
+  p += cbor_putint(p, CBORK_TS); p += cbor_putint(p, ev->lastupd);
+  nent++;
+  out[0] = 0xa0 | nent; /* map with nent pairs, always < 24 */
+  return p - out;
+}
@@ -0,0 +1,58 @@
+/* Helper functions for the webserver that do not use anything ESP
+ * specific, so they can be tested on a PC (see tools/webutiltest). */
+
+#ifndef _WEBUTIL_H_
+#define _WEBUTIL_H_
+
+#include <inttypes.h>
+#include <stddef.h>
+
+/* Value + 1 of every hex digit, 0 for everything that isn't one. */
+extern const uint8_t hexdigitval[256];
+
+/* Unescapes a x-www-form-urlencoded string in a single pass.
+ * Modifies the string inplace! The result is never longer than the input.
+ * '+' becomes a space, and %XX becomes the byte with hex value XX.
+ * A '%' that is not followed by two hex digits is kept as it is, and
+ * %00 ends the string there.
+ * Note that the result can contain any character, so it must be run
+ * through htmlescape() before it is put into HTML. */
+void unescapeuestring(uint8_t * s);
+
+/* Escapes a \0-terminated string so that it can be used as HTML text or
+ * inside a (quoted) HTML attribute value. The result is handed to out in
+ * pieces, unescaped runs directly from s. */
+typedef void (* htmlescape_outfn_t)(void * ctx, const uint8_t * d, size_t len);
+void htmlescape(const uint8_t * s, htmlescape_outfn_t out, void * ctx);
+
+/* CBOR (RFC 8949) encoding. These write one item to p, and return the
+ * number of bytes written (at most 9). */
+int cbor_puthead(uint8_t * p, uint8_t major, uint64_t val);
+int cbor_putint(uint8_t * p, int64_t val);
+/* Single precision float, NaN becomes null. */
+int cbor_putfloat(uint8_t * p, float val);
+
+/* The CBOR snapshot of the current values, as served by /cbor. It is a
+ * map. Measurements use the numeric value of enum sensortypes as their
+ * key, so the keys are as stable as those. Metadata uses negative keys,
+ * see CBORK_*. Values are native integers or single precision floats, a
+ * value that could not be read is null. */
+#define CBORK_TS            -1  /* time of last update (unix timestamp) */
+#define CBORK_LASTSHT4XHEAT -2  /* time of last SHT4x heater run */
+/* Which values the snapshot contains, depending on the enabled sensors */
+#define CBORS_SHT4XHEAT 0x01
+#define CBORS_TEMPHUM   0x02
+#define CBORS_PM        0x04
+#define CBORS_PRESS     0x08
+#define CBORS_RAIN      0x10
+#define CBORS_CO2       0x20
+#define CBORS_VOC       0x40
+#define CBORS_NOX       0x80
+/* At most 13 entries of at most 9+9 bytes each, plus map head. */
+#define CBORS_MAXSIZE (13 * 18 + 1)
+struct ev;
+/* Writes the snapshot of ev with the values in have (CBORS_*) to out,
+ * which needs room for CBORS_MAXSIZE bytes. Returns the size. */
+size_t cbor_putsnapshot(uint8_t * out, const struct ev * ev, uint32_t have);
+
+#endif /* _WEBUTIL_H_ */
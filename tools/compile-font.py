@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+
+# Compiles a bitmap font in BDF format into C source for FoxESPTemp.
+# This replaces generate-terminus-font.sh. As Terminus is a bitmap font,
+# its BDF files contain exactly the pixels we want, no rasterizing or
+# guessing of point sizes needed.
+# Every glyph is cropped to the box that actually contains set pixels,
+# and stored bit-packed (row by row, MSB first, no padding between rows).
+# Each glyph also gets its position inside the character cell and its
+# advance, so fonts can be proportional. Code points are mapped to glyphs
+# through a sorted list of ranges, so any Unicode code point can be used.
+# See espfw/main/fonts/font.h for the resulting data structures.
+# Glyphs may be up to 255 pixels wide (di_drawchar draws wide ones in
+# slices of 24 columns), but their bottom must be at most 56 pixels below
+# the top of the character cell: drawing shifts every column of a glyph
+# by up to 7 rows within a 64 bit word.
+# The BDF files of the fonts we use are in espfw/main/fonts, next to
+# the generated C files, and compile with the default options.
+#
+# Syntax: compile-font.py [options] <font.bdf> <name>
+# Options:
+#   --chars=LIST      code points to include, as comma separated list of
+#                     single values or ranges, decimal or 0x-hex.
+#                     Default: ASCII, plus some Latin-1 characters we need.
+#   --proportional    drop the left bearing of every glyph and set its
+#                     advance to its width plus --spacing pixels.
+#   --spacing=N       space between glyphs for --proportional (default 1).
+# Example (in espfw/main/fonts):
+#   ../../../tools/compile-font.py terminus38bold.bdf terminus38bold > terminus38bold.c
+
+import sys
+
+# ASCII, degree, plusminus, superscript 2 and 3, micro, and german umlauts.
+DEFAULTCHARS = "32-126,0xb0-0xb3,0xb5,0xc4,0xd6,0xdc,0xe4,0xf6,0xfc"
+
+
+def parsechars(s):
+  res = set()
+  for part in s.split(","):
+    if "-" in part:
+      a, b = part.split("-")
+      res.update(range(int(a, 0), int(b, 0) + 1))
+    else:
+      res.add(int(part, 0))
+  return res
+
+
+def readbdf(fn):
+  """Returns (ascent, descent, cellwidth, comments, glyphs), glyphs being a
+  dict codepoint -> (dwidth, bbw, bbh, bbxoff, bbyoff, rows), rows being
+  lists of 0/1 for every pixel."""
+  ascent = descent = cellw = None
+  comments = []
+  glyphs = {}
+  with open(fn, "r", encoding="latin-1") as f:
+    lines = iter(f.read().splitlines())
+  for l in lines:
+    w = l.split()
+    if len(w) == 0:
+      continue
+    if w[0] == "COPYRIGHT" or w[0] == "NOTICE":
+      comments.append(l.split(None, 1)[1].strip("\""))
+    elif w[0] == "FONT_ASCENT":
+      ascent = int(w[1])
+    elif w[0] == "FONT_DESCENT":
+      descent = int(w[1])
+    elif w[0] == "FONTBOUNDINGBOX":
+      cellw = int(w[1])
+    elif w[0] == "STARTCHAR":
+      enc = -1
+      dwidth = cellw
+      bbx = None
+      for l in lines:
+        w = l.split()
+        if w[0] == "ENCODING":
+          enc = int(w[1])
+        elif w[0] == "DWIDTH":
+          dwidth = int(w[1])
+        elif w[0] == "BBX":
+          bbx = [int(v) for v in w[1:5]]
+        elif w[0] == "BITMAP":
+          rows = []
+          for l in lines:
+            if l.strip() == "ENDCHAR":
+              break
+            v = int(l.strip(), 16)
+            nbits = len(l.strip()) * 4
+            rows.append([(v >> (nbits - 1 - i)) & 1 for i in range(bbx[0])])
+          if enc >= 0:
+            glyphs[enc] = (dwidth, bbx[0], bbx[1], bbx[2], bbx[3], rows)
+          break
+  if (ascent is None) or (descent is None):
+    raise ValueError("%s does not contain FONT_ASCENT/FONT_DESCENT" % fn)
+  return ascent, descent, cellw, comments, glyphs
+
+
+def main():
+  chars = parsechars(DEFAULTCHARS)
+  proportional = False
+  spacing = 1
+  args = []
+  for a in sys.argv[1:]:
+    if a.startswith("--chars="):
+      chars = parsechars(a[8:])
+    elif a == "--proportional":
+      proportional = True
+    elif a.startswith("--spacing="):
+      spacing = int(a[10:])
+    else:
+      args.append(a)
+  if len(args) != 2:
+    print("Syntax: %s [--chars=LIST] [--proportional] [--spacing=N] <font.bdf> <name>" % sys.argv[0],
+          file=sys.stderr)
+    sys.exit(1)
+  ascent, descent, cellw, comments, bdfglyphs = readbdf(args[0])
+  name = args[1]
+  height = ascent + descent
+  out = []  # (cp, dataoff, w, h, xoff, yoff, advance, rows)
+  data = bytearray()
+  missing = []
+  for cp in sorted(chars):
+    if cp not in bdfglyphs:
+      missing.append(cp)
+      continue
+    dwidth, bbw, bbh, bbxoff, bbyoff, rows = bdfglyphs[cp]
+    top = ascent - (bbyoff + bbh)  # top of bitmap, relative to top of cell
+    # crop to the pixels that are set
+    setrows = [i for i in range(bbh) if any(rows[i])]
+    setcols = [i for i in range(bbw) if any(r[i] for r in rows)]
+    if len(setrows) == 0:
+      w = h = xoff = yoff = 0
+      crop = []
+    else:
+      r1, r2 = setrows[0], setrows[-1]
+      c1, c2 = setcols[0], setcols[-1]
+      crop = [r[c1:c2 + 1] for r in rows[r1:r2 + 1]]
+      w = c2 - c1 + 1
+      h = r2 - r1 + 1
+      xoff = bbxoff + c1
+      yoff = top + r1
+    advance = dwidth
+    if proportional:
+      if w > 0:
+        xoff = 0
+        advance = w + spacing
+      else:
+        advance = (dwidth + 1) // 2
+    if (w > 255) or (h + yoff > 56) or (yoff < 0) or (xoff < -128) or (xoff > 127) \
+       or (advance > 255):
+      print("ERROR: glyph %d is too large for the display code (%dx%d)" % (cp, w, h),
+            file=sys.stderr)
+      sys.exit(1)
+    bits = [b for r in crop for b in r]
+    dataoff = len(data)
+    for i in range(0, len(bits), 8):
+      chunk = bits[i:i + 8] + [0] * (8 - len(bits[i:i + 8]))
+      data.append(sum(b << (7 - j) for j, b in enumerate(chunk)))
+    out.append((cp, dataoff, w, h, xoff, yoff, advance, crop))
+  if len(data) > 65535:
+    print("ERROR: font data too large (%d bytes)" % len(data), file=sys.stderr)
+    sys.exit(1)
+  if missing:
+    print("Warning: %d requested code points not in font: %s"
+          % (len(missing), ",".join("%d" % m for m in missing)), file=sys.stderr)
+  # ranges of consecutive code points
+  ranges = []
+  for i, g in enumerate(out):
+    if ranges and (ranges[-1][0] + ranges[-1][1] == g[0]):
+      ranges[-1][1] += 1
+    else:
+      ranges.append([g[0], 1, i])
+  maxadv = max(g[6] for g in out)
+
+  p = print
+  p("/* Font definition: %s, compiled from %s" % (name, args[0].split("/")[-1]))
+  p(" * by tools/compile-font.py.")
+  p(" * Line height is %d pixels, %s, %d glyphs in %d bytes."
+    % (height, ("proportional" if proportional else "width is %d pixels" % maxadv),
+       len(out), len(data)))
+  for c in comments:
+    p(" * %s" % c.replace("*/", "* /"))
+  p(" */")
+  p("")
+  p("#include \"font.h\"")
+  p("")
+  p("static const uint8_t %s_data[] = {" % name)
+  for (cp, dataoff, w, h, xoff, yoff, advance, crop) in out:
+    nb = (w * h + 7) // 8
+    if cp == 32:
+      desc = " (space)"
+    elif (cp > 32) and (cp < 127) and (cp != ord("/")):
+      desc = " " + chr(cp)
+    else:  # keep the source ASCII
+      desc = ""
+    p("    /* U+%04X%s: %dx%d at %d/%d */" % (cp, desc, w, h, xoff, yoff))
+    for r in crop:
+      p("    // %s" % "".join("#" if b else "." for b in r))
+    if nb > 0:
+      bs = ["0x%02x," % b for b in data[dataoff:dataoff + nb]]
+      for i in range(0, len(bs), 12):
+        p("    " + " ".join(bs[i:i + 12]))
+  p("};")
+  p("")
+  p("static const struct fontglyph %s_glyphs[] = {" % name)
+  for (cp, dataoff, w, h, xoff, yoff, advance, crop) in out:
+    p("    { .dataoff = %5d, .w = %2d, .h = %2d, .xoff = %2d, .yoff = %2d, .advance = %2d }, /* U+%04X */"
+      % (dataoff, w, h, xoff, yoff, advance, cp))
+  p("};")
+  p("")
+  p("static const struct fontrange %s_ranges[] = {" % name)
+  for (first, count, gi) in ranges:
+    p("    { .first = 0x%04x, .count = %3d, .glyph = %3d }," % (first, count, gi))
+  p("};")
+  p("")
+  p("const struct font font_%s = {" % name)
+  p("    .data     = %s_data," % name)
+  p("    .glyphs   = %s_glyphs," % name)
+  p("    .ranges   = %s_ranges," % name)
+  p("    .nrranges = %d," % len(ranges))
+  p("    .width    = %d, /* widest advance */" % maxadv)
+  p("    .height   = %d, /* line height */" % height)
+  p("};")
+  p("")
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+
+# Compiles a HTML page template into C source for the FoxESPTemp webserver.
+# Placeholders in the template are written as {{name}}, where name may
+# contain letters, digits and underscores. The output is a .c and a .h
+# file: the literal text of the page as one constant array (which ends up
+# in flash), and a list of operations that either reference a span of that
+# text, or a slot that the webserver fills with dynamic content. The slots
+# are numbered in order of their first appearance, the header contains an
+# enum with names TS_<PAGE>_<NAME> for them.
+# Syntax: compile-webtemplate.py <template> <outputbasename>
+# e.g. "compile-webtemplate.py startpage.html startpage_html" will create
+# startpage_html.c and startpage_html.h with the template being called
+# 'startpage_html'.
+
+import os
+import re
+import sys
+
+# The webserver uses uint16_t for offsets and lengths.
+MAXTEXTLEN = 65535
+
+
+def cstring(data, indent):
+  """Formats bytes as a C string literal, one source line per line."""
+  lines = []
+  cur = ""
+  for b in data:
+    c = chr(b)
+    if c == "\\":
+      cur += "\\\\"
+    elif c == "\"":
+      cur += "\\\""
+    elif c == "\n":
+      cur += "\\n"
+      lines.append(cur)
+      cur = ""
+    elif (b >= 0x20) and (b < 0x7f):
+      cur += c
+    else:
+      cur += "\\%03o" % b
+  if cur != "":
+    lines.append(cur)
+  return "\n".join(indent + "\"" + l + "\"" for l in lines)
+
+
+def main():
+  if len(sys.argv) != 3:
+    print("Syntax: %s <template> <outputbasename>" % sys.argv[0])
+    sys.exit(1)
+  infile = sys.argv[1]
+  base = sys.argv[2]
+  name = os.path.basename(base)
+  with open(infile, "rb") as f:
+    tmpl = f.read()
+  text = bytearray()
+  ops = []  # (slot, offset, length), slot -1 for literal text
+  slots = []
+  pos = 0
+  for m in re.finditer(rb"\{\{([A-Za-z0-9_]+)\}\}", tmpl):
+    if m.start() > pos:
+      ops.append((-1, len(text), m.start() - pos))
+      text += tmpl[pos:m.start()]
+    sn = m.group(1).decode("ascii").upper()
+    if sn not in slots:
+      slots.append(sn)
+    ops.append((slots.index(sn), 0, 0))
+    pos = m.end()
+  if pos < len(tmpl):
+    ops.append((-1, len(text), len(tmpl) - pos))
+    text += tmpl[pos:]
+  if len(text) > MAXTEXTLEN:
+    print("ERROR: %s is too large (%d bytes of text)" % (infile, len(text)))
+    sys.exit(1)
+  if len(ops) > 255:
+    print("ERROR: %s has too many placeholders" % infile)
+    sys.exit(1)
+  ename = name.upper()
+  pfx = "TS_" + re.sub(r"_HTML$", "", ename) + "_"
+  with open(base + ".h", "w") as f:
+    f.write("/* Compiled from %s by tools/compile-webtemplate.py.\n" % os.path.basename(infile))
+    f.write(" * Do not edit, edit the template and run make instead. */\n\n")
+    f.write("#ifndef _%s_H_\n#define _%s_H_\n\n" % (ename, ename))
+    f.write("#include \"webtmpl.h\"\n\n")
+    f.write("enum %s_slots {\n" % name)
+    for i, sn in enumerate(slots):
+      f.write("  %s%s = %d,\n" % (pfx, sn, i))
+    f.write("};\n\n")
+    f.write("extern const struct webtmpl %s;\n\n" % name)
+    f.write("#endif /* _%s_H_ */\n\n" % ename)
+  with open(base + ".c", "w") as f:
+    f.write("/* Compiled from %s by tools/compile-webtemplate.py.\n" % os.path.basename(infile))
+    f.write(" * Do not edit, edit the template and run make instead. */\n\n")
+    f.write("#include \"%s.h\"\n\n" % name)
+    f.write("static const uint8_t text[%d] =\n" % (len(text) + 1))
+    f.write(cstring(text, "  ") + ";\n\n")
+    f.write("static const struct webtmplop ops[%d] = {\n" % len(ops))
+    for (slot, off, ln) in ops:
+      if slot < 0:
+        f.write("  { .slot = -1, .off = %d, .len = %d },\n" % (off, ln))
+      else:
+        f.write("  { .slot = %s%s },\n" % (pfx, slots[slot]))
+    f.write("};\n\n")
+    f.write("const struct webtmpl %s = {\n" % name)
+    f.write("  .text = text,\n  .ops = ops,\n  .nrops = %d\n};\n\n" % len(ops))
+
+
+if __name__ == "__main__":
+  main()
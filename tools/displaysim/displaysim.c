@@ -0,0 +1,535 @@
+
+/* displaysim - draws all display pages of FoxESPTemp on the host.
+ * This uses the very same drawing code as the firmware (displays.c,
+ * diwidgets.c, displaypages.c and the fonts), just without any display hardware, to
+ * check how pages look and how long drawing them takes, without flashing
+ * anything.
+ * Every page is drawn once with example values (and a made up history
+ * for the sparklines) and once with all values invalid, for a monochrome
+ * 128x64 OLED and the 128x296 e-paper display (written as PBM) and for a
+ * 240x320 color display drawn in bands of 32 rows like the SPI TFT driver
+ * does (written as PPM).
+ * With -w, it instead simulates a 128x64 OLED showing pages like the
+ * firmware does, for the given number of hours, and reports how evenly
+ * the pixels were worn and how many bytes were sent to the display.
+ * It also checks that wearlevel.c never moved part of a frame off the
+ * display, and exits with 1 if it did.
+ * With -e, it simulates the e-paper display with the refresh scheduler
+ * of the firmware for the given number of hours, and reports how many
+ * full and partial refreshes that took.
+ * With -b, it measures how many glyphs per second di_drawtext draws.
+ * Syntax: displaysim [-o outdir] [-c refdir] [-n iterations] [-w hours] [-e hours] [-b]
+ *   -o  write the images to outdir (default: current directory)
+ *   -c  compare the images with those in refdir, e.g. rendered before a
+ *       change. Exits with 1 if any of them differ.
+ *   -n  draw every page this many times for the timing (default 200,
+ *       0 only draws it once for the image)
+ *   -w  do the wear simulation instead
+ *   -e  do the e-paper simulation instead
+ *   -b  do the text benchmark instead, -n times 50 rounds per font
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "displays.h"
+#include "displaypages.h"
+#include "epdsched.h"
+#include "wearlevel.h"
+
+struct simdisplay {
+    const char * name;
+    int sizex;
+    int sizey;
+    int bpp;
+    int bandh;
+};
+
+static const struct simdisplay simdisplays[] = {
+    { "mono128x64", 128, 64, 1, 0 },
+    { "mono128x296", 128, 296, 1, 0 },
+    { "color240x320", 240, 320, 16, 32 },
+};
+
+static const int simpages[] = {
+    -100, -2, -1,
+    PAGE_TEMP, PAGE_HUM, PAGE_PRESS, PAGE_CO2,
+    PAGE_PM010, PAGE_PM025, PAGE_PM040, PAGE_PM100, PAGE_VOC, PAGE_NOX,
+};
+
+static void fillsnap(struct dispsnap * snap, int page, int valid)
+{
+    memset(snap, 0, sizeof(struct dispsnap));
+    snap->page = page;
+    strcpy(snap->fwdate, "Jan  1 2026");
+    if (valid) {
+      strcpy(snap->ip, "192.168.42.23");
+      snap->ev.temp = 21.37;
+      snap->ev.hum = 47.11;
+      snap->ev.press = 1013.25;
+      snap->ev.co2 = 1234; /* in the yellow range */
+      snap->ev.pm010 = 3.4;
+      snap->ev.pm025 = 18.9;
+      snap->ev.pm040 = 55.5; /* in the red range */
+      snap->ev.pm100 = 9.9;
+      snap->ev.vocidx = 87.0;
+      snap->ev.noxidx = 1.0;
+      dp_gethist(page, snap->hist);
+    } else {
+      snap->ev.temp = NAN;
+      snap->ev.hum = NAN;
+      snap->ev.press = NAN;
+      snap->ev.co2 = 0xffff;
+      snap->ev.pm010 = NAN;
+      snap->ev.pm025 = NAN;
+      snap->ev.pm040 = NAN;
+      snap->ev.pm100 = NAN;
+      snap->ev.vocidx = NAN;
+      snap->ev.noxidx = NAN;
+      dp_gethist(-1, snap->hist);
+    }
+}
+
+/* Fills the histories of all pages, with a gap, a slow wave, and the
+ * last values rising (temperature, CO2), falling (humidity) or flat. */
+static void fillhists(void)
+{
+    for (int i = 0; i < (DP_HISTLEN + 15); i++) {
+      struct ev ev;
+      float w = sinf(i / 8.0);
+      float ramp = (i > (DP_HISTLEN - 5)) ? (i - (DP_HISTLEN - 5)) : 0.0;
+      ev.temp = 21.0 + (0.5 * w) + (0.1 * ramp);
+      ev.hum = 50.0 + (3.0 * w) - (0.4 * ramp);
+      ev.press = 1013.0 + (0.3 * w);
+      ev.co2 = 900 + (200 * w) + (20 * ramp);
+      ev.pm010 = 3.0 + (2.0 * w);
+      ev.pm025 = 15.0 + (5.0 * w);
+      ev.pm040 = 50.0 + (10.0 * w);
+      ev.pm100 = 10.0 + (0.1 * w);
+      ev.vocidx = 100.0 + (40.0 * w);
+      ev.noxidx = 1.0 + (10.0 * w * w);
+      if ((i >= 30) && (i < 34)) { /* sensors failed for a few minutes */
+        ev.temp = NAN; ev.hum = NAN; ev.co2 = 0xffff; ev.pm100 = NAN;
+      }
+      dp_addvalues(&ev);
+    }
+}
+
+/* Draws a frame the way the display task does, band by band, and
+ * collects the result into img: 1 byte per pixel (0 or 1) for 1 bpp,
+ * 3 bytes (RGB) for 16 bpp. */
+static void drawframe(struct di_dispbuf * db, const struct dispsnap * snap, uint8_t * img)
+{
+    int bandh = db->bandh;
+    for (int y = 0; y < db->sizey; y += bandh) {
+      db->bandy = y;
+      db->bandh = ((y + bandh) > db->sizey) ? (db->sizey - y) : bandh;
+      dp_drawframe(db, snap);
+      if (img == NULL) continue;
+      for (int by = y; by < (y + db->bandh); by++) {
+        for (int x = 0; x < db->sizex; x++) {
+          if (db->bpp == 16) {
+            struct di_rgb c = di_getpixelrgb(db, x, by);
+            uint8_t * p = &img[((by * db->sizex) + x) * 3];
+            p[0] = c.r; p[1] = c.g; p[2] = c.b;
+          } else {
+            img[(by * db->sizex) + x] = (di_getpixelbw(db, x, by) != 0);
+          }
+        }
+      }
+    }
+    db->bandy = 0;
+    db->bandh = bandh;
+}
+
+/* Encodes img as binary PBM (lit pixels are white, as on the display)
+ * or PPM. Returns the size of the result in out. */
+static size_t encodeimg(const struct simdisplay * sd, const uint8_t * img, uint8_t * out)
+{
+    size_t len;
+    if (sd->bpp == 16) {
+      len = sprintf(out, "P6\n%d %d\n255\n", sd->sizex, sd->sizey);
+      memcpy(&out[len], img, sd->sizex * sd->sizey * 3);
+      return len + (sd->sizex * sd->sizey * 3);
+    }
+    len = sprintf(out, "P4\n%d %d\n", sd->sizex, sd->sizey);
+    int bpr = (sd->sizex + 7) / 8;
+    memset(&out[len], 0, bpr * sd->sizey);
+    for (int y = 0; y < sd->sizey; y++) {
+      for (int x = 0; x < sd->sizex; x++) {
+        if (img[(y * sd->sizex) + x] == 0) { /* PBM: 1 is black */
+          out[len + (y * bpr) + (x >> 3)] |= 0x80 >> (x & 7);
+        }
+      }
+    }
+    return len + (bpr * sd->sizey);
+}
+
+/* Returns 0 if fn contains exactly len bytes equal to data. */
+static int cmpfile(const char * fn, const uint8_t * data, size_t len)
+{
+    FILE * f = fopen(fn, "rb");
+    if (f == NULL) {
+      return -1;
+    }
+    uint8_t * ref = malloc(len + 1);
+    size_t rl = fread(ref, 1, len + 1, f);
+    fclose(f);
+    int res = ((rl != len) || (memcmp(ref, data, len) != 0));
+    free(ref);
+    return res;
+}
+
+static double nowus(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000.0) + (ts.tv_nsec / 1000.0);
+}
+
+static struct dispsnap wssnap;
+
+/* Bytes the SSD130x driver would send for db, see ssd130x_display. */
+static uint32_t ssd130xbytes(struct di_dispbuf * db, uint8_t * shadow)
+{
+    uint32_t sent = 4;
+    for (int page = 0; page < 8; page++) {
+      const uint8_t * np = &db->cont[page * 128];
+      uint8_t * op = &shadow[page * 128];
+      int c1 = 0; int c2 = 127;
+      while ((c1 <= c2) && (np[c1] == op[c1])) c1++;
+      while ((c2 >= c1) && (np[c2] == op[c2])) c2--;
+      if (c1 > c2) continue;
+      memcpy(&op[c1], &np[c1], c2 - c1 + 1);
+      sent += 9 + (c2 - c1 + 1);
+    }
+    return sent;
+}
+
+/* Sets up wssnap for frame number f of a simulation: Like the firmware
+ * does with all sensors connected, a new page every 10 s (one frame),
+ * and new, slowly changing values every 60 s. */
+static void simframe(int f)
+{
+    /* The pages the firmware shows with all sensors connected. */
+    static const int pages[] = { PAGE_TEMP, PAGE_HUM, PAGE_PRESS, PAGE_CO2,
+                                 PAGE_PM010, PAGE_PM100, PAGE_VOC, PAGE_NOX };
+    const int nrpages = sizeof(pages) / sizeof(pages[0]);
+    if ((f % 6) == 0) {
+      struct ev ev;
+      memset(&ev, 0, sizeof(ev));
+      float t = f / 360.0; /* in hours */
+      ev.temp = 21.0 + (2.0 * sinf(t / 4.0)) + (0.05 * sinf(f * 1.7));
+      ev.hum = 50.0 + (10.0 * sinf(t / 5.0)) + (0.3 * sinf(f * 2.3));
+      ev.press = 1010.0 + (5.0 * sinf(t / 20.0));
+      ev.co2 = 800 + (400 * (0.5 + (0.5 * sinf(t / 2.0))));
+      ev.pm010 = 4.0 + (3.0 * sinf(t / 3.0)) + sinf(f * 0.9);
+      ev.pm025 = 9.0 + (5.0 * sinf(t / 3.0));
+      ev.pm040 = 10.0 + (5.0 * sinf(t / 3.0));
+      ev.pm100 = 12.0 + (6.0 * sinf(t / 3.0)) + sinf(f * 1.3);
+      ev.vocidx = 100.0 + (50.0 * sinf(t / 1.5));
+      ev.noxidx = 1.0 + (5.0 * (0.5 + (0.5 * sinf(t / 2.5))));
+      dp_addvalues(&ev);
+      fillsnap(&wssnap, PAGE_TEMP, 1);
+      wssnap.ev = ev;
+    }
+    wssnap.page = pages[f % nrpages];
+    dp_gethist(wssnap.page, wssnap.hist);
+}
+
+/* Strategies against burn-in, for the wear simulation. */
+#define WS_NONE   0
+#define WS_INVERT 1 /* show everything inverted half of the time */
+#define WS_SHIFT  2 /* wearlevel.c */
+static const char * wsnames[] = { "nothing", "inverting", "shifting" };
+
+static uint32_t countlit(const struct di_dispbuf * db)
+{
+    uint32_t n = 0;
+    for (int i = 0; i < (db->sizex * ((db->sizey + 7) / 8)); i++) {
+      n += __builtin_popcount(db->cont[i]);
+    }
+    return n;
+}
+
+/* Returns the number of frames where wearlevel.c lost pixels. */
+static int simwear(int hours)
+{
+    int nrlost = 0;
+    printf("%d hours, new page every 10 s, new values every 60 s:\n", hours);
+    printf("%-10s %12s %8s %8s %10s\n", "strategy", "bytes/hour", "avg on", "max on",
+           "stddev/avg");
+    for (int ws = WS_NONE; ws <= WS_SHIFT; ws++) {
+      struct di_dispbuf * db = di_newdispbuf(128, 64, 1, 0);
+      uint8_t shadow[1024];
+      struct di_dispbuf * unshifted = di_newdispbuf(128, 64, 1, 0);
+      uint32_t * lit = calloc(128 * 64, sizeof(uint32_t));
+      struct wearlevel wl;
+      if ((db == NULL) || (unshifted == NULL) || (lit == NULL)
+       || (wl_init(&wl, 128, 64) != 0)) {
+        fprintf(stderr, "Out of memory.\n");
+        exit(2);
+      }
+      memset(shadow, 0, sizeof(shadow));
+      uint64_t bytes = 0;
+      uint8_t invertcounter = 0;
+      int nrframes = hours * 360;
+      for (int f = 0; f < nrframes; f++) {
+        int64_t nowms = (int64_t)f * 10000;
+        simframe(f);
+        /* The pages that draw up to the edges of the display: the
+         * firmware version and IP for a minute every 8 hours, like
+         * after a restart (but with the wear kept), and the error page
+         * for the last hour, like when all sensors failed. */
+        if ((f % 2880) < 6) {
+          wssnap.page = -1;
+        } else if (f >= (nrframes - 360)) {
+          wssnap.page = -100;
+        }
+        if (ws == WS_SHIFT) {
+          wl_drawframe(&wl, db, dp_drawframe, &wssnap, nowms);
+          dp_drawframe(unshifted, &wssnap);
+          if (countlit(db) < countlit(unshifted)) {
+            nrlost++;
+          }
+        } else {
+          dp_drawframe(db, &wssnap);
+          if ((ws == WS_INVERT) && (invertcounter >= 0x80)) {
+            di_invertall(db);
+          }
+          invertcounter++;
+        }
+        bytes += ssd130xbytes(db, shadow);
+        for (int i = 0; i < (128 * 64); i++) {
+          if (db->cont[((i / 128) >> 3) * 128 + (i % 128)] & (1U << ((i / 128) & 7))) {
+            lit[i] += 10;
+          }
+        }
+      }
+      double sum = 0.0; double sqsum = 0.0; uint32_t max = 0;
+      for (int i = 0; i < (128 * 64); i++) {
+        sum += lit[i];
+        sqsum += (double)lit[i] * lit[i];
+        if (lit[i] > max) max = lit[i];
+      }
+      double avg = sum / (128 * 64);
+      double sd = sqrt((sqsum / (128 * 64)) - (avg * avg));
+      double total = nrframes * 10.0;
+      printf("%-10s %12.0f %7.1f%% %7.1f%% %10.2f\n", wsnames[ws],
+             bytes / (double)hours, (100.0 * avg) / total, (100.0 * max) / total,
+             (avg > 0.0) ? (sd / avg) : 0.0);
+      free(wl.ontime);
+      free(lit);
+      di_freedispbuf(unshifted);
+      di_freedispbuf(db);
+    }
+    printf("Frames where shifting lost pixels: %d\n", nrlost);
+    return nrlost;
+}
+
+/* Simulates the 2.9 inch e-paper display for the given number of hours,
+ * with the scheduler and limits of the firmware (epdsched.c), and
+ * reports how often it was refreshed in which way. Like epaper.c, it
+ * compares every frame with what the panel shows, and a frame that
+ * could not be shown yet still counts as changed in the next one. */
+static void simepd(int hours)
+{
+    struct di_dispbuf * db = di_newdispbuf(128, 296, 1, 0);
+    uint8_t * panel = calloc(db->sizex, (db->sizey + 7) / 8);
+    if ((db == NULL) || (panel == NULL)) {
+      fprintf(stderr, "Out of memory.\n");
+      exit(2);
+    }
+    size_t bufsize = db->sizex * ((db->sizey + 7) / 8);
+    uint32_t totalpx = db->sizex * db->sizey;
+    struct epdsched es;
+    epdsched_init(&es, EPD_MININTERVAL_MS, EPD_MINFULL_MS, EPD_MAXFULL_MS,
+                  EPD_MAXPARTIALS);
+    uint32_t unchanged = 0;
+    int64_t lastfullms = -1;
+    int64_t mingapms = -1;
+    int64_t maxgapms = -1;
+    int nrframes = hours * 360;
+    for (int f = 0; f < nrframes; f++) {
+      int64_t nowms = (int64_t)f * 10000;
+      simframe(f);
+      dp_drawframe(db, &wssnap);
+      uint32_t changedpx = 0;
+      for (size_t i = 0; i < bufsize; i++) {
+        changedpx += __builtin_popcount(db->cont[i] ^ panel[i]);
+      }
+      int rt = epdsched_decide(&es, nowms, changedpx, totalpx);
+      if (rt == EPD_RT_NONE) {
+        if (changedpx == 0) {
+          unchanged++;
+        }
+        continue;
+      }
+      if (rt == EPD_RT_FULL) {
+        if (lastfullms >= 0) {
+          int64_t gap = nowms - lastfullms;
+          if ((mingapms < 0) || (gap < mingapms)) mingapms = gap;
+          if (gap > maxgapms) maxgapms = gap;
+        }
+        lastfullms = nowms;
+      }
+      memcpy(panel, db->cont, bufsize);
+      epdsched_done(&es, nowms, rt);
+      di_cleardirty(db);
+    }
+    printf("%d hours, new page every 10 s, new values every 60 s:\n", hours);
+    printf("%u frames: %u full refreshes, %u partial, %u deferred, %u unchanged\n",
+           nrframes, es.nrfull, es.nrpartial, es.nrdeferred, unchanged);
+    if (mingapms >= 0) {
+      printf("time between full refreshes: min %.0f s, max %.0f s (limits: %d s / %d s)\n",
+             mingapms / 1000.0, maxgapms / 1000.0,
+             EPD_MINFULL_MS / 1000, EPD_MAXFULL_MS / 1000);
+    }
+    free(panel);
+    di_freedispbuf(db);
+}
+
+/* Measures how fast di_drawtext is, for every font, on a monochrome and
+ * on a color buffer. The 38 pixel digits of the values are the worst
+ * case. */
+static void benchtext(int iterations)
+{
+    static const struct {
+      const char * name;
+      const struct font * fo;
+      const char * txt;
+    } fonts[] = {
+      { "terminus13norm", &font_terminus13norm, "Firmware compiled" },
+      { "terminus16bold", &font_terminus16bold, "Temperatur \xb0" "C" },
+      { "terminus38bold", &font_terminus38bold, "1234.5" },
+    };
+    static const struct simdisplay bdisps[] = {
+      { "mono128x64", 128, 64, 1, 0 },
+      { "color240x64", 240, 64, 16, 64 },
+    };
+    if (iterations < 1) {
+      iterations = 1;
+    }
+    printf("%-14s %-16s %12s %10s\n", "buffer", "font", "glyphs/s", "ns/glyph");
+    for (int d = 0; d < (sizeof(bdisps) / sizeof(bdisps[0])); d++) {
+      const struct simdisplay * sd = &bdisps[d];
+      struct di_dispbuf * db = di_newdispbuf(sd->sizex, sd->sizey, sd->bpp, sd->bandh);
+      if (db == NULL) {
+        fprintf(stderr, "Out of memory.\n");
+        exit(2);
+      }
+      for (int f = 0; f < (sizeof(fonts) / sizeof(fonts[0])); f++) {
+        const uint8_t * txt = (const uint8_t *)fonts[f].txt;
+        int nrglyphs = strlen(fonts[f].txt);
+        /* Enough rounds to take some time, and a few positions, so that
+         * the glyphs do not always start at the same bit in a byte. */
+        int rounds = iterations * 50;
+        double st = nowus();
+        for (int i = 0; i < rounds; i++) {
+          di_drawtext(db, i & 3, i & 7, fonts[f].fo, 0xff, 0xff, 0xff, txt);
+        }
+        double ns = ((nowus() - st) * 1000.0) / ((double)rounds * nrglyphs);
+        printf("%-14s %-16s %12.0f %10.1f\n", sd->name, fonts[f].name,
+               1.0e9 / ns, ns);
+      }
+      di_freedispbuf(db);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    const char * outdir = ".";
+    const char * refdir = NULL;
+    int iterations = 200;
+    int wearhours = 0;
+    int epdhours = 0;
+    int bench = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "o:c:n:w:e:b")) != -1) {
+      if (opt == 'o') {
+        outdir = optarg;
+      } else if (opt == 'c') {
+        refdir = optarg;
+      } else if (opt == 'n') {
+        iterations = atoi(optarg);
+      } else if (opt == 'w') {
+        wearhours = atoi(optarg);
+      } else if (opt == 'e') {
+        epdhours = atoi(optarg);
+      } else if (opt == 'b') {
+        bench = 1;
+      } else {
+        fprintf(stderr, "Syntax: %s [-o outdir] [-c refdir] [-n iterations] [-w hours] [-e hours] [-b]\n", argv[0]);
+        return 2;
+      }
+    }
+    if (wearhours > 0) {
+      return (simwear(wearhours) > 0) ? 1 : 0;
+    }
+    if (epdhours > 0) {
+      simepd(epdhours);
+      return 0;
+    }
+    if (bench) {
+      benchtext(iterations);
+      return 0;
+    }
+    fillhists();
+    int nrdiffs = 0;
+    for (int d = 0; d < (sizeof(simdisplays) / sizeof(simdisplays[0])); d++) {
+      const struct simdisplay * sd = &simdisplays[d];
+      struct di_dispbuf * db = di_newdispbuf(sd->sizex, sd->sizey, sd->bpp, sd->bandh);
+      uint8_t * img = malloc(sd->sizex * sd->sizey * 3);
+      uint8_t * enc = malloc((sd->sizex * sd->sizey * 3) + 32);
+      if ((db == NULL) || (img == NULL) || (enc == NULL)) {
+        fprintf(stderr, "Out of memory.\n");
+        return 2;
+      }
+      for (int p = 0; p < (sizeof(simpages) / sizeof(simpages[0])); p++) {
+        for (int valid = 1; valid >= 0; valid--) {
+          /* Pages < 0 look the same either way, except for the IP. */
+          if ((simpages[p] < 0) && (simpages[p] != -1) && !valid) continue;
+          struct dispsnap snap;
+          fillsnap(&snap, simpages[p], valid);
+          drawframe(db, &snap, img);
+          size_t len = encodeimg(sd, img, enc);
+          char fn[256];
+          snprintf(fn, sizeof(fn), "%s_page%d%s.%s", sd->name, simpages[p],
+                   (valid ? "" : "_invalid"), ((sd->bpp == 16) ? "ppm" : "pbm"));
+          char path[1024];
+          snprintf(path, sizeof(path), "%s/%s", outdir, fn);
+          FILE * f = fopen(path, "wb");
+          if ((f == NULL) || (fwrite(enc, 1, len, f) != len)) {
+            fprintf(stderr, "Failed to write %s\n", path);
+            return 2;
+          }
+          fclose(f);
+          const char * cmpres = "";
+          if (refdir != NULL) {
+            snprintf(path, sizeof(path), "%s/%s", refdir, fn);
+            int r = cmpfile(path, enc, len);
+            if (r != 0) {
+              nrdiffs++;
+            }
+            cmpres = (r < 0) ? "  MISSING" : ((r > 0) ? "  DIFFERS" : "  same");
+          }
+          double st = nowus();
+          for (int i = 0; i < iterations; i++) {
+            drawframe(db, &snap, NULL);
+          }
+          double us = (iterations > 0) ? ((nowus() - st) / iterations) : 0.0;
+          printf("%-40s %9.1f us/frame%s\n", fn, us, cmpres);
+        }
+      }
+      free(enc);
+      free(img);
+      di_freedispbuf(db);
+    }
+    if (refdir != NULL) {
+      printf("%d image(s) differ from %s\n", nrdiffs, refdir);
+    }
+    return (nrdiffs > 0) ? 1 : 0;
+}
@@ -0,0 +1,12 @@
+/* Host replacement for the ESP-IDF heap functions, for displaysim. */
+
+#ifndef _ESP_HEAP_CAPS_H_
+#define _ESP_HEAP_CAPS_H_
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA 0
+#define heap_caps_malloc(size, caps) malloc(size)
+#define heap_caps_calloc(n, size, caps) calloc(n, size)
+
+#endif /* _ESP_HEAP_CAPS_H_ */
@@ -0,0 +1,140 @@
+/* fbbench - compares drawing a 128x64 OLED frame with the old, unpacked
+ * display buffer (oldfb.c) and with the packed 1 bpp buffer of the
+ * firmware (displays.c), on the host.
+ * Both draw the same measurement screens the firmware used to show
+ * (label, 38 pixel value, unit, every second one inverted). "compose"
+ * is drawing the frame, "convert" is getting it into the page layout of
+ * the SSD130x controller, which the old buffer needed and the packed one
+ * is already in. It also checks that both produce exactly the same
+ * bytes for the display, and exits with 1 if they don't.
+ * Syntax: fbbench [-n iterations]
+ *   -n  draw every screen this many times for the timing (default 2000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "displays.h"
+#include "oldfb.h"
+
+/* Label, value and unit of the screens. ISO-8859-1, which the firmware
+ * also still takes, so both buffers get the same bytes. */
+static const char * screens[][3] = {
+    { "Temperatur", "21.4", "\xb0" "C" },
+    { "Luftfeuchte", "47.1", "%" },
+    { "CO2", "1234", "ppm" },
+    { "Feinstaub PM 2.5", "18.9", "\xb5" "g/m\xb3" },
+};
+#define NRSCREENS (sizeof(screens) / sizeof(screens[0]))
+
+static void composeold(struct oldfb * fb, int s, int inv)
+{
+    const uint8_t * label = (const uint8_t *)screens[s][0];
+    const uint8_t * value = (const uint8_t *)screens[s][1];
+    const uint8_t * unit = (const uint8_t *)screens[s][2];
+    oldfb_drawrect(fb, 0, 0, fb->sizex - 1, fb->sizey - 1, -1, 0x00, 0x00, 0x00);
+    int xpos = di_calctextcenter(&font_terminus16bold, 0, fb->sizex - 1, label);
+    oldfb_drawtext(fb, xpos, 0, &font_terminus16bold, 0xff, 0xff, 0xff, label);
+    int vwi = di_textwidth(&font_terminus38bold, value)
+            + di_textwidth(&font_terminus16bold, unit);
+    xpos = (fb->sizex - vwi) / 2;
+    if (xpos < 0) { xpos = 0; }
+    oldfb_drawtext(fb, xpos, 20, &font_terminus38bold, 0xff, 0xff, 0xff, value);
+    xpos += di_textwidth(&font_terminus38bold, value);
+    oldfb_drawtext(fb, xpos, 20, &font_terminus16bold, 0xff, 0xff, 0xff, unit);
+    if (inv) {
+      oldfb_invertall(fb);
+    }
+}
+
+static void composenew(struct di_dispbuf * db, int s, int inv)
+{
+    const uint8_t * label = (const uint8_t *)screens[s][0];
+    const uint8_t * value = (const uint8_t *)screens[s][1];
+    const uint8_t * unit = (const uint8_t *)screens[s][2];
+    di_clear(db, 0x00, 0x00, 0x00);
+    int xpos = di_calctextcenter(&font_terminus16bold, 0, db->sizex - 1, label);
+    di_drawtext(db, xpos, 0, &font_terminus16bold, 0xff, 0xff, 0xff, label);
+    int vwi = di_textwidth(&font_terminus38bold, value)
+            + di_textwidth(&font_terminus16bold, unit);
+    xpos = (db->sizex - vwi) / 2;
+    if (xpos < 0) { xpos = 0; }
+    di_drawtext(db, xpos, 20, &font_terminus38bold, 0xff, 0xff, 0xff, value);
+    xpos += di_textwidth(&font_terminus38bold, value);
+    di_drawtext(db, xpos, 20, &font_terminus16bold, 0xff, 0xff, 0xff, unit);
+    if (inv) {
+      di_invertall(db);
+    }
+}
+
+static double nowus(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000.0) + (ts.tv_nsec / 1000.0);
+}
+
+int main(int argc, char ** argv)
+{
+    int iterations = 2000;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+      if (opt == 'n') {
+        iterations = atoi(optarg);
+      } else {
+        fprintf(stderr, "Syntax: %s [-n iterations]\n", argv[0]);
+        return 2;
+      }
+    }
+    if (iterations < 1) {
+      iterations = 1;
+    }
+    struct oldfb * fb = oldfb_new(128, 64);
+    struct di_dispbuf * db = di_newdispbuf(128, 64, 1, 0);
+    uint8_t sendbuf[1024];
+    if ((fb == NULL) || (db == NULL)) {
+      fprintf(stderr, "Out of memory.\n");
+      return 2;
+    }
+    /* Same result? */
+    int nrdiffs = 0;
+    for (int s = 0; s < NRSCREENS; s++) {
+      for (int inv = 0; inv <= 1; inv++) {
+        composeold(fb, s, inv);
+        oldfb_ssd130xconvert(fb, sendbuf);
+        composenew(db, s, inv);
+        if (memcmp(sendbuf, db->cont, sizeof(sendbuf)) != 0) {
+          fprintf(stderr, "Screen \"%s\"%s differs.\n", screens[s][0],
+                  (inv ? " (inverted)" : ""));
+          nrdiffs++;
+        }
+      }
+    }
+    /* Timing. The screens are cycled, as on the device. */
+    double st = nowus();
+    for (int i = 0; i < iterations; i++) {
+      composeold(fb, i % NRSCREENS, (i / NRSCREENS) & 1);
+    }
+    double oldcompose = (nowus() - st) / iterations;
+    st = nowus();
+    for (int i = 0; i < iterations; i++) {
+      oldfb_ssd130xconvert(fb, sendbuf);
+    }
+    double oldconvert = (nowus() - st) / iterations;
+    st = nowus();
+    for (int i = 0; i < iterations; i++) {
+      composenew(db, i % NRSCREENS, (i / NRSCREENS) & 1);
+    }
+    double newcompose = (nowus() - st) / iterations;
+    printf("%-24s %10s %10s %10s\n", "128x64, us/frame", "compose", "convert", "buffer");
+    printf("%-24s %10.2f %10.2f %8d B\n", "1 byte per pixel (old)",
+           oldcompose, oldconvert, fb->sizex * fb->sizey);
+    printf("%-24s %10.2f %10.2f %8d B\n", "packed 1 bpp (displays.c)",
+           newcompose, 0.0, (int)db->contsize);
+    printf("%d of %d screens differ\n", nrdiffs, (int)(2 * NRSCREENS));
+    oldfb_free(fb);
+    di_freedispbuf(db);
+    return (nrdiffs > 0) ? 1 : 0;
+}
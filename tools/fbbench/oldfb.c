@@ -0,0 +1,142 @@
+/* The old, unpacked display buffer. See oldfb.h. */
+
+#include <stdlib.h>
+#include <string.h>
+#include "oldfb.h"
+
+struct oldfb * oldfb_new(int sizex, int sizey)
+{
+    struct oldfb * res = calloc(1, sizeof(struct oldfb));
+    if (res == NULL) {
+      return NULL;
+    }
+    res->cont = calloc(1, sizex * sizey);
+    if (res->cont == NULL) {
+      free(res);
+      return NULL;
+    }
+    res->sizex = sizex;
+    res->sizey = sizey;
+    return res;
+}
+
+void oldfb_free(struct oldfb * fb)
+{
+    if (fb == NULL) {
+      return;
+    }
+    free(fb->cont);
+    free(fb);
+}
+
+void oldfb_setpixel(struct oldfb * fb, int x, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+    if ((x < 0) || (y < 0)) return;
+    if ((x >= fb->sizex) || (y >= fb->sizey)) return;
+    uint8_t v = ((r >= 0x80) ? 0xff : 0x00)
+              | ((g >= 0x80) ? 0xff : 0x00)
+              | ((b >= 0x80) ? 0xff : 0x00);
+    fb->cont[(y * fb->sizex) + x] = v;
+}
+
+uint8_t oldfb_getpixelbw(struct oldfb * fb, int x, int y)
+{
+    if ((x < 0) || (y < 0)) return 0;
+    if ((x >= fb->sizex) || (y >= fb->sizey)) return 0;
+    return fb->cont[(y * fb->sizex) + x];
+}
+
+void oldfb_drawrect(struct oldfb * fb, int x1, int y1, int x2, int y2,
+                    int borderwidth, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (x1 > x2) { int t = x1; x1 = x2; x2 = t; }
+    if (y1 > y2) { int t = y1; y1 = y2; y2 = t; }
+    if ((borderwidth <= 0)
+     || (borderwidth > (x2 - x1)) || (borderwidth > (y2 - y1))) {
+      for (int y = y1; y <= y2; y++) {
+        for (int x = x1; x <= x2; x++) {
+          oldfb_setpixel(fb, x, y, r, g, b);
+        }
+      }
+      return;
+    }
+    for (int bd = 0; bd < borderwidth; bd++) {
+      for (int y = y1; y <= y2; y++) {
+        oldfb_setpixel(fb, x1 + bd, y, r, g, b);
+        oldfb_setpixel(fb, x2 - bd, y, r, g, b);
+      }
+      for (int x = x1; x <= x2; x++) {
+        oldfb_setpixel(fb, x, y1 + bd, r, g, b);
+        oldfb_setpixel(fb, x, y2 - bd, r, g, b);
+      }
+    }
+}
+
+void oldfb_invertall(struct oldfb * fb)
+{
+    int numb = fb->sizex * fb->sizey;
+    uint8_t * p = fb->cont;
+    for (int i = 0; i < numb; i++) {
+      *p ^= 0xff;
+      p++;
+    }
+}
+
+static const struct fontglyph * oldfb_findglyph(const struct font * fo, uint32_t c)
+{
+    for (int i = 0; i < fo->nrranges; i++) {
+      const struct fontrange * fr = &fo->ranges[i];
+      if ((c >= fr->first) && (c < (fr->first + fr->count))) {
+        return &fo->glyphs[fr->glyph + (c - fr->first)];
+      }
+    }
+    return NULL;
+}
+
+/* Like the old di_drawchar: unpack the glyph bit by bit, and set every
+ * pixel on its own. */
+static int oldfb_drawchar(struct oldfb * fb, int x, int y, const struct font * fo,
+                          uint8_t r, uint8_t g, uint8_t b, uint32_t c)
+{
+    const struct fontglyph * gl = oldfb_findglyph(fo, c);
+    if (gl == NULL) {
+      return 0;
+    }
+    const uint8_t * fdp = fo->data + gl->dataoff;
+    int bitnr = 0;
+    for (int yo = 0; yo < gl->h; yo++) {
+      for (int xo = 0; xo < gl->w; xo++) {
+        if (fdp[bitnr >> 3] & (0x80 >> (bitnr & 7))) {
+          oldfb_setpixel(fb, x + gl->xoff + xo, y + gl->yoff + yo, r, g, b);
+        }
+        bitnr++;
+      }
+    }
+    return gl->advance;
+}
+
+void oldfb_drawtext(struct oldfb * fb, int x, int y, const struct font * fo,
+                    uint8_t r, uint8_t g, uint8_t b, const uint8_t * txt)
+{
+    while (*txt != 0) {
+      x += oldfb_drawchar(fb, x, y, fo, r, g, b, *txt);
+      txt++;
+    }
+}
+
+void oldfb_ssd130xconvert(struct oldfb * fb, uint8_t * out)
+{
+    for (int page = 0; page < (fb->sizey / 8); page++) {
+      for (int col = 0; col < fb->sizex; col++) {
+        int rs = page * 8;
+        uint8_t b = 0;
+        for (int row = 0; row < 8; row++) {
+          uint8_t p = oldfb_getpixelbw(fb, col, (rs + row));
+          if (p > 0x80) {
+            b |= (1U << row);
+          }
+        }
+        out[(page * fb->sizex) + col] = b;
+      }
+    }
+}
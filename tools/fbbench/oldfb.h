@@ -0,0 +1,34 @@
+/* The display buffer as it was before displays.c packed it: one byte per
+ * pixel, every pixel drawn through a bounds checked setpixel, and
+ * converted bit by bit into the SSD130x page layout for sending. Only
+ * kept as the "before" for fbbench. */
+
+#ifndef _OLDFB_H_
+#define _OLDFB_H_
+
+#include <inttypes.h>
+#include "fonts/font.h"
+
+struct oldfb {
+  int sizex;
+  int sizey;
+  uint8_t * cont; /* sizex * sizey bytes, 0x00 or 0xff */
+};
+
+struct oldfb * oldfb_new(int sizex, int sizey);
+void oldfb_free(struct oldfb * fb);
+void oldfb_setpixel(struct oldfb * fb, int x, int y, uint8_t r, uint8_t g, uint8_t b);
+uint8_t oldfb_getpixelbw(struct oldfb * fb, int x, int y);
+void oldfb_drawrect(struct oldfb * fb, int x1, int y1, int x2, int y2,
+                    int borderwidth, uint8_t r, uint8_t g, uint8_t b);
+void oldfb_invertall(struct oldfb * fb);
+/* Texts are ISO-8859-1 here, one byte per character. */
+void oldfb_drawtext(struct oldfb * fb, int x, int y, const struct font * fo,
+                    uint8_t r, uint8_t g, uint8_t b, const uint8_t * txt);
+
+/* What ssd130x_display did before sending: rebuild the buffer in the
+ * display's page layout (see displays.h) into out, sizex * sizey / 8
+ * bytes. */
+void oldfb_ssd130xconvert(struct oldfb * fb, uint8_t * out);
+
+#endif /* _OLDFB_H_ */
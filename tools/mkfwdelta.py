@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+
+# Creates a delta update file for FoxESPTemp.
+# The delta describes the new firmware image as a sequence of ranges
+# copied from the old image (the one currently running on the ESP), and
+# literal data that is only contained in the new image. This is usually
+# much smaller than the full image, because most of the code does not
+# change between two builds.
+# The format is documented in espfw/main/ota.c. Name the output file
+# something.fxdelta, then either put it on a HTTPS server and give that URL
+# to the "Flash Firmware Update" form in the admin menu, or upload it
+# directly, e.g.
+#   curl -b authtoken=... --data-binary @x.fxdelta http://foxtempX/adminaction/uploaddelta
+# The ESP will refuse a delta that was not made against the firmware it is
+# currently running.
+
+import hashlib
+import struct
+import sys
+
+# Minimum length of a match that is worth a COPY command. A COPY is 9
+# bytes, so shorter matches are cheaper as part of an INSERT.
+MINMATCH = 16
+# Matches are searched through an index of the old image, using
+# MINMATCH-sized blocks at every BLOCKSTEP'th offset.
+BLOCKSTEP = 4
+
+CMD_COPY = 0x01
+CMD_INSERT = 0x02
+
+
+def makedelta(old, new):
+  index = {}
+  for o in range(0, len(old) - MINMATCH + 1, BLOCKSTEP):
+    index.setdefault(old[o:o + MINMATCH], o)
+  out = bytearray()
+  lit = bytearray()
+  ncopy = 0
+  nins = 0
+
+  def flushlit():
+    nonlocal nins
+    if len(lit) > 0:
+      out.extend(struct.pack("<BI", CMD_INSERT, len(lit)))
+      out.extend(lit)
+      nins += 1
+      lit.clear()
+
+  n = 0
+  nextold = -1  # where the last COPY ended in the old image
+  while n < len(new):
+    best = -1
+    bestlen = 0
+    # Code that did not change continues right where the last match ended,
+    # so try that first. Then look for the block in the index.
+    cands = []
+    if (nextold >= 0) and (nextold < len(old)):
+      cands.append(nextold)
+    o = index.get(new[n:n + MINMATCH])
+    if o is not None:
+      cands.append(o)
+    for c in cands:
+      l = 0
+      maxl = min(len(old) - c, len(new) - n)
+      # compare in large steps first, then bytewise
+      while (l + 256 <= maxl) and (old[c + l:c + l + 256] == new[n + l:n + l + 256]):
+        l += 256
+      while (l < maxl) and (old[c + l] == new[n + l]):
+        l += 1
+      if l > bestlen:
+        best = c
+        bestlen = l
+    if bestlen >= MINMATCH:
+      flushlit()
+      out.extend(struct.pack("<BII", CMD_COPY, best, bestlen))
+      ncopy += 1
+      n += bestlen
+      nextold = best + bestlen
+    else:
+      lit.append(new[n])
+      n += 1
+      if nextold >= 0:
+        nextold += 1
+  flushlit()
+  return out, ncopy, nins
+
+
+def main():
+  if len(sys.argv) != 4:
+    print("Syntax: %s <old firmware.bin> <new firmware.bin> <output.fxdelta>" % sys.argv[0])
+    sys.exit(1)
+  with open(sys.argv[1], "rb") as f:
+    old = f.read()
+  with open(sys.argv[2], "rb") as f:
+    new = f.read()
+  cmds, ncopy, nins = makedelta(old, new)
+  hdr = b"FXDP" + struct.pack("<B3xII", 1, len(old), len(new))
+  hdr += hashlib.sha256(old).digest() + hashlib.sha256(new).digest()
+  with open(sys.argv[3], "wb") as f:
+    f.write(hdr)
+    f.write(cmds)
+  total = len(hdr) + len(cmds)
+  print("%s: %d bytes (%.1f%% of the new image), %d COPY and %d INSERT commands"
+        % (sys.argv[3], total, (total * 100.0) / max(len(new), 1), ncopy, nins))
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,165 @@
+/* sensiriontest - tests the shared Sensirion command layer (sensirion.c)
+ * on the host, with the I2C driver replaced by a fake sensor.
+ * It checks the CRC against the example from the datasheets and against
+ * a plain bit by bit implementation for all 65536 words, that commands
+ * and their arguments are encoded as the datasheets show, and that
+ * replies are decoded, with bad CRCs and I2C errors detected and
+ * counted.
+ * Exits with 1 if any check failed.
+ * Syntax: sensiriontest
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <driver/i2c_master.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "i2c.h"
+#include "sensirion.h"
+#include "settings.h"
+
+/* What the firmware has elsewhere */
+struct globalsettings settings;
+i2c_master_bus_handle_t i2c_bushandles[2];
+
+uint32_t i2c_settingtoi2cclock(uint8_t s)
+{
+    return 100000;
+}
+
+const char * esp_err_to_name(esp_err_t code)
+{
+    return "error";
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+}
+
+/* The fake sensor: It remembers what was sent to it last, and replies
+ * with whatever is in reply. */
+static uint8_t sent[64];
+static size_t sentlen;
+static uint8_t reply[64];
+static esp_err_t replyerr = ESP_OK;
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus,
+                                    const i2c_device_config_t * dc,
+                                    i2c_master_dev_handle_t * dev)
+{
+    *dev = NULL;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t * buf,
+                              size_t len, int timeoutms)
+{
+    memcpy(sent, buf, len);
+    sentlen = len;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_receive(i2c_master_dev_handle_t dev, uint8_t * buf,
+                             size_t len, int timeoutms)
+{
+    if (replyerr != ESP_OK) {
+      return replyerr;
+    }
+    memcpy(buf, reply, len);
+    return ESP_OK;
+}
+
+static int nrfails = 0;
+
+static void check(int ok, const char * what)
+{
+    if (!ok) {
+      printf("FAIL: %s\n", what);
+      nrfails++;
+    }
+}
+
+/* CRC-8 with polynomial 0x31 and start value 0xff, bit by bit. */
+static uint8_t refcrc(const uint8_t * data, size_t len)
+{
+    uint8_t crc = 0xff;
+    for (size_t i = 0; i < len; i++) {
+      crc ^= data[i];
+      for (int b = 0; b < 8; b++) {
+        crc = (crc & 0x80) ? ((crc << 1) ^ 0x31) : (crc << 1);
+      }
+    }
+    return crc;
+}
+
+int main(int argc, char ** argv)
+{
+    /* CRC */
+    const uint8_t beef[2] = { 0xbe, 0xef };
+    check(sensirion_crc(beef, 2) == 0x92, "CRC of 0xBEEF is not 0x92");
+    int crcdiffs = 0;
+    for (uint32_t w = 0; w <= 0xffff; w++) {
+      uint8_t d[2] = { w >> 8, w & 0xff };
+      if (sensirion_crc(d, 2) != refcrc(d, 2)) {
+        crcdiffs++;
+      }
+    }
+    check(crcdiffs == 0, "CRC differs from the bitwise reference");
+
+    /* Setting up devices */
+    struct sensirion_dev sgp40;
+    struct sensirion_dev sht4x;
+    uint8_t port = 1;
+    settings.i2c_n_scl[0] = 0; /* port 1 disabled */
+    check((sensirion_init(&sgp40, "SGP40", 2, &port, 0x59) != 0) && (port == 0),
+          "sensor on a disabled port was not disabled");
+    settings.i2c_n_scl[0] = 23;
+    settings.i2c_n_sda[0] = 24;
+    port = 1;
+    check(sensirion_init(&sgp40, "SGP40", 2, &port, 0x59) == 0, "sensirion_init for SGP40 failed");
+    port = 1;
+    check(sensirion_init(&sht4x, "SHT4x", 1, &port, 0x44) == 0, "sensirion_init for SHT4x failed");
+    check(sensirion_getnrdevs() == 2, "sensirion_getnrdevs is not 2");
+
+    /* Commands. The SGP40 "measure raw" with the default humidity and
+     * temperature is the example from its datasheet. */
+    const uint16_t sgpargs[2] = { 0x8000, 0x6666 };
+    const uint8_t sgpexp[8] = { 0x26, 0x0f, 0x80, 0x00, 0xa2, 0x66, 0x66, 0x93 };
+    check((sensirion_sendcmd(&sgp40, 0x260f, sgpargs, 2) == ESP_OK)
+       && (sentlen == 8) && (memcmp(sent, sgpexp, 8) == 0),
+          "SGP40 measure raw command is not encoded as in the datasheet");
+    check((sensirion_sendcmd(&sht4x, 0xfd, NULL, 0) == ESP_OK)
+       && (sentlen == 1) && (sent[0] == 0xfd),
+          "1 byte command is not sent as 1 byte");
+    const uint16_t manyargs[3] = { 1, 2, 3 };
+    check(sensirion_sendcmd(&sgp40, 0x1234, manyargs, 3) == ESP_ERR_INVALID_ARG,
+          "too many arguments are not rejected");
+
+    /* Replies */
+    uint16_t words[16];
+    const uint8_t goodreply[6] = { 0x12, 0x34, 0x37, 0xbe, 0xef, 0x92 };
+    memcpy(reply, goodreply, 6);
+    check((sensirion_readwords(&sht4x, words, 2) == ESP_OK)
+       && (words[0] == 0x1234) && (words[1] == 0xbeef) && (sht4x.nrreads == 1),
+          "reply is not decoded correctly");
+    reply[5] ^= 0x01; /* bad CRC in the second word */
+    words[1] = 0;
+    check((sensirion_readwords(&sht4x, words, 2) == ESP_ERR_INVALID_CRC)
+       && (sht4x.crcerrors == 1) && (sht4x.nrreads == 1),
+          "bad CRC is not detected and counted");
+    replyerr = ESP_ERR_TIMEOUT;
+    check((sensirion_readwords(&sht4x, words, 2) == ESP_ERR_TIMEOUT)
+       && (sht4x.i2cerrors == 1) && (sht4x.crcerrors == 1),
+          "I2C error is not passed on and counted");
+    replyerr = ESP_OK;
+    check(sensirion_readwords(&sht4x, words, 17) == ESP_ERR_INVALID_ARG,
+          "reading more words than fit into the buffer is not rejected");
+    memcpy(reply, goodreply, 6);
+    check((sensirion_cmdread(&sgp40, 0x3682, 1, words, 2) == ESP_OK)
+       && (sentlen == 2) && (sent[0] == 0x36) && (sent[1] == 0x82)
+       && (words[0] == 0x1234) && (words[1] == 0xbeef),
+          "sensirion_cmdread does not send the command and decode the reply");
+
+    printf("%d check(s) failed\n", nrfails);
+    return (nrfails > 0) ? 1 : 0;
+}
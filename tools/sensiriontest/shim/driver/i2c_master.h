@@ -0,0 +1,30 @@
+/* Host replacement for the ESP-IDF I2C master driver, for sensiriontest.
+ * The functions are implemented by the test, which plays the sensor. */
+
+#ifndef _I2C_MASTER_H_
+#define _I2C_MASTER_H_
+
+#include <inttypes.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+typedef struct i2cbus * i2c_master_bus_handle_t;
+typedef struct i2cdev * i2c_master_dev_handle_t;
+
+#define I2C_ADDR_BIT_LEN_7 0
+
+typedef struct {
+  int dev_addr_length;
+  uint16_t device_address;
+  uint32_t scl_speed_hz;
+} i2c_device_config_t;
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus,
+                                    const i2c_device_config_t * dc,
+                                    i2c_master_dev_handle_t * dev);
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t * buf,
+                              size_t len, int timeoutms);
+esp_err_t i2c_master_receive(i2c_master_dev_handle_t dev, uint8_t * buf,
+                             size_t len, int timeoutms);
+
+#endif /* _I2C_MASTER_H_ */
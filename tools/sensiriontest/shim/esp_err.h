@@ -0,0 +1,16 @@
+/* Host replacement for the ESP-IDF error codes, for sensiriontest. */
+
+#ifndef _ESP_ERR_H_
+#define _ESP_ERR_H_
+
+typedef int esp_err_t;
+
+#define ESP_OK                 0
+#define ESP_FAIL              -1
+#define ESP_ERR_INVALID_ARG    0x102
+#define ESP_ERR_TIMEOUT        0x107
+#define ESP_ERR_INVALID_CRC    0x109
+
+const char * esp_err_to_name(esp_err_t code);
+
+#endif /* _ESP_ERR_H_ */
@@ -0,0 +1,11 @@
+/* Host replacement for FreeRTOS, for sensiriontest. */
+
+#ifndef _FREERTOS_H_
+#define _FREERTOS_H_
+
+#include <inttypes.h>
+
+typedef uint32_t TickType_t;
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#endif /* _FREERTOS_H_ */
@@ -0,0 +1,10 @@
+/* Host replacement for FreeRTOS tasks, for sensiriontest. */
+
+#ifndef _TASK_H_
+#define _TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+void vTaskDelay(TickType_t ticks);
+
+#endif /* _TASK_H_ */
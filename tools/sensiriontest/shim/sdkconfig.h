@@ -0,0 +1 @@
+/* Host replacement for the generated sdkconfig.h, for sensiriontest. */
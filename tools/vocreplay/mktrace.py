@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Writes a synthetic SGP40 trace for vocreplay to stdout: 8 hours at
+# 1 Hz of a steady raw value with some noise, and 10 minutes of more
+# VOCs (a lower raw value) after 6 hours, e.g. someone cooking.
+# This is what synthetic8h.txt was made from, see the Makefile
+# for how the expected index was added.
+
+import random
+
+SAMPLES = 8 * 3600
+EVENTSTART = 6 * 3600
+EVENTLEN = 600
+
+random.seed(2)
+print("# Synthetic SGP40 trace, made by mktrace.py: raw value, and the VOC")
+print("# index vocindex.c calculated for it when this file was made.")
+for i in range(SAMPLES):
+    sraw = 30000 + random.gauss(0, 30)
+    if EVENTSTART <= i < EVENTSTART + EVENTLEN:
+        sraw -= 1500
+    print(int(sraw))
@@ -0,0 +1,113 @@
+/* vocreplay - runs recorded SGP40 raw values through the VOC index
+ * algorithm of the firmware (vocindex.c) on the host.
+ * The input has one sample per line, recorded at 1 Hz: the raw value,
+ * optionally followed by the VOC index a reference implementation
+ * calculated for it. Empty lines and lines starting with # are ignored.
+ * Without reference values, it just prints the index for every sample,
+ * with them, it counts the samples where we differ by more than the
+ * tolerance, and exits with 1 if there are any.
+ * In both cases, it reports how long the calculation took per sample -
+ * that is on the host of course, the firmware shows its own numbers
+ * on /debug.
+ * With -r, it instead writes the trace with its own index as the
+ * reference, to record the expected output after an intended change
+ * (see the Makefile).
+ * Syntax: vocreplay [-q] [-r] [-t tolerance] [tracefile]
+ *   -q  don't print the index for every sample
+ *   -r  write the trace with our index as reference
+ *   -t  allowed difference to the reference (default 0)
+ * The trace is read from stdin if no file is given.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "vocindex.h"
+
+static double nowus(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1e6) + (ts.tv_nsec / 1e3);
+}
+
+int main(int argc, char ** argv)
+{
+    int quiet = 0;
+    int writeref = 0;
+    int tolerance = 0;
+    int c;
+    while ((c = getopt(argc, argv, "qrt:")) != -1) {
+      switch (c) {
+      case 'q': quiet = 1; break;
+      case 'r': writeref = 1; break;
+      case 't': tolerance = atoi(optarg); break;
+      default:
+        fprintf(stderr, "Syntax: %s [-q] [-r] [-t tolerance] [tracefile]\n", argv[0]);
+        return 2;
+      }
+    }
+    FILE * f = stdin;
+    if (optind < argc) {
+      f = fopen(argv[optind], "r");
+      if (f == NULL) {
+        perror(argv[optind]);
+        return 2;
+      }
+    }
+    struct vocindex vi;
+    vi_init(&vi);
+    char line[200];
+    long nrsamples = 0, nrref = 0, nrdiff = 0;
+    int maxdiff = 0;
+    double totalus = 0.0, maxus = 0.0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+      unsigned int sraw;
+      int ref;
+      int n = sscanf(line, "%u %d", &sraw, &ref);
+      if ((line[0] == '#') || (n < 1)) {
+        if (writeref) {
+          fputs(line, stdout);
+        }
+        continue;
+      }
+      double st = nowus();
+      int idx = vi_process(&vi, sraw);
+      double us = nowus() - st;
+      totalus += us;
+      if (us > maxus) {
+        maxus = us;
+      }
+      if (writeref) {
+        printf("%u %d\n", sraw, idx);
+      } else if (n >= 2) {
+        int d = abs(idx - ref);
+        nrref++;
+        if (d > maxdiff) {
+          maxdiff = d;
+        }
+        if (d > tolerance) {
+          nrdiff++;
+          if (!quiet) {
+            printf("%ld: sraw %u: index %d, reference %d\n", nrsamples, sraw, idx, ref);
+          }
+        }
+      } else if (!quiet) {
+        printf("%ld: sraw %u: index %d\n", nrsamples, sraw, idx);
+      }
+      nrsamples++;
+    }
+    if (f != stdin) {
+      fclose(f);
+    }
+    /* With -r, stdout is the new trace. */
+    FILE * sf = (writeref) ? stderr : stdout;
+    fprintf(sf, "%ld samples, %.3f us per sample on average, %.3f us max.\n",
+            nrsamples, (nrsamples > 0) ? (totalus / nrsamples) : 0.0, maxus);
+    if (nrref > 0) {
+      fprintf(sf, "%ld of %ld differ from the reference by more than %d, by up to %d.\n",
+              nrdiff, nrref, tolerance, maxdiff);
+    }
+    return (nrdiff > 0) ? 1 : 0;
+}
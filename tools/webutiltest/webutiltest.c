@@ -0,0 +1,440 @@
+/* webutiltest - tests and benchmarks the webserver helpers in webutil.c
+ * on the host.
+ * It feeds unescapeuestring() random and deliberately malformed input
+ * (lots of '%', truncated "%X" at the end, non-hex digits, high bytes),
+ * and checks that it never reads past the terminating \0 (every input
+ * ends right before a page that is not accessible, so that crashes),
+ * that the result is never longer than the input, and that it matches a
+ * simple reference decoder. The results are then run through
+ * htmlescape(), which must not let any raw <>&"' through, and whose
+ * output must decode back to its input.
+ * The CBOR encoder is checked by decoding what it wrote: integers at
+ * every boundary between encoding sizes, floats including infinities,
+ * -0 and subnormals, NaN as null, and a whole /cbor snapshot. The size
+ * of that snapshot is compared with the same values as /json.
+ * Finally it compares the speed of unescapeuestring() with that of the
+ * strncmp based decoder it replaced.
+ * Exits with 1 if any check failed.
+ * Syntax: webutiltest [-n iterations] [-s seed]
+ *   -n  number of random inputs to check (default 200000)
+ *   -s  seed for the random inputs (default 1)
+ */
+
+#include <ctype.h>
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#include "submit.h"
+#include "webserver.h"
+#include "webutil.h"
+
+#define MAXLEN 300
+
+static uint32_t rngstate;
+
+static uint32_t rnd(void)
+{
+    /* xorshift32 - good enough, and the same on every platform */
+    rngstate ^= rngstate << 13;
+    rngstate ^= rngstate >> 17;
+    rngstate ^= rngstate << 5;
+    return rngstate;
+}
+
+/* A random input, mostly built from the things a decoder might trip
+ * over. */
+static size_t randominput(uint8_t * s, size_t maxlen)
+{
+    static const char * pieces[] = {
+      "%", "%%", "%4", "%41", "%4g", "%g4", "%zz", "%2B", "%2b", "%00",
+      "%ff", "%FF", "%3C", "%3e", "%22", "%27", "%26", "+", "++", "&",
+      "=", "a", "Z", "0", "<", ">", "\"", "'", "&amp;", "\xc3\xa4", "\xff",
+    };
+    size_t len = rnd() % (maxlen + 1);
+    size_t pos = 0;
+    while (pos < len) {
+      if ((rnd() & 3) == 0) { /* any byte except \0 */
+        s[pos++] = (rnd() % 255) + 1;
+        continue;
+      }
+      const char * p = pieces[rnd() % (sizeof(pieces) / sizeof(pieces[0]))];
+      size_t pl = strlen(p);
+      if ((pos + pl) > len) {
+        pl = len - pos; /* cut off, e.g. "%4" at the very end */
+      }
+      memcpy(&s[pos], p, pl);
+      pos += pl;
+    }
+    s[len] = 0;
+    /* The first \0 is the end, random bytes contain none. */
+    return len;
+}
+
+/* Straightforward reference decoder. */
+static void refdecode(const uint8_t * in, uint8_t * out)
+{
+    size_t o = 0;
+    size_t len = strlen(in);
+    for (size_t i = 0; i < len; i++) {
+      if (in[i] == '+') {
+        out[o++] = ' ';
+      } else if ((in[i] == '%') && ((i + 2) < len)
+              && isxdigit(in[i + 1]) && isxdigit(in[i + 2])) {
+        char hex[3] = { in[i + 1], in[i + 2], 0 };
+        out[o++] = strtol(hex, NULL, 16);
+        i += 2;
+      } else {
+        out[o++] = in[i];
+      }
+    }
+    out[o] = 0;
+}
+
+struct escbuf {
+  uint8_t buf[(MAXLEN * 6) + 1];
+  size_t len;
+};
+
+static void escout(void * ctx, const uint8_t * d, size_t len)
+{
+    struct escbuf * eb = ctx;
+    memcpy(&eb->buf[eb->len], d, len);
+    eb->len += len;
+}
+
+/* Checks the output of htmlescape for in. Returns 0 if it is fine. */
+static int checkescape(const uint8_t * in, size_t inlen)
+{
+    static const char * ents[] = { "&amp;", "&lt;", "&gt;", "&quot;", "&#39;" };
+    static const char entchars[] = "&<>\"'";
+    struct escbuf eb;
+    eb.len = 0;
+    htmlescape(in, escout, &eb);
+    /* Decode it again, everything must be either a plain character or
+     * one of our entities. */
+    size_t o = 0;
+    for (size_t i = 0; i < eb.len; ) {
+      uint8_t c = eb.buf[i];
+      if ((c == '<') || (c == '>') || (c == '"') || (c == '\'') || (c == 0)) {
+        return 1;
+      }
+      if (c == '&') {
+        int e;
+        for (e = 0; e < 5; e++) {
+          size_t el = strlen(ents[e]);
+          if (((i + el) <= eb.len) && (memcmp(&eb.buf[i], ents[e], el) == 0)) {
+            break;
+          }
+        }
+        if (e >= 5) {
+          return 1;
+        }
+        c = entchars[e];
+        i += strlen(ents[e]);
+      } else {
+        i++;
+      }
+      if ((o >= inlen) || (in[o] != c)) {
+        return 1;
+      }
+      o++;
+    }
+    return (o != inlen);
+}
+
+/* The decoder unescapeuestring() replaced, for comparison. */
+static void oldunescape(uint8_t * s)
+{
+    static const struct { const char * e; char c; } escs[] = {
+      { "&amp;", '&' }, { "%20", ' ' }, { "%21", '!' }, { "%23", '#' },
+      { "%24", '$' }, { "%25", '%' }, { "%26", '&' }, { "%28", '(' },
+      { "%29", ')' }, { "%2A", '*' }, { "%2B", '+' }, { "%2C", ',' },
+      { "%2D", '-' }, { "%2E", '.' }, { "%2F", '/' }, { "%3A", ':' },
+      { "%3B", ';' }, { "%3D", '=' }, { "%3F", '?' }, { "%40", '@' },
+      { "%5B", '[' }, { "%5D", ']' }, { "%5E", '^' }, { "%5F", '_' },
+      { "%7E", '~' },
+    };
+    uint8_t * rp = s;
+    uint8_t * wp = s;
+    while (*rp != 0) {
+      int i;
+      if (strncmp(rp, "+", 1) == 0) {
+        *wp = ' '; wp++; rp++;
+        continue;
+      }
+      for (i = 0; i < (sizeof(escs) / sizeof(escs[0])); i++) {
+        size_t el = strlen(escs[i].e);
+        if (strncmp(rp, escs[i].e, el) == 0) {
+          *wp = escs[i].c; rp += el; wp += 1;
+          break;
+        }
+      }
+      if (i >= (sizeof(escs) / sizeof(escs[0]))) {
+        *wp = *rp; wp++; rp++;
+      }
+    }
+    *wp = 0;
+}
+
+/* A minimal CBOR decoder, just for what cbor_* write. Decodes the item
+ * at *p, advances *p past it, and returns its type: 'i' for integers
+ * (value in *iv), 'f' for single precision floats (*fv), 'n' for null,
+ * 'm' for a map head (number of pairs in *iv), 0 for anything else. */
+static int cbordecode(const uint8_t ** p, int64_t * iv, float * fv)
+{
+    uint8_t ib = *(*p)++;
+    uint8_t major = ib >> 5;
+    uint8_t ai = ib & 0x1f;
+    if (ib == 0xf6) {
+      return 'n';
+    }
+    if (ib == 0xfa) {
+      uint32_t u = 0;
+      for (int i = 0; i < 4; i++) {
+        u = (u << 8) | *(*p)++;
+      }
+      memcpy(fv, &u, sizeof(u));
+      return 'f';
+    }
+    if ((major != 0) && (major != 1) && (major != 5)) {
+      return 0;
+    }
+    uint64_t val = ai;
+    int n = 0;
+    if (ai == 24) { n = 1; } else if (ai == 25) { n = 2; }
+    else if (ai == 26) { n = 4; } else if (ai == 27) { n = 8; }
+    else if (ai > 27) { return 0; }
+    if (n > 0) {
+      val = 0;
+      for (int i = 0; i < n; i++) {
+        val = (val << 8) | *(*p)++;
+      }
+    }
+    if (major == 5) {
+      *iv = val;
+      return 'm';
+    }
+    *iv = (major == 1) ? (int64_t)(-1 - (int64_t)val) : (int64_t)val;
+    if ((major == 0) && (val > INT64_MAX)) {
+      return 0;
+    }
+    return 'i';
+}
+
+/* The size cbor_putint must use for val: the shortest form. */
+static int cborintsize(int64_t val)
+{
+    uint64_t a = (val < 0) ? (uint64_t)(-1 - val) : (uint64_t)val;
+    if (a < 24) return 1;
+    if (a <= 0xff) return 2;
+    if (a <= 0xffff) return 3;
+    if (a <= 0xffffffffULL) return 5;
+    return 9;
+}
+
+/* Round trip tests for the CBOR encoder. Returns the number of
+ * failures. */
+static int checkcbor(void)
+{
+    static const int64_t ints[] = {
+      0, 1, 23, 24, 25, 255, 256, 65535, 65536, 0xffffffffLL, 0x100000000LL,
+      INT64_MAX, -1, -24, -25, -256, -257, -65536, -65537, -0x100000000LL,
+      -0x100000001LL, INT64_MIN,
+    };
+    /* A few encodings straight from RFC 8949, appendix A */
+    static const struct { int64_t v; int len; const char * enc; } rfcints[] = {
+      { 23, 1, "\x17" }, { 24, 2, "\x18\x18" }, { 100, 2, "\x18\x64" },
+      { 1000, 3, "\x19\x03\xe8" }, { 1000000, 5, "\x1a\x00\x0f\x42\x40" },
+      { -1, 1, "\x20" }, { -100, 2, "\x38\x63" }, { -1000, 3, "\x39\x03\xe7" },
+    };
+    const float floats[] = {
+      0.0f, -0.0f, 1.0f, 21.37f, -40.5f, 1013.25f, 1e-40f /* subnormal */,
+      FLT_MAX, -FLT_MAX, INFINITY, -INFINITY,
+    };
+    int fails = 0;
+    uint8_t buf[CBORS_MAXSIZE];
+    int64_t iv;
+    float fv;
+    for (int i = 0; i < (sizeof(ints) / sizeof(ints[0])); i++) {
+      int n = cbor_putint(buf, ints[i]);
+      const uint8_t * p = buf;
+      int t = cbordecode(&p, &iv, &fv);
+      if ((n != cborintsize(ints[i])) || ((p - buf) != n) || (t != 'i') || (iv != ints[i])) {
+        printf("FAIL: CBOR integer %" PRId64 " (%d bytes)\n", ints[i], n);
+        fails++;
+      }
+    }
+    for (int i = 0; i < (sizeof(rfcints) / sizeof(rfcints[0])); i++) {
+      int n = cbor_putint(buf, rfcints[i].v);
+      if ((n != rfcints[i].len) || (memcmp(buf, rfcints[i].enc, n) != 0)) {
+        printf("FAIL: CBOR integer %" PRId64 " differs from RFC 8949\n", rfcints[i].v);
+        fails++;
+      }
+    }
+    for (int i = 0; i < (sizeof(floats) / sizeof(floats[0])); i++) {
+      int n = cbor_putfloat(buf, floats[i]);
+      const uint8_t * p = buf;
+      int t = cbordecode(&p, &iv, &fv);
+      if ((n != 5) || (t != 'f') || (memcmp(&fv, &floats[i], sizeof(float)) != 0)) {
+        printf("FAIL: CBOR float %g\n", floats[i]);
+        fails++;
+      }
+    }
+    if ((cbor_putfloat(buf, NAN) != 1) || (buf[0] != 0xf6)) {
+      printf("FAIL: CBOR float NaN is not null\n");
+      fails++;
+    }
+    /* A whole snapshot, with everything enabled, and some values that
+     * could not be read. */
+    struct ev ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.lastupd = 1760000000; ev.lastsht4xheat = 1759999000;
+    ev.temp = NAN; ev.hum = 47.11; ev.press = 1013.25; ev.raing = 0.0;
+    ev.pm010 = 3.4; ev.pm025 = 18.9; ev.pm040 = 55.5; ev.pm100 = NAN;
+    ev.vocidx = 87.0; ev.noxidx = 1.0; ev.co2 = 0xffff;
+    const struct { int64_t key; char type; int64_t iv; float fv; } exp[] = {
+      { CBORK_LASTSHT4XHEAT, 'i', 1759999000, 0 },
+      { ST_TEMPERATURE, 'n', 0, 0 }, { ST_HUMIDITY, 'f', 0, 47.11f },
+      { ST_PM010, 'f', 0, 3.4f }, { ST_PM025, 'f', 0, 18.9f },
+      { ST_PM040, 'f', 0, 55.5f }, { ST_PM100, 'n', 0, 0 },
+      { ST_PRESSURE, 'f', 0, 1013.25f }, { ST_RAINGAUGE, 'f', 0, 0.0f },
+      { ST_CO2, 'n', 0, 0 }, { ST_VOCINDEX, 'f', 0, 87.0f },
+      { ST_NOXINDEX, 'f', 0, 1.0f }, { CBORK_TS, 'i', 1760000000, 0 },
+    };
+    const int nrexp = sizeof(exp) / sizeof(exp[0]);
+    size_t len = cbor_putsnapshot(buf, &ev, 0xff);
+    const uint8_t * p = buf;
+    int snapfail = (len > CBORS_MAXSIZE) || (cbordecode(&p, &iv, &fv) != 'm') || (iv != nrexp);
+    for (int i = 0; (i < nrexp) && !snapfail; i++) {
+      if ((cbordecode(&p, &iv, &fv) != 'i') || (iv != exp[i].key)) {
+        snapfail = 1;
+        break;
+      }
+      int t = cbordecode(&p, &iv, &fv);
+      snapfail = (t != exp[i].type)
+              || ((t == 'i') && (iv != exp[i].iv))
+              || ((t == 'f') && (fv != exp[i].fv));
+    }
+    if (snapfail || ((p - buf) != len)) {
+      printf("FAIL: CBOR snapshot does not decode to what was put in\n");
+      fails++;
+    }
+    /* How much smaller is it than /json? Same snapshot with all values
+     * valid, in the format get_json_handler() uses. */
+    ev.temp = 21.37; ev.pm100 = 9.9; ev.co2 = 1234;
+    uint8_t json[600];
+    int jlen = snprintf(json, sizeof(json), "{\"lastsht4xheat\":\"%lld\","
+        "\"temp\":\"%.2f\",\"hum\":\"%.1f\",\"pm010\":\"%.1f\",\"pm025\":\"%.1f\","
+        "\"pm040\":\"%.1f\",\"pm100\":\"%.1f\",\"press\":\"%.3f\",\"raing\":\"%.2f\","
+        "\"co2\":\"%u\",\"vocidx\":\"%.0f\",\"noxidx\":\"%.0f\",\"ts\":\"%lld\"}",
+        (long long)ev.lastsht4xheat, ev.temp, ev.hum, ev.pm010, ev.pm025, ev.pm040,
+        ev.pm100, ev.press, ev.raing, ev.co2, ev.vocidx, ev.noxidx, (long long)ev.lastupd);
+    size_t clen = cbor_putsnapshot(buf, &ev, 0xff);
+    printf("CBOR round trip: %d failed. Snapshot with all sensors: JSON %d bytes, CBOR %zu bytes\n",
+           fails, jlen, clen);
+    return fails;
+}
+
+static double nowus(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000.0) + (ts.tv_nsec / 1000.0);
+}
+
+/* Time per input byte of decoder fn on input in, in ns. */
+static double benchdecoder(void (* fn)(uint8_t *), const char * in)
+{
+    uint8_t buf[MAXLEN + 1];
+    size_t len = strlen(in);
+    int rounds = 20000;
+    double st = nowus();
+    for (int i = 0; i < rounds; i++) {
+      memcpy(buf, in, len + 1);
+      fn(buf);
+    }
+    return ((nowus() - st) * 1000.0) / ((double)rounds * len);
+}
+
+int main(int argc, char ** argv)
+{
+    long iterations = 200000;
+    uint32_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+      if (opt == 'n') {
+        iterations = atol(optarg);
+      } else if (opt == 's') {
+        seed = strtoul(optarg, NULL, 0);
+      } else {
+        fprintf(stderr, "Syntax: %s [-n iterations] [-s seed]\n", argv[0]);
+        return 2;
+      }
+    }
+    rngstate = (seed != 0) ? seed : 1;
+    /* Two pages, the second one inaccessible: Inputs are put at the end
+     * of the first one, so reading past their \0 crashes. */
+    long pagesize = sysconf(_SC_PAGESIZE);
+    uint8_t * pages = mmap(NULL, 2 * pagesize, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((pages == MAP_FAILED) || (pagesize < (MAXLEN + 1))
+     || (mprotect(pages + pagesize, pagesize, PROT_NONE) != 0)) {
+      fprintf(stderr, "Failed to set up guard page.\n");
+      return 2;
+    }
+    long nrfails = 0;
+    uint8_t in[MAXLEN + 1];
+    uint8_t ref[MAXLEN + 1];
+    for (long it = 0; it < iterations; it++) {
+      size_t len = randominput(in, MAXLEN);
+      uint8_t * s = pages + pagesize - (len + 1);
+      memcpy(s, in, len + 1);
+      unescapeuestring(s);
+      size_t outlen = strlen(s);
+      refdecode(in, ref);
+      size_t reflen = strlen(ref); /* %00 ends the string */
+      const char * err = NULL;
+      if (outlen > len) {
+        err = "result longer than input";
+      } else if ((outlen != reflen) || (memcmp(s, ref, reflen) != 0)) {
+        err = "result differs from reference decoder";
+      } else if (checkescape(s, outlen) != 0) {
+        err = "htmlescape output is wrong";
+      }
+      if (err != NULL) {
+        if (nrfails < 10) {
+          printf("FAIL: %s for input \"", err);
+          for (size_t i = 0; i < len; i++) {
+            printf((isprint(in[i]) && (in[i] != '\\')) ? "%c" : "\\x%02x", in[i]);
+          }
+          printf("\"\n");
+        }
+        nrfails++;
+      }
+    }
+    printf("%ld random inputs checked, %ld failed\n", iterations, nrfails);
+    nrfails += checkcbor();
+    static const struct { const char * name; const char * in; } benchinputs[] = {
+      { "settings form", "wifi_cl_ssid=My+WLAN+%28upstairs%29&wifi_cl_pw=s3cr3t%21%23%24"
+                         "&submit_url=https%3A%2F%2Fexample.org%2Fupload%3Fid%3D42"
+                         "&submit_interval=300&timezone=CET-1CEST%2CM3.5.0%2CM10.5.0%2F3" },
+      { "plain text", "thisisaverylongvaluewithoutanyescapesatallwhichshouldbefast"
+                      "thisisaverylongvaluewithoutanyescapesatallwhichshouldbefast" },
+      { "all escaped", "%C3%A4%C3%B6%C3%BC%20%21%22%23%24%25%26%27%28%29%2A%2B%2C"
+                       "%2D%2E%2F%3A%3B%3C%3D%3E%3F%40%5B%5C%5D%5E%5F%60%7B%7C%7D%7E" },
+    };
+    printf("%-16s %14s %14s\n", "ns/byte", "strncmp (old)", "table (new)");
+    for (int i = 0; i < (sizeof(benchinputs) / sizeof(benchinputs[0])); i++) {
+      printf("%-16s %14.2f %14.2f\n", benchinputs[i].name,
+             benchdecoder(oldunescape, benchinputs[i].in),
+             benchdecoder(unescapeuestring, benchinputs[i].in));
+    }
+    munmap(pages, 2 * pagesize);
+    return (nrfails > 0) ? 1 : 0;
+}